@@ -1,4 +1,5 @@
 #include "column_reader.hpp"
+#include "parquet_dbp_decoder.hpp"
 #include "parquet_timestamp.hpp"
 #include "utf8proc_wrapper.hpp"
 #include "parquet_reader.hpp"
@@ -39,10 +40,9 @@ const uint8_t RleBpDecoder::BITPACK_DLEN = 8;
 ColumnReader::ColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p, idx_t file_idx_p,
                            idx_t max_define_p, idx_t max_repeat_p)
     : schema(schema_p), file_idx(file_idx_p), max_define(max_define_p), max_repeat(max_repeat_p), reader(reader),
-      type(move(type_p)), page_rows_available(0), dummy_result(type, nullptr) {
+      type(move(type_p)), page_rows_available(0), pending_skips(0) {
 
 	// dummies for Skip()
-	none_filter.none();
 	dummy_define.resize(reader.allocator, STANDARD_VECTOR_SIZE);
 	dummy_repeat.resize(reader.allocator, STANDARD_VECTOR_SIZE);
 }
@@ -133,16 +133,20 @@ unique_ptr<ColumnReader> ColumnReader::CreateReader(ParquetReader &reader, const
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
-	dict_decoder.reset();
-	defined_decoder.reset();
-	block.reset();
-
 	PageHeader page_hdr;
 	page_hdr.read(protocol);
 
 	//	page_hdr.printTo(std::cout);
 	//	std::cout << '\n';
 
+	PrepareRead(page_hdr);
+}
+
+void ColumnReader::PrepareRead(PageHeader &page_hdr) {
+	dict_decoder.reset();
+	defined_decoder.reset();
+	block.reset();
+
 	PreparePage(page_hdr.compressed_page_size, page_hdr.uncompressed_page_size);
 
 	switch (page_hdr.type) {
@@ -264,6 +268,23 @@ void ColumnReader::PrepareDataPage(PageHeader &page_hdr) {
 		block->inc(block->len);
 		break;
 	}
+	case Encoding::DELTA_BINARY_PACKED: {
+		// decode all values of the page up front, after which they can be read as plain values
+		DbpDecoder decoder((const uint8_t *)block->ptr, block->len);
+		auto plain_block = make_shared<ResizeableBuffer>();
+		switch (schema.type) {
+		case Type::INT32:
+			decoder.Decode<int32_t>(reader.allocator, *plain_block);
+			break;
+		case Type::INT64:
+			decoder.Decode<int64_t>(reader.allocator, *plain_block);
+			break;
+		default:
+			throw std::runtime_error("DELTA_BINARY_PACKED is only supported for INT32 and INT64 columns");
+		}
+		block = move(plain_block);
+		break;
+	}
 	case Encoding::PLAIN:
 		// nothing to do here, will be read directly below
 		break;
@@ -279,6 +300,8 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, uint8_t
 	auto &trans = (ThriftFileTransport &)*protocol->getTransport();
 	trans.SetLocation(chunk_read_offset);
 
+	ApplyPendingSkips();
+
 	idx_t result_offset = 0;
 	auto to_read = num_values;
 
@@ -333,14 +356,61 @@ idx_t ColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, uint8_t
 }
 
 void ColumnReader::Skip(idx_t num_values) {
-	dummy_define.zero();
-	dummy_repeat.zero();
-
-	// TODO this can be optimized, for example we dont actually have to bitunpack offsets
-	auto values_read =
-	    Read(num_values, none_filter, (uint8_t *)dummy_define.ptr, (uint8_t *)dummy_repeat.ptr, dummy_result);
-	if (values_read != num_values) {
-		throw std::runtime_error("Row count mismatch when skipping rows");
+	pending_skips += num_values;
+	group_rows_available -= num_values;
+}
+
+void ColumnReader::ApplyPendingSkips() {
+	auto &trans = (ThriftFileTransport &)*protocol->getTransport();
+	while (pending_skips > 0) {
+		if (page_rows_available == 0) {
+			PageHeader page_hdr;
+			page_hdr.read(protocol);
+
+			idx_t page_values = 0;
+			bool is_data_page = false;
+			if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+				page_values = page_hdr.data_page_header.num_values;
+				is_data_page = true;
+			} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+				page_values = page_hdr.data_page_header_v2.num_values;
+				is_data_page = true;
+			}
+			if (is_data_page && page_values <= pending_skips) {
+				// none of the values of this page are needed: skip it without decompressing it
+				trans.SetLocation(trans.GetLocation() + page_hdr.compressed_page_size);
+				pending_skips -= page_values;
+			} else {
+				PrepareRead(page_hdr);
+			}
+			continue;
+		}
+
+		auto skip_now = MinValue<idx_t>(MinValue<idx_t>(pending_skips, page_rows_available), STANDARD_VECTOR_SIZE);
+		auto defines = (uint8_t *)dummy_define.ptr;
+		if (HasRepeats()) {
+			repeated_decoder->GetBatch<uint8_t>(dummy_repeat.ptr, skip_now);
+		}
+		// the plain values and dictionary offsets have no entries for nulls
+		idx_t value_count = skip_now;
+		if (HasDefines()) {
+			defined_decoder->GetBatch<uint8_t>(dummy_define.ptr, skip_now);
+			for (idx_t i = 0; i < skip_now; i++) {
+				if (defines[i] != max_define) {
+					value_count--;
+				}
+			}
+		}
+
+		if (dict_decoder) {
+			offset_buffer.resize(reader.allocator, sizeof(uint32_t) * value_count);
+			dict_decoder->GetBatch<uint32_t>(offset_buffer.ptr, value_count);
+		} else {
+			PlainSkip(*block, defines, skip_now);
+		}
+
+		page_rows_available -= skip_now;
+		pending_skips -= skip_now;
 	}
 }
 
@@ -486,6 +556,21 @@ idx_t ListColumnReader::Read(uint64_t num_values, parquet_filter_t &filter, uint
 	return result_offset;
 }
 
+void ListColumnReader::Skip(idx_t num_values) {
+	// the child values that belong to the skipped lists are only known after reading their repetition levels
+	parquet_filter_t filter;
+	while (num_values > 0) {
+		auto skip_now = MinValue<idx_t>(num_values, STANDARD_VECTOR_SIZE);
+		Vector dummy_result(Type());
+		auto values_read =
+		    Read(skip_now, filter, (uint8_t *)dummy_define.ptr, (uint8_t *)dummy_repeat.ptr, dummy_result);
+		if (values_read != skip_now) {
+			throw std::runtime_error("Row count mismatch when skipping rows");
+		}
+		num_values -= skip_now;
+	}
+}
+
 ListColumnReader::ListColumnReader(ParquetReader &reader, LogicalType type_p, const SchemaElement &schema_p,
                                    idx_t schema_idx_p, idx_t max_define_p, idx_t max_repeat_p,
                                    unique_ptr<ColumnReader> child_column_reader_p)
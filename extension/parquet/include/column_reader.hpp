@@ -65,12 +65,15 @@ public:
 			chunk_read_offset = chunk->meta_data.dictionary_page_offset;
 		}
 		group_rows_available = chunk->meta_data.num_values;
+		pending_skips = 0;
 	}
 	virtual ~ColumnReader();
 
 	virtual idx_t Read(uint64_t num_values, parquet_filter_t &filter, uint8_t *define_out, uint8_t *repeat_out,
 	                   Vector &result_out);
 
+	//! Skips over the next num_values values. The skip is deferred until the next Read(), so that consecutive skips
+	//! can skip over entire pages without decompressing them
 	virtual void Skip(idx_t num_values);
 
 	const LogicalType &Type() {
@@ -109,6 +112,10 @@ protected:
 		throw NotImplementedException("Offsets");
 	}
 
+	virtual void PlainSkip(ByteBuffer &plain_data, uint8_t *defines, idx_t num_values) {
+		throw NotImplementedException("PlainSkip");
+	}
+
 	// these are nops for most types, but not for strings
 	virtual void DictReference(Vector &result) {
 	}
@@ -133,8 +140,14 @@ protected:
 	ParquetReader &reader;
 	LogicalType type;
 
+	// dummies for Skip()
+	ResizeableBuffer dummy_define;
+	ResizeableBuffer dummy_repeat;
+
 private:
 	void PrepareRead(parquet_filter_t &filter);
+	void PrepareRead(PageHeader &page_hdr);
+	void ApplyPendingSkips();
 	void PreparePage(idx_t compressed_page_size, idx_t uncompressed_page_size);
 	void PrepareDataPage(PageHeader &page_hdr);
 
@@ -144,6 +157,8 @@ private:
 	idx_t page_rows_available;
 	idx_t group_rows_available;
 	idx_t chunk_read_offset;
+	//! The amount of values that have been skipped but not yet read past
+	idx_t pending_skips;
 
 	shared_ptr<ResizeableBuffer> block;
 
@@ -152,12 +167,6 @@ private:
 	unique_ptr<RleBpDecoder> dict_decoder;
 	unique_ptr<RleBpDecoder> defined_decoder;
 	unique_ptr<RleBpDecoder> repeated_decoder;
-
-	// dummies for Skip()
-	Vector dummy_result;
-	parquet_filter_t none_filter;
-	ResizeableBuffer dummy_define;
-	ResizeableBuffer dummy_repeat;
 };
 
 } // namespace duckdb
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_decoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "resizable_buffer.hpp"
+
+#include <type_traits>
+
+namespace duckdb {
+
+//! Decodes values that are stored with the DELTA_BINARY_PACKED encoding
+class DbpDecoder {
+public:
+	DbpDecoder(const uint8_t *buffer, uint32_t buffer_len) : buffer_((char *)buffer, buffer_len), bitpack_pos(0) {
+	}
+
+	//! Decodes all values and stores them as plain values of type T in the result
+	template <class T>
+	void Decode(Allocator &allocator, ResizeableBuffer &result) {
+		typedef typename std::make_unsigned<T>::type UNSIGNED_TYPE;
+
+		auto block_size = VarintDecode();
+		auto miniblocks_per_block = VarintDecode();
+		auto total_values = VarintDecode();
+		auto value = (UNSIGNED_TYPE)ZigZagDecode(VarintDecode());
+		if (block_size == 0 || miniblocks_per_block == 0 || block_size % miniblocks_per_block != 0 ||
+		    (block_size / miniblocks_per_block) % 8 != 0) {
+			throw std::runtime_error("Invalid DELTA_BINARY_PACKED block layout");
+		}
+		auto miniblock_size = block_size / miniblocks_per_block;
+
+		result.resize(allocator, total_values * sizeof(T));
+		auto result_ptr = (T *)result.ptr;
+		if (total_values == 0) {
+			return;
+		}
+		result_ptr[0] = (T)value;
+		uint64_t values_read = 1;
+		while (values_read < total_values) {
+			auto min_delta = (UNSIGNED_TYPE)ZigZagDecode(VarintDecode());
+			buffer_.available(miniblocks_per_block);
+			auto bit_widths = (const uint8_t *)buffer_.ptr;
+			buffer_.inc(miniblocks_per_block);
+			for (uint64_t miniblock = 0; miniblock < miniblocks_per_block && values_read < total_values;
+			     miniblock++) {
+				if (bit_widths[miniblock] > sizeof(T) * 8) {
+					throw std::runtime_error("DELTA_BINARY_PACKED bit width too large");
+				}
+				// the last miniblock is padded, so we always read all of its values
+				for (uint64_t i = 0; i < miniblock_size; i++) {
+					auto delta = (UNSIGNED_TYPE)BitUnpack(bit_widths[miniblock]);
+					if (values_read < total_values) {
+						value += min_delta + delta;
+						result_ptr[values_read++] = (T)value;
+					}
+				}
+			}
+		}
+	}
+
+private:
+	ByteBuffer buffer_;
+	uint8_t bitpack_pos;
+
+	uint64_t VarintDecode() {
+		uint64_t result = 0;
+		uint8_t shift = 0;
+		while (true) {
+			auto byte = buffer_.read<uint8_t>();
+			result |= (uint64_t)(byte & 127) << shift;
+			if ((byte & 128) == 0) {
+				break;
+			}
+			shift += 7;
+			if (shift > 63) {
+				throw std::runtime_error("Varint-decoding found too large number");
+			}
+		}
+		return result;
+	}
+
+	static int64_t ZigZagDecode(uint64_t value) {
+		return (int64_t)((value >> 1) ^ (~(value & 1) + 1));
+	}
+
+	uint64_t BitUnpack(uint8_t bit_width) {
+		uint64_t result = 0;
+		uint8_t result_bits = 0;
+		while (result_bits < bit_width) {
+			uint8_t bits = MinValue<uint8_t>(bit_width - result_bits, 8 - bitpack_pos);
+			uint64_t byte = (buffer_.get<uint8_t>() >> bitpack_pos) & ((1ULL << bits) - 1);
+			result |= byte << result_bits;
+			result_bits += bits;
+			bitpack_pos += bits;
+			if (bitpack_pos == 8) {
+				buffer_.inc(1);
+				bitpack_pos = 0;
+			}
+		}
+		return result;
+	}
+};
+
+} // namespace duckdb
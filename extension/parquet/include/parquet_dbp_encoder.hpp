@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "parquet_rle_bp_encoder.hpp"
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/limits.hpp"
+#endif
+
+#include <type_traits>
+
+namespace duckdb {
+
+//! Encodes INT32 and INT64 values with the DELTA_BINARY_PACKED encoding: the values are stored as the deltas between
+//! consecutive values, which are bit-packed per miniblock after subtracting the smallest delta of their block
+class DbpEncoder {
+public:
+	static constexpr idx_t BLOCK_SIZE = 128;
+	static constexpr idx_t MINIBLOCKS_PER_BLOCK = 4;
+	static constexpr idx_t MINIBLOCK_SIZE = BLOCK_SIZE / MINIBLOCKS_PER_BLOCK;
+
+	template <class T>
+	static void Encode(Serializer &ser, const T *values, idx_t count) {
+		// the deltas wrap around in the unsigned type, which is what the readers do as well
+		typedef typename std::make_unsigned<T>::type UNSIGNED_TYPE;
+
+		RleBpEncoder::VarintEncode(BLOCK_SIZE, ser);
+		RleBpEncoder::VarintEncode(MINIBLOCKS_PER_BLOCK, ser);
+		RleBpEncoder::VarintEncode(count, ser);
+		RleBpEncoder::VarintEncode(ZigZagEncode<T>(count > 0 ? values[0] : 0), ser);
+
+		T deltas[BLOCK_SIZE];
+		UNSIGNED_TYPE packed[BLOCK_SIZE];
+		for (idx_t block_start = 1; block_start < count; block_start += BLOCK_SIZE) {
+			idx_t block_count = MinValue<idx_t>(BLOCK_SIZE, count - block_start);
+			T min_delta = NumericLimits<T>::Maximum();
+			for (idx_t i = 0; i < block_count; i++) {
+				auto current = (UNSIGNED_TYPE)values[block_start + i];
+				auto previous = (UNSIGNED_TYPE)values[block_start + i - 1];
+				deltas[i] = (T)(UNSIGNED_TYPE)(current - previous);
+				min_delta = MinValue<T>(min_delta, deltas[i]);
+			}
+			// the unused values of the last miniblock are padded with zeros
+			for (idx_t i = 0; i < BLOCK_SIZE; i++) {
+				packed[i] = i < block_count ? (UNSIGNED_TYPE)((UNSIGNED_TYPE)deltas[i] - (UNSIGNED_TYPE)min_delta) : 0;
+			}
+			uint8_t bit_widths[MINIBLOCKS_PER_BLOCK];
+			for (idx_t miniblock = 0; miniblock < MINIBLOCKS_PER_BLOCK; miniblock++) {
+				UNSIGNED_TYPE max_value = 0;
+				for (idx_t i = miniblock * MINIBLOCK_SIZE; i < (miniblock + 1) * MINIBLOCK_SIZE; i++) {
+					max_value |= packed[i];
+				}
+				bit_widths[miniblock] = RleBpEncoder::ComputeBitWidth(max_value);
+			}
+
+			RleBpEncoder::VarintEncode(ZigZagEncode<T>(min_delta), ser);
+			ser.WriteData((const_data_ptr_t)bit_widths, MINIBLOCKS_PER_BLOCK);
+			// miniblocks that contain no values at all are not written
+			BitPackWriter writer(ser);
+			for (idx_t miniblock = 0; miniblock * MINIBLOCK_SIZE < block_count; miniblock++) {
+				for (idx_t i = miniblock * MINIBLOCK_SIZE; i < (miniblock + 1) * MINIBLOCK_SIZE; i++) {
+					writer.Write(packed[i], bit_widths[miniblock]);
+				}
+			}
+			writer.Flush();
+		}
+	}
+
+private:
+	template <class T>
+	static uint64_t ZigZagEncode(T value) {
+		auto extended = (int64_t)value;
+		return ((uint64_t)extended << 1) ^ (uint64_t)(extended >> 63);
+	}
+};
+
+} // namespace duckdb
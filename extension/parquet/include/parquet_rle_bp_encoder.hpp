@@ -0,0 +1,131 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_rle_bp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer.hpp"
+#endif
+
+namespace duckdb {
+
+//! Writes values with a fixed bit width to a serializer, least significant bit first
+class BitPackWriter {
+public:
+	explicit BitPackWriter(Serializer &ser) : ser(ser), byte(0), bit_pos(0) {
+	}
+
+	void Write(uint64_t value, uint8_t bit_width) {
+		while (bit_width > 0) {
+			uint8_t bits = MinValue<uint8_t>(bit_width, 8 - bit_pos);
+			byte |= (uint8_t)((value & ((1ULL << bits) - 1)) << bit_pos);
+			value >>= bits;
+			bit_width -= bits;
+			bit_pos += bits;
+			if (bit_pos == 8) {
+				ser.Write<uint8_t>(byte);
+				byte = 0;
+				bit_pos = 0;
+			}
+		}
+	}
+
+	//! Writes the last partial byte (if any)
+	void Flush() {
+		if (bit_pos > 0) {
+			ser.Write<uint8_t>(byte);
+			byte = 0;
+			bit_pos = 0;
+		}
+	}
+
+private:
+	Serializer &ser;
+	uint8_t byte;
+	uint8_t bit_pos;
+};
+
+class RleBpEncoder {
+public:
+	//! Runs of at least this many equal values are written as a RLE run instead of as bit-packed literals
+	static constexpr idx_t MINIMUM_RUN_LENGTH = 8;
+
+	//! Encodes the values with the RLE/bit-packing hybrid encoding, without the length prefix
+	template <class T>
+	static void Encode(Serializer &ser, const T *values, idx_t count, uint8_t bit_width) {
+		// bit-packed literals are written in groups of 8, so a run can only start after a multiple of 8 literals
+		idx_t literal_start = 0;
+		idx_t i = 0;
+		while (i < count) {
+			if ((i - literal_start) % 8 == 0) {
+				idx_t run_end = i + 1;
+				while (run_end < count && values[run_end] == values[i]) {
+					run_end++;
+				}
+				if (run_end - i >= MINIMUM_RUN_LENGTH) {
+					WriteLiterals(ser, values + literal_start, i - literal_start, bit_width);
+					WriteRun(ser, values[i], run_end - i, bit_width);
+					i = run_end;
+					literal_start = i;
+					continue;
+				}
+			}
+			i++;
+		}
+		WriteLiterals(ser, values + literal_start, count - literal_start, bit_width);
+	}
+
+	static void VarintEncode(uint64_t val, Serializer &ser) {
+		do {
+			uint8_t byte = val & 127;
+			val >>= 7;
+			if (val != 0) {
+				byte |= 128;
+			}
+			ser.Write<uint8_t>(byte);
+		} while (val != 0);
+	}
+
+	//! The number of bits that are required to store values up to and including max_value
+	static uint8_t ComputeBitWidth(uint64_t max_value) {
+		uint8_t width = 0;
+		while (max_value != 0) {
+			max_value >>= 1;
+			width++;
+		}
+		return width;
+	}
+
+private:
+	template <class T>
+	static void WriteRun(Serializer &ser, T value, idx_t count, uint8_t bit_width) {
+		VarintEncode(count << 1, ser);
+		// the repeated value is stored in the minimum amount of bytes, little-endian
+		for (idx_t byte_idx = 0; byte_idx < (idx_t)(bit_width + 7) / 8; byte_idx++) {
+			ser.Write<uint8_t>((uint8_t)((uint64_t)value >> (byte_idx * 8)));
+		}
+	}
+
+	template <class T>
+	static void WriteLiterals(Serializer &ser, const T *values, idx_t count, uint8_t bit_width) {
+		if (count == 0) {
+			return;
+		}
+		// the literals are padded to a multiple of 8, which is only allowed at the very end of the values
+		idx_t group_count = (count + 7) / 8;
+		VarintEncode((group_count << 1) | 1, ser);
+		BitPackWriter writer(ser);
+		for (idx_t i = 0; i < group_count * 8; i++) {
+			writer.Write(i < count ? (uint64_t)values[i] : 0, bit_width);
+		}
+		writer.Flush();
+	}
+};
+
+} // namespace duckdb
@@ -14,6 +14,7 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
 #include "duckdb/common/types/chunk_collection.hpp"
 #endif
 
@@ -23,12 +24,25 @@
 namespace duckdb {
 class FileSystem;
 
+//! A row group that has been encoded and compressed, but not yet written to the file
+struct PreparedRowGroup {
+	//! The meta data of the row group, the offsets in it are relative to the start of the serializer
+	duckdb_parquet::format::RowGroup row_group;
+	//! The page headers and (compressed) pages of all columns of the row group
+	BufferedSerializer serializer;
+};
+
 class ParquetWriter {
 public:
 	ParquetWriter(FileSystem &fs, string file_name, vector<LogicalType> types, vector<string> names,
 	              duckdb_parquet::format::CompressionCodec::type codec);
 
 public:
+	//! Encodes and compresses a chunk collection into a row group, can be called from multiple threads at the same time
+	void PrepareRowGroup(ChunkCollection &buffer, PreparedRowGroup &result);
+	//! Appends a prepared row group to the file
+	void FlushRowGroup(PreparedRowGroup &row_group);
+	//! Prepares a chunk collection as a row group and appends it to the file
 	void Flush(ChunkCollection &buffer);
 	void Finalize();
 
@@ -50,8 +50,10 @@ public:
 		return num_values;
 	}
 
-	virtual void Skip(idx_t num_values) override {
-		D_ASSERT(0);
+	void Skip(idx_t num_values) override {
+		for (auto &child : child_readers) {
+			child->Skip(num_values);
+		}
 	}
 
 	idx_t GroupRowsAvailable() override {
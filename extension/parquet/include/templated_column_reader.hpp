@@ -85,6 +85,15 @@ public:
 			}
 		}
 	}
+
+	void PlainSkip(ByteBuffer &plain_data, uint8_t *defines, idx_t num_values) override {
+		for (idx_t row_idx = 0; row_idx < num_values; row_idx++) {
+			if (HasDefines() && defines[row_idx] != max_define) {
+				continue;
+			}
+			VALUE_CONVERSION::PlainSkip(plain_data, *this);
+		}
+	}
 };
 
 template <class PARQUET_PHYSICAL_TYPE, class DUCKDB_PHYSICAL_TYPE,
@@ -1,5 +1,6 @@
 #include "parquet_writer.hpp"
-#include "parquet_timestamp.hpp"
+#include "parquet_dbp_encoder.hpp"
+#include "parquet_rle_bp_encoder.hpp"
 
 #include "duckdb.hpp"
 #ifndef DUCKDB_AMALGAMATION
@@ -10,6 +11,9 @@
 #include "duckdb/main/connection.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/date.hpp"
 #include "duckdb/common/types/time.hpp"
 #include "duckdb/common/types/timestamp.hpp"
@@ -21,6 +25,8 @@
 #include "miniz_wrapper.hpp"
 #include "zstd.h"
 
+#include <cmath>
+
 namespace duckdb {
 
 using namespace duckdb_parquet;                   // NOLINT
@@ -69,8 +75,10 @@ static Type::type DuckDBTypeToParquetType(const LogicalType &duckdb_type) {
 	case LogicalTypeId::TINYINT:
 	case LogicalTypeId::SMALLINT:
 	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
 		return Type::INT32;
 	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::TIMESTAMP:
 		return Type::INT64;
 	case LogicalTypeId::FLOAT:
 		return Type::FLOAT;
@@ -80,9 +88,6 @@ static Type::type DuckDBTypeToParquetType(const LogicalType &duckdb_type) {
 	case LogicalTypeId::VARCHAR:
 	case LogicalTypeId::BLOB:
 		return Type::BYTE_ARRAY;
-	case LogicalTypeId::DATE:
-	case LogicalTypeId::TIMESTAMP:
-		return Type::INT96;
 	default:
 		throw NotImplementedException(duckdb_type.ToString());
 	}
@@ -93,43 +98,429 @@ static bool DuckDBTypeToConvertedType(const LogicalType &duckdb_type, ConvertedT
 	case LogicalTypeId::VARCHAR:
 		result = ConvertedType::UTF8;
 		return true;
+	case LogicalTypeId::DATE:
+		result = ConvertedType::DATE;
+		return true;
+	case LogicalTypeId::TIMESTAMP:
+		result = ConvertedType::TIMESTAMP_MICROS;
+		return true;
 	default:
 		return false;
 	}
 }
 
-static void VarintEncode(uint32_t val, Serializer &ser) {
-	do {
-		uint8_t byte = val & 127;
-		val >>= 7;
-		if (val != 0) {
-			byte |= 128;
+//! Dictionaries that get larger than this fall back to another encoding
+static constexpr const idx_t MAX_DICTIONARY_SIZE = 1024 * 1024;
+//! Strings that are longer than this are not stored as the min/max statistics of a column chunk
+static constexpr const idx_t MAX_STRING_STATISTICS_SIZE = 1024;
+
+//! The encoded values of a column chunk
+struct EncodedColumnChunk {
+	EncodedColumnChunk() : encoding(Encoding::PLAIN), dictionary_size(0) {
+	}
+
+	Encoding::type encoding;
+	//! The dictionary page and the number of entries in it (if the values are dictionary encoded)
+	BufferedSerializer dictionary;
+	idx_t dictionary_size;
+	duckdb_parquet::format::Statistics statistics;
+};
+
+struct ParquetCastOperator {
+	template <class SRC, class TGT>
+	static TGT Operation(SRC input) {
+		return TGT(input);
+	}
+};
+
+struct ParquetDateOperator {
+	template <class SRC, class TGT>
+	static TGT Operation(SRC input) {
+		return Date::EpochDays(input);
+	}
+};
+
+struct ParquetTimestampOperator {
+	template <class SRC, class TGT>
+	static TGT Operation(SRC input) {
+		return Timestamp::GetEpochMicroSeconds(input);
+	}
+};
+
+struct StringHashFunction {
+	hash_t operator()(const string_t &val) const {
+		return Hash(val);
+	}
+};
+
+struct StringEqualityFunction {
+	bool operator()(const string_t &a, const string_t &b) const {
+		return Equals::Operation(a, b);
+	}
+};
+
+template <class T>
+static bool IsNaN(T value) {
+	return false;
+}
+
+static bool IsNaN(float value) {
+	return std::isnan(value);
+}
+
+static bool IsNaN(double value) {
+	return std::isnan(value);
+}
+
+//! Parquet readers expect a zero minimum to be -0.0 and a zero maximum to be +0.0, as both compare equal
+template <class T>
+static void AdjustZeroStatistics(T &min, T &max) {
+}
+
+static void AdjustZeroStatistics(float &min, float &max) {
+	min = min == 0 ? -0.0f : min;
+	max = max == 0 ? 0.0f : max;
+}
+
+static void AdjustZeroStatistics(double &min, double &max) {
+	min = min == 0 ? -0.0 : min;
+	max = max == 0 ? 0.0 : max;
+}
+
+//! Collects the non-null values of a column, and returns the number of null values
+template <class SRC>
+static idx_t GatherValues(ChunkCollection &buffer, idx_t col_idx, vector<SRC> &values) {
+	values.reserve(buffer.Count());
+	for (auto &chunk : buffer.Chunks()) {
+		auto input = &chunk->data[col_idx];
+		unique_ptr<Vector> double_vec;
+		if (input->GetType().id() == LogicalTypeId::DECIMAL) {
+			// decimals are written as doubles
+			double_vec = make_unique<Vector>(LogicalType::DOUBLE);
+			VectorOperations::Cast(*input, *double_vec, chunk->size());
+			input = double_vec.get();
 		}
-		ser.Write<uint8_t>(byte);
-	} while (val != 0);
+		auto data = FlatVector::GetData<SRC>(*input);
+		auto &mask = FlatVector::Validity(*input);
+		for (idx_t r = 0; r < chunk->size(); r++) {
+			if (mask.RowIsValid(r)) {
+				values.push_back(data[r]);
+			}
+		}
+	}
+	return buffer.Count() - values.size();
 }
 
-static uint8_t GetVarintSize(uint32_t val) {
-	uint8_t res = 0;
-	do {
-		uint8_t byte = val & 127;
-		val >>= 7;
-		if (val != 0) {
-			byte |= 128;
+template <class SRC, class TGT, class OP>
+static void SetStatistics(const vector<SRC> &values, idx_t null_count, duckdb_parquet::format::Statistics &stats) {
+	stats.__set_null_count(null_count);
+	idx_t first_idx = 0;
+	while (first_idx < values.size() && IsNaN(values[first_idx])) {
+		first_idx++;
+	}
+	if (first_idx == values.size()) {
+		// only NULL and NaN values: no min/max
+		return;
+	}
+	auto min = values[first_idx];
+	auto max = values[first_idx];
+	for (idx_t i = first_idx + 1; i < values.size(); i++) {
+		if (IsNaN(values[i])) {
+			continue;
+		}
+		if (values[i] < min) {
+			min = values[i];
+		}
+		if (max < values[i]) {
+			max = values[i];
 		}
-		res++;
-	} while (val != 0);
-	return res;
+	}
+	AdjustZeroStatistics(min, max);
+	auto min_value = OP::template Operation<SRC, TGT>(min);
+	auto max_value = OP::template Operation<SRC, TGT>(max);
+	stats.__set_min_value(string((const char *)&min_value, sizeof(TGT)));
+	stats.__set_max_value(string((const char *)&max_value, sizeof(TGT)));
+}
+
+//! Whether or not a dictionary and the indexes into it are smaller than the plain encoded values
+static bool DictionaryIsSmaller(idx_t dictionary_bytes, idx_t dictionary_size, idx_t value_count, idx_t plain_bytes) {
+	auto bit_width = MaxValue<uint8_t>(1, RleBpEncoder::ComputeBitWidth(dictionary_size - 1));
+	return dictionary_bytes + value_count * bit_width / 8 < plain_bytes;
+}
+
+static void WriteDictionaryIndexes(const vector<uint32_t> &indexes, idx_t dictionary_size, Serializer &ser) {
+	// the indexes are stored with their bit width, followed by the RLE/bit-packed indexes
+	auto bit_width = MaxValue<uint8_t>(1, RleBpEncoder::ComputeBitWidth(dictionary_size - 1));
+	ser.Write<uint8_t>(bit_width);
+	RleBpEncoder::Encode(ser, indexes.data(), indexes.size(), bit_width);
+}
+
+//! The dictionary key of a value is its bit pattern, so that e.g. -0.0 and 0.0 get their own dictionary entries
+template <class T>
+static uint64_t DictionaryKey(const T &value) {
+	static_assert(sizeof(T) <= sizeof(uint64_t), "dictionary keys are at most 8 bytes");
+	uint64_t key = 0;
+	memcpy(&key, &value, sizeof(T));
+	return key;
 }
 
-template <class SRC, class TGT>
-static void TemplatedWritePlain(Vector &col, idx_t length, ValidityMask &mask, Serializer &ser) {
-	auto *ptr = FlatVector::GetData<SRC>(col);
-	for (idx_t r = 0; r < length; r++) {
-		if (mask.RowIsValid(r)) {
-			ser.Write<TGT>((TGT)ptr[r]);
+template <class SRC, class TGT, class OP>
+static bool TryDictionaryEncode(const vector<SRC> &values, EncodedColumnChunk &result, Serializer &ser) {
+	if (values.empty()) {
+		return false;
+	}
+	unordered_map<uint64_t, uint32_t> dictionary_map;
+	vector<SRC> dictionary;
+	vector<uint32_t> indexes;
+	indexes.reserve(values.size());
+	for (auto &value : values) {
+		auto key = DictionaryKey(value);
+		auto entry = dictionary_map.find(key);
+		if (entry != dictionary_map.end()) {
+			indexes.push_back(entry->second);
+			continue;
+		}
+		if ((dictionary.size() + 1) * sizeof(TGT) > MAX_DICTIONARY_SIZE) {
+			return false;
 		}
+		dictionary_map[key] = dictionary.size();
+		indexes.push_back(dictionary.size());
+		dictionary.push_back(value);
+	}
+	if (!DictionaryIsSmaller(dictionary.size() * sizeof(TGT), dictionary.size(), values.size(),
+	                         values.size() * sizeof(TGT))) {
+		return false;
 	}
+	for (auto &value : dictionary) {
+		result.dictionary.Write<TGT>(OP::template Operation<SRC, TGT>(value));
+	}
+	result.encoding = Encoding::RLE_DICTIONARY;
+	result.dictionary_size = dictionary.size();
+	WriteDictionaryIndexes(indexes, dictionary.size(), ser);
+	return true;
+}
+
+template <class SRC, class TGT, class OP = ParquetCastOperator>
+static void EncodeFixedColumn(ChunkCollection &buffer, idx_t col_idx, EncodedColumnChunk &result, Serializer &ser) {
+	vector<SRC> values;
+	auto null_count = GatherValues<SRC>(buffer, col_idx, values);
+	SetStatistics<SRC, TGT, OP>(values, null_count, result.statistics);
+	if (TryDictionaryEncode<SRC, TGT, OP>(values, result, ser)) {
+		return;
+	}
+	for (auto &value : values) {
+		ser.Write<TGT>(OP::template Operation<SRC, TGT>(value));
+	}
+}
+
+template <class SRC, class TGT, class OP = ParquetCastOperator>
+static void EncodeIntegerColumn(ChunkCollection &buffer, idx_t col_idx, EncodedColumnChunk &result, Serializer &ser) {
+	vector<SRC> values;
+	auto null_count = GatherValues<SRC>(buffer, col_idx, values);
+	SetStatistics<SRC, TGT, OP>(values, null_count, result.statistics);
+	if (TryDictionaryEncode<SRC, TGT, OP>(values, result, ser)) {
+		return;
+	}
+	// integers without many repeated values are delta encoded, unless that is larger than the plain values
+	vector<TGT> target_values;
+	target_values.reserve(values.size());
+	for (auto &value : values) {
+		target_values.push_back(OP::template Operation<SRC, TGT>(value));
+	}
+	BufferedSerializer delta_ser;
+	DbpEncoder::Encode<TGT>(delta_ser, target_values.data(), target_values.size());
+	if (delta_ser.blob.size < target_values.size() * sizeof(TGT)) {
+		result.encoding = Encoding::DELTA_BINARY_PACKED;
+		ser.WriteData(delta_ser.blob.data.get(), delta_ser.blob.size);
+		return;
+	}
+	for (auto &value : target_values) {
+		ser.Write<TGT>(value);
+	}
+}
+
+static void WriteString(const string_t &value, Serializer &ser) {
+	ser.Write<uint32_t>(value.GetSize());
+	ser.WriteData((const_data_ptr_t)value.GetDataUnsafe(), value.GetSize());
+}
+
+static void EncodeStringColumn(ChunkCollection &buffer, idx_t col_idx, EncodedColumnChunk &result, Serializer &ser) {
+	vector<string_t> values;
+	auto null_count = GatherValues<string_t>(buffer, col_idx, values);
+
+	result.statistics.__set_null_count(null_count);
+	if (!values.empty()) {
+		auto min = values[0];
+		auto max = values[0];
+		for (auto &value : values) {
+			if (GreaterThan::Operation(min, value)) {
+				min = value;
+			}
+			if (GreaterThan::Operation(value, max)) {
+				max = value;
+			}
+		}
+		if (min.GetSize() <= MAX_STRING_STATISTICS_SIZE && max.GetSize() <= MAX_STRING_STATISTICS_SIZE) {
+			result.statistics.__set_min_value(min.GetString());
+			result.statistics.__set_max_value(max.GetString());
+		}
+	}
+
+	unordered_map<string_t, uint32_t, StringHashFunction, StringEqualityFunction> dictionary_map;
+	vector<string_t> dictionary;
+	vector<uint32_t> indexes;
+	idx_t dictionary_bytes = 0;
+	idx_t plain_bytes = 0;
+	bool use_dictionary = !values.empty();
+	indexes.reserve(values.size());
+	for (auto &value : values) {
+		plain_bytes += sizeof(uint32_t) + value.GetSize();
+		if (!use_dictionary) {
+			continue;
+		}
+		auto entry = dictionary_map.find(value);
+		if (entry != dictionary_map.end()) {
+			indexes.push_back(entry->second);
+			continue;
+		}
+		dictionary_bytes += sizeof(uint32_t) + value.GetSize();
+		if (dictionary_bytes > MAX_DICTIONARY_SIZE) {
+			use_dictionary = false;
+			continue;
+		}
+		dictionary_map[value] = dictionary.size();
+		indexes.push_back(dictionary.size());
+		dictionary.push_back(value);
+	}
+	if (use_dictionary && DictionaryIsSmaller(dictionary_bytes, dictionary.size(), values.size(), plain_bytes)) {
+		for (auto &value : dictionary) {
+			WriteString(value, result.dictionary);
+		}
+		result.encoding = Encoding::RLE_DICTIONARY;
+		result.dictionary_size = dictionary.size();
+		WriteDictionaryIndexes(indexes, dictionary.size(), ser);
+		return;
+	}
+	for (auto &value : values) {
+		WriteString(value, ser);
+	}
+}
+
+static void EncodeBooleanColumn(ChunkCollection &buffer, idx_t col_idx, EncodedColumnChunk &result, Serializer &ser) {
+	vector<bool> values;
+	auto null_count = GatherValues<bool>(buffer, col_idx, values);
+	result.statistics.__set_null_count(null_count);
+	// booleans are bit-packed, a dictionary makes no sense for them
+	BitPackWriter writer(ser);
+	for (auto value : values) {
+		writer.Write(value, 1);
+	}
+	writer.Flush();
+}
+
+static void EncodeColumn(const LogicalType &type, ChunkCollection &buffer, idx_t col_idx, EncodedColumnChunk &result,
+                         Serializer &ser) {
+	switch (type.id()) {
+	case LogicalTypeId::BOOLEAN:
+		EncodeBooleanColumn(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::TINYINT:
+		EncodeIntegerColumn<int8_t, int32_t>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::SMALLINT:
+		EncodeIntegerColumn<int16_t, int32_t>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::INTEGER:
+		EncodeIntegerColumn<int32_t, int32_t>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::BIGINT:
+		EncodeIntegerColumn<int64_t, int64_t>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::FLOAT:
+		EncodeFixedColumn<float, float>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::DECIMAL: // for now written as double
+	case LogicalTypeId::DOUBLE:
+		EncodeFixedColumn<double, double>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::DATE:
+		EncodeIntegerColumn<date_t, int32_t, ParquetDateOperator>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::TIMESTAMP:
+		EncodeIntegerColumn<timestamp_t, int64_t, ParquetTimestampOperator>(buffer, col_idx, result, ser);
+		break;
+	case LogicalTypeId::BLOB:
+	case LogicalTypeId::VARCHAR:
+		EncodeStringColumn(buffer, col_idx, result, ser);
+		break;
+	default:
+		throw NotImplementedException(type.ToString());
+	}
+}
+
+static void WriteDefinitionLevels(ChunkCollection &buffer, idx_t col_idx, Serializer &ser) {
+	// the definition levels are the inverse of the nullmask, which we RLE/bit-pack with a bit width of 1
+	vector<uint8_t> levels;
+	levels.reserve(buffer.Count());
+	for (auto &chunk : buffer.Chunks()) {
+		auto &validity = FlatVector::Validity(chunk->data[col_idx]);
+		for (idx_t r = 0; r < chunk->size(); r++) {
+			levels.push_back(validity.RowIsValid(r) ? 1 : 0);
+		}
+	}
+	BufferedSerializer levels_ser;
+	RleBpEncoder::Encode(levels_ser, levels.data(), levels.size(), 1);
+	// in data pages v1 the definition levels are prefixed with their length
+	ser.Write<uint32_t>(levels_ser.blob.size);
+	ser.WriteData(levels_ser.blob.data.get(), levels_ser.blob.size);
+}
+
+//! Compresses a page, and writes the page header and the compressed page; returns the uncompressed size
+static idx_t WritePage(CompressionCodec::type codec, PageHeader &hdr, BufferedSerializer &page, TProtocol &protocol,
+                       Serializer &ser) {
+	size_t compressed_size;
+	data_ptr_t compressed_data;
+	unique_ptr<data_t[]> compressed_buf;
+	switch (codec) {
+	case CompressionCodec::UNCOMPRESSED:
+		compressed_size = page.blob.size;
+		compressed_data = page.blob.data.get();
+		break;
+	case CompressionCodec::SNAPPY: {
+		compressed_size = snappy::MaxCompressedLength(page.blob.size);
+		compressed_buf = unique_ptr<data_t[]>(new data_t[compressed_size]);
+		snappy::RawCompress((const char *)page.blob.data.get(), page.blob.size, (char *)compressed_buf.get(),
+		                    &compressed_size);
+		compressed_data = compressed_buf.get();
+		break;
+	}
+	case CompressionCodec::GZIP: {
+		MiniZStream s;
+		compressed_size = s.MaxCompressedLength(page.blob.size);
+		compressed_buf = unique_ptr<data_t[]>(new data_t[compressed_size]);
+		s.Compress((const char *)page.blob.data.get(), page.blob.size, (char *)compressed_buf.get(),
+		           &compressed_size);
+		compressed_data = compressed_buf.get();
+		break;
+	}
+	case CompressionCodec::ZSTD: {
+		compressed_size = duckdb_zstd::ZSTD_compressBound(page.blob.size);
+		compressed_buf = unique_ptr<data_t[]>(new data_t[compressed_size]);
+		compressed_size =
+		    duckdb_zstd::ZSTD_compress((void *)compressed_buf.get(), compressed_size,
+		                               (const void *)page.blob.data.get(), page.blob.size, ZSTD_CLEVEL_DEFAULT);
+		compressed_data = compressed_buf.get();
+		break;
+	}
+	default:
+		throw InternalException("Unsupported codec for Parquet Writer");
+	}
+
+	hdr.uncompressed_page_size = page.blob.size;
+	hdr.compressed_page_size = compressed_size;
+	auto header_size = hdr.write(&protocol);
+	ser.WriteData(compressed_data, compressed_size);
+	return header_size + page.blob.size;
 }
 
 ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalType> types_p, vector<string> names_p,
@@ -163,16 +554,16 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 	}
 }
 
-void ParquetWriter::Flush(ChunkCollection &buffer) {
-	if (buffer.Count() == 0) {
-		return;
-	}
-	lock_guard<mutex> glock(lock);
+void ParquetWriter::PrepareRowGroup(ChunkCollection &buffer, PreparedRowGroup &result) {
+	// the row group is written into the serializer of the result, so that it can be prepared without holding the lock
+	TCompactProtocolFactoryT<MyTransport> tproto_factory;
+	auto row_group_protocol = tproto_factory.getProtocol(make_shared<MyTransport>(result.serializer));
 
 	// set up a new row group for this chunk collection
-	ParquetRowGroup row_group;
+	auto &row_group = result.row_group;
 	row_group.num_rows = 0;
-	row_group.file_offset = writer->GetTotalWritten();
+	row_group.total_byte_size = 0;
+	row_group.file_offset = 0;
 	row_group.__isset.file_offset = true;
 	row_group.columns.resize(buffer.ColumnCount());
 
@@ -181,202 +572,90 @@ void ParquetWriter::Flush(ChunkCollection &buffer) {
 		// we start off by writing everything into a temporary buffer
 		// this is necessary to (1) know the total written size, and (2) to compress it afterwards
 		BufferedSerializer temp_writer;
+		WriteDefinitionLevels(buffer, i, temp_writer);
+		EncodedColumnChunk encoded;
+		EncodeColumn(sql_types[i], buffer, i, encoded, temp_writer);
+
+		auto &column_chunk = row_group.columns[i];
+		auto &meta_data = column_chunk.meta_data;
+		column_chunk.__isset.meta_data = true;
+
+		// record the current offset of the writer into the row group
+		// this is the starting position of the column chunk
+		auto start_offset = result.serializer.blob.size;
+		idx_t uncompressed_size = 0;
+		if (encoded.encoding == Encoding::RLE_DICTIONARY) {
+			// the dictionary page precedes the data page
+			PageHeader dictionary_hdr;
+			dictionary_hdr.type = PageType::DICTIONARY_PAGE;
+			dictionary_hdr.__isset.dictionary_page_header = true;
+			dictionary_hdr.dictionary_page_header.num_values = encoded.dictionary_size;
+			dictionary_hdr.dictionary_page_header.encoding = Encoding::PLAIN;
+			uncompressed_size +=
+			    WritePage(codec, dictionary_hdr, encoded.dictionary, *row_group_protocol, result.serializer);
+			meta_data.__isset.dictionary_page_offset = true;
+			meta_data.dictionary_page_offset = start_offset;
+		}
 
 		// set up some metadata
 		PageHeader hdr;
-		hdr.compressed_page_size = 0;
-		hdr.uncompressed_page_size = 0;
 		hdr.type = PageType::DATA_PAGE;
 		hdr.__isset.data_page_header = true;
 
 		hdr.data_page_header.num_values = buffer.Count();
-		hdr.data_page_header.encoding = Encoding::PLAIN;
+		hdr.data_page_header.encoding = encoded.encoding;
 		hdr.data_page_header.definition_level_encoding = Encoding::RLE;
 		hdr.data_page_header.repetition_level_encoding = Encoding::BIT_PACKED;
 
-		// record the current offset of the writer into the file
-		// this is the starting position of the current page
-		auto start_offset = writer->GetTotalWritten();
-
-		// write the definition levels (i.e. the inverse of the nullmask)
-		// we always bit pack everything
-
-		// first figure out how many bytes we need (1 byte per 8 rows, rounded up)
-		auto define_byte_count = (buffer.Count() + 7) / 8;
-		// we need to set up the count as a varint, plus an added marker for the RLE scheme
-		// for this marker we shift the count left 1 and set low bit to 1 to indicate bit packed literals
-		uint32_t define_header = (define_byte_count << 1) | 1;
-		uint32_t define_size = GetVarintSize(define_header) + define_byte_count;
-
-		// we write the actual definitions into the temp_writer for now
-		temp_writer.Write<uint32_t>(define_size);
-		VarintEncode(define_header, temp_writer);
-
-		for (auto &chunk : buffer.Chunks()) {
-			auto &validity = FlatVector::Validity(chunk->data[i]);
-			auto validity_data = validity.GetData();
-			auto chunk_define_byte_count = (chunk->size() + 7) / 8;
-			if (!validity_data) {
-				ValidityMask nop_mask(chunk->size());
-				temp_writer.WriteData((const_data_ptr_t)nop_mask.GetData(), chunk_define_byte_count);
-			} else {
-				// write the bits of the nullmask
-				temp_writer.WriteData((const_data_ptr_t)validity_data, chunk_define_byte_count);
-			}
-		}
-
-		// now write the actual payload: we write this as PLAIN values (for now? possibly for ever?)
-		for (auto &chunk : buffer.Chunks()) {
-			auto &input = *chunk;
-			auto &input_column = input.data[i];
-			auto &mask = FlatVector::Validity(input_column);
-
-			// write actual payload data
-			switch (sql_types[i].id()) {
-			case LogicalTypeId::BOOLEAN: {
-				auto *ptr = FlatVector::GetData<bool>(input_column);
-				uint8_t byte = 0;
-				uint8_t byte_pos = 0;
-				for (idx_t r = 0; r < input.size(); r++) {
-					if (mask.RowIsValid(r)) { // only encode if non-null
-						byte |= (ptr[r] & 1) << byte_pos;
-						byte_pos++;
-
-						temp_writer.Write<uint8_t>(byte);
-						if (byte_pos == 8) {
-							temp_writer.Write<uint8_t>(byte);
-							byte = 0;
-							byte_pos = 0;
-						}
-					}
-				}
-				// flush last byte if req
-				if (byte_pos > 0) {
-					temp_writer.Write<uint8_t>(byte);
-				}
-				break;
-			}
-			case LogicalTypeId::TINYINT:
-				TemplatedWritePlain<int8_t, int32_t>(input_column, input.size(), mask, temp_writer);
-				break;
-			case LogicalTypeId::SMALLINT:
-				TemplatedWritePlain<int16_t, int32_t>(input_column, input.size(), mask, temp_writer);
-				break;
-			case LogicalTypeId::INTEGER:
-				TemplatedWritePlain<int32_t, int32_t>(input_column, input.size(), mask, temp_writer);
-				break;
-			case LogicalTypeId::BIGINT:
-				TemplatedWritePlain<int64_t, int64_t>(input_column, input.size(), mask, temp_writer);
-				break;
-			case LogicalTypeId::FLOAT:
-				TemplatedWritePlain<float, float>(input_column, input.size(), mask, temp_writer);
-				break;
-			case LogicalTypeId::DECIMAL: {
-				// FIXME: fixed length byte array...
-				Vector double_vec(LogicalType::DOUBLE);
-				VectorOperations::Cast(input_column, double_vec, input.size());
-				TemplatedWritePlain<double, double>(double_vec, input.size(), mask, temp_writer);
-				break;
-			}
-			case LogicalTypeId::DOUBLE:
-				TemplatedWritePlain<double, double>(input_column, input.size(), mask, temp_writer);
-				break;
-			case LogicalTypeId::DATE: {
-				auto *ptr = FlatVector::GetData<date_t>(input_column);
-				for (idx_t r = 0; r < input.size(); r++) {
-					if (mask.RowIsValid(r)) {
-						auto ts = Timestamp::FromDatetime(ptr[r], dtime_t(0));
-						temp_writer.Write<Int96>(TimestampToImpalaTimestamp(ts));
-					}
-				}
-				break;
-			}
-			case LogicalTypeId::TIMESTAMP: {
-				auto *ptr = FlatVector::GetData<timestamp_t>(input_column);
-				for (idx_t r = 0; r < input.size(); r++) {
-					if (mask.RowIsValid(r)) {
-						temp_writer.Write<Int96>(TimestampToImpalaTimestamp(ptr[r]));
-					}
-				}
-				break;
-			}
-			case LogicalTypeId::BLOB:
-			case LogicalTypeId::VARCHAR: {
-				auto *ptr = FlatVector::GetData<string_t>(input_column);
-				for (idx_t r = 0; r < input.size(); r++) {
-					if (mask.RowIsValid(r)) {
-						temp_writer.Write<uint32_t>(ptr[r].GetSize());
-						temp_writer.WriteData((const_data_ptr_t)ptr[r].GetDataUnsafe(), ptr[r].GetSize());
-					}
-				}
-				break;
-			}
-			default:
-				throw NotImplementedException((sql_types[i].ToString()));
-			}
-		}
+		meta_data.data_page_offset = result.serializer.blob.size;
+		uncompressed_size += WritePage(codec, hdr, temp_writer, *row_group_protocol, result.serializer);
 
-		// now that we have finished writing the data we know the uncompressed size
-		hdr.uncompressed_page_size = temp_writer.blob.size;
-
-		// compress the data based
-		size_t compressed_size;
-		data_ptr_t compressed_data;
-		unique_ptr<data_t[]> compressed_buf;
-		switch (codec) {
-		case CompressionCodec::UNCOMPRESSED:
-			compressed_size = temp_writer.blob.size;
-			compressed_data = temp_writer.blob.data.get();
-			break;
-		case CompressionCodec::SNAPPY: {
-			compressed_size = snappy::MaxCompressedLength(temp_writer.blob.size);
-			compressed_buf = unique_ptr<data_t[]>(new data_t[compressed_size]);
-			snappy::RawCompress((const char *)temp_writer.blob.data.get(), temp_writer.blob.size,
-			                    (char *)compressed_buf.get(), &compressed_size);
-			compressed_data = compressed_buf.get();
-			break;
-		}
-		case CompressionCodec::GZIP: {
-			MiniZStream s;
-			compressed_size = s.MaxCompressedLength(temp_writer.blob.size);
-			compressed_buf = unique_ptr<data_t[]>(new data_t[compressed_size]);
-			s.Compress((const char *)temp_writer.blob.data.get(), temp_writer.blob.size, (char *)compressed_buf.get(),
-			           &compressed_size);
-			compressed_data = compressed_buf.get();
-			break;
-		}
-		case CompressionCodec::ZSTD: {
-			compressed_size = duckdb_zstd::ZSTD_compressBound(temp_writer.blob.size);
-			compressed_buf = unique_ptr<data_t[]>(new data_t[compressed_size]);
-			compressed_size = duckdb_zstd::ZSTD_compress((void *)compressed_buf.get(), compressed_size,
-			                                             (const void *)temp_writer.blob.data.get(),
-			                                             temp_writer.blob.size, ZSTD_CLEVEL_DEFAULT);
-			compressed_data = compressed_buf.get();
-			break;
-		}
-		default:
-			throw InternalException("Unsupported codec for Parquet Writer");
+		meta_data.total_compressed_size = result.serializer.blob.size - start_offset;
+		meta_data.total_uncompressed_size = uncompressed_size;
+		meta_data.codec = codec;
+		meta_data.encodings.push_back(Encoding::RLE);
+		if (encoded.encoding == Encoding::RLE_DICTIONARY) {
+			// the dictionary page is plain encoded
+			meta_data.encodings.push_back(Encoding::PLAIN);
 		}
+		meta_data.encodings.push_back(encoded.encoding);
+		meta_data.path_in_schema.push_back(file_meta_data.schema[i + 1].name);
+		meta_data.num_values = buffer.Count();
+		meta_data.type = file_meta_data.schema[i + 1].type;
+		meta_data.__isset.statistics = true;
+		meta_data.statistics = encoded.statistics;
+		row_group.total_byte_size += uncompressed_size;
+	}
+	row_group.num_rows += buffer.Count();
+}
 
-		hdr.compressed_page_size = compressed_size;
-		// now finally write the data to the actual file
-		hdr.write(protocol.get());
-		writer->WriteData(compressed_data, compressed_size);
+void ParquetWriter::FlushRowGroup(PreparedRowGroup &prepared) {
+	lock_guard<mutex> glock(lock);
 
-		auto &column_chunk = row_group.columns[i];
-		column_chunk.__isset.meta_data = true;
-		column_chunk.meta_data.data_page_offset = start_offset;
-		column_chunk.meta_data.total_compressed_size = writer->GetTotalWritten() - start_offset;
-		column_chunk.meta_data.codec = codec;
-		column_chunk.meta_data.path_in_schema.push_back(file_meta_data.schema[i + 1].name);
-		column_chunk.meta_data.num_values = buffer.Count();
-		column_chunk.meta_data.type = file_meta_data.schema[i + 1].type;
+	// the offsets of the row group are relative to its start: move them to the current position in the file
+	auto &row_group = prepared.row_group;
+	auto row_group_offset = writer->GetTotalWritten();
+	row_group.file_offset += row_group_offset;
+	for (auto &column_chunk : row_group.columns) {
+		column_chunk.meta_data.data_page_offset += row_group_offset;
+		if (column_chunk.meta_data.__isset.dictionary_page_offset) {
+			column_chunk.meta_data.dictionary_page_offset += row_group_offset;
+		}
 	}
-	row_group.num_rows += buffer.Count();
+	writer->WriteData(prepared.serializer.blob.data.get(), prepared.serializer.blob.size);
 
 	// append the row group to the file meta data
-	file_meta_data.row_groups.push_back(row_group);
-	file_meta_data.num_rows += buffer.Count();
+	file_meta_data.num_rows += row_group.num_rows;
+	file_meta_data.row_groups.push_back(move(row_group));
+}
+
+void ParquetWriter::Flush(ChunkCollection &buffer) {
+	if (buffer.Count() == 0) {
+		return;
+	}
+	PreparedRowGroup prepared;
+	PrepareRowGroup(buffer, prepared);
+	FlushRowGroup(prepared);
 }
 
 void ParquetWriter::Finalize() {
@@ -1,6 +1,6 @@
 # use bison to generate the parser files
 # the following version of bison is used:
-# bison (GNU Bison) 2.3
+# bison (GNU Bison) 3.8.2
 import os
 import subprocess
 import re
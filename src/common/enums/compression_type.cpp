@@ -0,0 +1,22 @@
+#include "duckdb/common/enums/compression_type.hpp"
+
+namespace duckdb {
+
+string CompressionTypeToString(CompressionType type) {
+	switch (type) {
+	case CompressionType::COMPRESSION_UNCOMPRESSED:
+		return "Uncompressed";
+	case CompressionType::COMPRESSION_CONSTANT:
+		return "Constant";
+	case CompressionType::COMPRESSION_RLE:
+		return "RLE";
+	case CompressionType::COMPRESSION_BITPACKING:
+		return "BitPacking";
+	case CompressionType::COMPRESSION_DICTIONARY:
+		return "Dictionary";
+	default:
+		return "INVALID";
+	}
+}
+
+} // namespace duckdb
@@ -23,6 +23,8 @@ string LogicalOperatorToString(LogicalOperatorType type) {
 		return "COMPARISON_JOIN";
 	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
 		return "DELIM_JOIN";
+	case LogicalOperatorType::LOGICAL_ASOF_JOIN:
+		return "ASOF_JOIN";
 	case LogicalOperatorType::LOGICAL_PROJECTION:
 		return "PROJECTION";
 	case LogicalOperatorType::LOGICAL_FILTER:
@@ -0,0 +1,235 @@
+#include "duckdb/common/numa.hpp"
+
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/to_string.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <iterator>
+
+#ifdef __linux__
+#include <dirent.h>
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+#ifdef __linux__
+// from <linux/mempolicy.h>, we call mbind directly so we do not need to link libnuma
+static constexpr int NUMA_MPOL_PREFERRED = 1;
+static constexpr unsigned NUMA_MPOL_MF_MOVE = 1 << 1;
+
+//! Parses a CPU or node number, returns false if the text is not a (reasonably sized) number
+static bool ParseNumber(const string &text, idx_t &result) {
+	if (text.empty() || text.size() > 9 || !std::all_of(text.begin(), text.end(), ::isdigit)) {
+		return false;
+	}
+	result = 0;
+	for (auto c : text) {
+		result = result * 10 + idx_t(c - '0');
+	}
+	return true;
+}
+
+//! Parses a list of CPUs in the kernel format, e.g. "0-3,8,10-11", returns false if the list is malformed
+static bool ParseCpuList(const string &list, vector<idx_t> &result) {
+	if (list.empty()) {
+		return true;
+	}
+	for (auto &range : StringUtil::Split(list, ',')) {
+		auto bounds = StringUtil::Split(range, '-');
+		idx_t start, end;
+		if (bounds.empty() || bounds.size() > 2 || !ParseNumber(bounds[0], start)) {
+			return false;
+		}
+		if (bounds.size() == 1) {
+			end = start;
+		} else if (!ParseNumber(bounds[1], end) || end < start || end >= CPU_SETSIZE) {
+			return false;
+		}
+		for (idx_t cpu = start; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return true;
+}
+
+//! Detects the CPUs of every node from sysfs, only keeping the CPUs the process is allowed to run on. Returns false if
+//! the topology is not available or could not be parsed.
+static bool DetectNodes(const vector<idx_t> &process_cpus, vector<vector<idx_t>> &node_cpus,
+                        vector<idx_t> &node_ids) {
+	auto dir = opendir("/sys/devices/system/node");
+	if (!dir) {
+		return false;
+	}
+	vector<idx_t> kernel_node_ids;
+	bool success = true;
+	struct dirent *entry;
+	while ((entry = readdir(dir)) != nullptr) {
+		string name = entry->d_name;
+		if (name.size() <= 4 || !StringUtil::StartsWith(name, "node")) {
+			continue;
+		}
+		idx_t node_id;
+		if (!ParseNumber(name.substr(4), node_id)) {
+			success = false;
+			break;
+		}
+		kernel_node_ids.push_back(node_id);
+	}
+	closedir(dir);
+	if (!success) {
+		return false;
+	}
+	std::sort(kernel_node_ids.begin(), kernel_node_ids.end());
+	for (auto node_id : kernel_node_ids) {
+		std::ifstream cpulist("/sys/devices/system/node/node" + to_string(node_id) + "/cpulist");
+		string list;
+		if (!std::getline(cpulist, list)) {
+			return false;
+		}
+		vector<idx_t> cpus;
+		if (!ParseCpuList(StringUtil::Replace(list, "\n", ""), cpus)) {
+			return false;
+		}
+		std::sort(cpus.begin(), cpus.end());
+		if (!process_cpus.empty()) {
+			// threads can only be pinned to the CPUs the process is allowed to run on
+			vector<idx_t> allowed_cpus;
+			std::set_intersection(cpus.begin(), cpus.end(), process_cpus.begin(), process_cpus.end(),
+			                      std::back_inserter(allowed_cpus));
+			cpus = move(allowed_cpus);
+		}
+		if (cpus.empty()) {
+			// memory-only node, or a node the process may not run on
+			continue;
+		}
+		node_cpus.push_back(move(cpus));
+		node_ids.push_back(node_id);
+	}
+	return !node_cpus.empty();
+}
+#endif
+
+NumaTopology::NumaTopology() {
+#ifdef __linux__
+	// the topology is detected before any thread is pinned, so this is the affinity the process was started with
+	cpu_set_t process_set;
+	CPU_ZERO(&process_set);
+	if (sched_getaffinity(0, sizeof(cpu_set_t), &process_set) == 0) {
+		for (idx_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+			if (CPU_ISSET(cpu, &process_set)) {
+				process_cpus.push_back(cpu);
+			}
+		}
+	}
+	if (!DetectNodes(process_cpus, node_cpus, node_ids)) {
+		node_cpus.clear();
+		node_ids.clear();
+	}
+	for (idx_t node = 0; node < node_cpus.size(); node++) {
+		for (auto cpu : node_cpus[node]) {
+			if (cpu >= cpu_node.size()) {
+				cpu_node.resize(cpu + 1, node);
+			}
+			cpu_node[cpu] = node;
+		}
+	}
+#endif
+	if (node_cpus.empty()) {
+		// could not detect the topology: treat the machine as a single node
+		vector<idx_t> cpus = process_cpus;
+		if (cpus.empty()) {
+			idx_t cpu_count = MaxValue<idx_t>(std::thread::hardware_concurrency(), 1);
+			for (idx_t cpu = 0; cpu < cpu_count; cpu++) {
+				cpus.push_back(cpu);
+			}
+		}
+		cpu_node.clear();
+		cpu_node.resize(cpus.back() + 1, 0);
+		node_cpus.push_back(move(cpus));
+		node_ids.push_back(0);
+	}
+}
+
+const NumaTopology &NumaTopology::Get() {
+	static NumaTopology topology;
+	return topology;
+}
+
+idx_t NumaTopology::GetCurrentNode() const {
+#ifdef __linux__
+	auto cpu = sched_getcpu();
+	if (cpu >= 0 && idx_t(cpu) < cpu_node.size()) {
+		return cpu_node[cpu];
+	}
+#endif
+	return 0;
+}
+
+bool NumaTopology::PinThread(std::thread &thread, idx_t cpu) {
+#ifdef __linux__
+	if (cpu >= CPU_SETSIZE) {
+		return false;
+	}
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	CPU_SET(cpu, &cpu_set);
+	return pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set) == 0;
+#else
+	return false;
+#endif
+}
+
+void NumaTopology::UnpinThread(std::thread &thread) {
+#ifdef __linux__
+	auto &topology = Get();
+	cpu_set_t cpu_set;
+	CPU_ZERO(&cpu_set);
+	if (!topology.process_cpus.empty()) {
+		for (auto cpu : topology.process_cpus) {
+			CPU_SET(cpu, &cpu_set);
+		}
+	} else {
+		// the original affinity is unknown: allow every CPU of the machine
+		for (auto &cpus : topology.node_cpus) {
+			for (auto cpu : cpus) {
+				if (cpu < CPU_SETSIZE) {
+					CPU_SET(cpu, &cpu_set);
+				}
+			}
+		}
+	}
+	pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpu_set);
+#endif
+}
+
+void NumaTopology::PlaceMemory(data_ptr_t pointer, idx_t size, idx_t node) {
+#if defined(__linux__) && defined(SYS_mbind)
+	auto &topology = Get();
+	if (topology.NodeCount() <= 1 || node >= topology.NodeCount()) {
+		return;
+	}
+	auto node_id = topology.node_ids[node];
+	if (node_id >= sizeof(unsigned long) * 8) {
+		return;
+	}
+	// mbind only works on whole pages: only place the pages that are fully contained in the region
+	auto page_size = (uint64_t)sysconf(_SC_PAGESIZE);
+	auto start = ((uint64_t)pointer + page_size - 1) / page_size * page_size;
+	auto end = ((uint64_t)pointer + size) / page_size * page_size;
+	if (end <= start) {
+		return;
+	}
+	unsigned long node_mask = 1UL << node_id;
+	// failure to place the memory is not an error: the memory is simply not node-local
+	syscall(SYS_mbind, (void *)start, end - start, NUMA_MPOL_PREFERRED, &node_mask, sizeof(node_mask) * 8 + 1,
+	        NUMA_MPOL_MF_MOVE);
+#endif
+}
+
+} // namespace duckdb
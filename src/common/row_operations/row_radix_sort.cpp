@@ -0,0 +1,47 @@
+//===--------------------------------------------------------------------===//
+// row_radix_sort.cpp
+// Description: This file contains the implementation of the radix sort of rows
+//===--------------------------------------------------------------------===//
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+//! Textbook LSD radix sort
+void RowOperations::RadixSort(BufferManager &buffer_manager, data_ptr_t dataptr, const idx_t &count,
+                              const idx_t &col_offset, const idx_t &sorting_size, const idx_t &entry_size) {
+	auto temp_block = buffer_manager.Allocate(MaxValue(count * entry_size, (idx_t)Storage::BLOCK_ALLOC_SIZE));
+	data_ptr_t temp = temp_block->Ptr();
+	bool swap = false;
+
+	idx_t counts[256];
+	uint8_t byte;
+	for (idx_t offset = col_offset + sorting_size - 1; offset + 1 > col_offset; offset--) {
+		// init to 0
+		memset(counts, 0, sizeof(counts));
+		// collect counts
+		for (idx_t i = 0; i < count; i++) {
+			byte = *(dataptr + i * entry_size + offset);
+			counts[byte]++;
+		}
+		// compute offsets from counts
+		for (idx_t val = 1; val < 256; val++) {
+			counts[val] = counts[val] + counts[val - 1];
+		}
+		// re-order the data in temporary array
+		for (idx_t i = count; i > 0; i--) {
+			byte = *(dataptr + (i - 1) * entry_size + offset);
+			memcpy(temp + (counts[byte] - 1) * entry_size, dataptr + (i - 1) * entry_size, entry_size);
+			counts[byte]--;
+		}
+		std::swap(dataptr, temp);
+		swap = !swap;
+	}
+	// move data back to original buffer (if it was swapped)
+	if (swap) {
+		memcpy(temp, dataptr, count * entry_size);
+	}
+}
+
+} // namespace duckdb
@@ -0,0 +1,103 @@
+#include "duckdb/common/types/buffered_chunk_collection.hpp"
+
+#include "duckdb/common/serializer/buffered_deserializer.hpp"
+#include "duckdb/common/serializer/buffered_serializer.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+BufferedChunkScanState::BufferedChunkScanState() : block_idx(0), position(0) {
+}
+
+BufferedChunkScanState::~BufferedChunkScanState() {
+}
+
+BufferedChunkCollection::BufferedChunkCollection(BufferManager &buffer_manager)
+    : buffer_manager(buffer_manager), count(0), size_in_bytes(0) {
+}
+
+BufferedChunkCollection::~BufferedChunkCollection() {
+}
+
+void BufferedChunkCollection::Append(DataChunk &chunk) {
+	if (chunk.size() == 0) {
+		return;
+	}
+	// serialize the chunk before grabbing the lock
+	BufferedSerializer serializer;
+	chunk.Serialize(serializer);
+	auto data = serializer.blob.data.get();
+	auto data_size = serializer.blob.size;
+	// every chunk is prefixed with its size
+	idx_t entry_size = sizeof(uint32_t) + data_size;
+
+	lock_guard<mutex> guard(lock);
+	unique_ptr<BufferHandle> handle;
+	if (blocks.empty() || blocks.back().size + entry_size > blocks.back().capacity) {
+		// the chunk does not fit in the last block: start a new block (which is bigger than usual for huge chunks)
+		BufferedChunkBlock new_block;
+		auto alloc_size = MaxValue<idx_t>(Storage::BLOCK_ALLOC_SIZE, entry_size + Storage::BLOCK_HEADER_SIZE);
+		new_block.block = buffer_manager.RegisterMemory(alloc_size, false);
+		handle = buffer_manager.Pin(new_block.block);
+		new_block.capacity = handle->node->size;
+		new_block.size = 0;
+		blocks.push_back(move(new_block));
+	} else {
+		handle = buffer_manager.Pin(blocks.back().block);
+	}
+	auto &block = blocks.back();
+	D_ASSERT(block.size + entry_size <= block.capacity);
+	auto target = handle->node->buffer + block.size;
+	Store<uint32_t>(data_size, target);
+	memcpy(target + sizeof(uint32_t), data, data_size);
+	block.size += entry_size;
+	count += chunk.size();
+	size_in_bytes += entry_size;
+}
+
+bool BufferedChunkCollection::Scan(BufferedChunkScanState &state, DataChunk &result) {
+	result.Destroy();
+	while (state.block_idx < blocks.size()) {
+		auto &block = blocks[state.block_idx];
+		if (state.position >= block.size) {
+			// finished this block: move to the next one
+			state.handle.reset();
+			state.block_idx++;
+			state.position = 0;
+			continue;
+		}
+		if (!state.handle) {
+			state.handle = buffer_manager.Pin(block.block);
+		}
+		auto source = state.handle->node->buffer + state.position;
+		auto data_size = Load<uint32_t>(source);
+		BufferedDeserializer deserializer(source + sizeof(uint32_t), data_size);
+		result.Deserialize(deserializer);
+		state.position += sizeof(uint32_t) + data_size;
+		return true;
+	}
+	state.handle.reset();
+	return false;
+}
+
+void BufferedChunkCollection::Merge(BufferedChunkCollection &other) {
+	lock_guard<mutex> guard(lock);
+	lock_guard<mutex> other_guard(other.lock);
+	for (auto &block : other.blocks) {
+		blocks.push_back(move(block));
+	}
+	count += other.count;
+	size_in_bytes += other.size_in_bytes;
+	other.blocks.clear();
+	other.count = 0;
+	other.size_in_bytes = 0;
+}
+
+void BufferedChunkCollection::Clear() {
+	lock_guard<mutex> guard(lock);
+	blocks.clear();
+	count = 0;
+	size_in_bytes = 0;
+}
+
+} // namespace duckdb
@@ -595,9 +595,24 @@ idx_t ChunkCollection::MaterializeHeapChunk(DataChunk &target, idx_t order[], id
 		case PhysicalType::DOUBLE:
 			TemplatedSetValues<double>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
 			break;
+		case PhysicalType::UINT8:
+			TemplatedSetValues<uint8_t>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
+			break;
+		case PhysicalType::UINT16:
+			TemplatedSetValues<uint16_t>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
+			break;
+		case PhysicalType::UINT32:
+			TemplatedSetValues<uint32_t>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
+			break;
+		case PhysicalType::UINT64:
+			TemplatedSetValues<uint64_t>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
+			break;
 		case PhysicalType::VARCHAR:
 			TemplatedSetValues<string_t>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
 			break;
+		case PhysicalType::INTERVAL:
+			TemplatedSetValues<interval_t>(this, target.data[col_idx], order, col_idx, start_offset, remaining_data);
+			break;
 		// TODO this is ugly and sloooow!
 		case PhysicalType::STRUCT:
 		case PhysicalType::LIST: {
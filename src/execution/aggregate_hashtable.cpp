@@ -2,6 +2,7 @@
 
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/types/buffered_chunk_collection.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/row_data_collection.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
@@ -640,6 +641,113 @@ void GroupedAggregateHashTable::Partition(vector<GroupedAggregateHashTable *> &p
 	D_ASSERT(total_count == entries);
 }
 
+void GroupedAggregateHashTable::FlushSerialize(Vector &source_addresses, idx_t count, DataChunk &chunk,
+                                               BufferedChunkCollection &target) {
+	chunk.Reset();
+	chunk.SetCardinality(count);
+	// the group columns (ignoring the final hash column, it is recomputed when the states are read back)
+	const auto group_cols = layout.ColumnCount() - 1;
+	for (idx_t i = 0; i < group_cols; i++) {
+		auto &column = chunk.data[i];
+		const auto col_offset = layout.GetOffsets()[i];
+		RowOperations::Gather(source_addresses, FlatVector::INCREMENTAL_SELECTION_VECTOR, column,
+		                      FlatVector::INCREMENTAL_SELECTION_VECTOR, count, col_offset, i);
+	}
+	// the aggregate states are copied as-is into a blob
+	auto &states = chunk.data[group_cols];
+	auto states_data = FlatVector::GetData<string_t>(states);
+	auto addresses_ptr = FlatVector::GetData<data_ptr_t>(source_addresses);
+	for (idx_t i = 0; i < count; i++) {
+		auto state_ptr = (const char *)addresses_ptr[i] + layout.GetAggrOffset();
+		states_data[i] = StringVector::AddStringOrBlob(states, string_t(state_ptr, layout.GetAggrWidth()));
+	}
+	target.Append(chunk);
+}
+
+void GroupedAggregateHashTable::SerializeStates(BufferedChunkCollection &target) {
+	if (entries == 0) {
+		return;
+	}
+	for (auto &aggr : layout.GetAggregates()) {
+		if (aggr.function.destructor) {
+			throw InternalException("Cannot serialize aggregate states that have a destructor");
+		}
+	}
+	vector<LogicalType> chunk_types(layout.GetTypes().begin(), layout.GetTypes().end() - 1);
+	chunk_types.push_back(LogicalType::BLOB);
+	DataChunk chunk;
+	chunk.Initialize(chunk_types);
+
+	Vector addresses(LogicalType::POINTER);
+	auto addresses_ptr = FlatVector::GetData<data_ptr_t>(addresses);
+	idx_t count = 0;
+	PayloadApply([&](idx_t page_nr, idx_t page_offset, data_ptr_t ptr) {
+		addresses_ptr[count++] = ptr;
+		if (count == STANDARD_VECTOR_SIZE) {
+			FlushSerialize(addresses, count, chunk, target);
+			count = 0;
+		}
+	});
+	if (count > 0) {
+		FlushSerialize(addresses, count, chunk, target);
+	}
+}
+
+void GroupedAggregateHashTable::CombineSerialized(BufferedChunkCollection &source) {
+	D_ASSERT(!is_finalized);
+
+	const auto group_cols = layout.ColumnCount() - 1;
+	const auto aggr_offset = layout.GetAggrOffset();
+	const auto aggr_width = layout.GetAggrWidth();
+	// the states are copied into (aligned) rows before they are combined
+	auto rows = unique_ptr<data_t[]>(new data_t[STANDARD_VECTOR_SIZE * tuple_size]);
+	Vector source_addresses(LogicalType::POINTER);
+	auto source_addresses_ptr = FlatVector::GetData<data_ptr_t>(source_addresses);
+
+	DataChunk groups;
+	groups.InitializeEmpty(vector<LogicalType>(layout.GetTypes().begin(), layout.GetTypes().end() - 1));
+	Vector hashes(LogicalType::HASH);
+	Vector group_addresses(LogicalType::POINTER);
+	SelectionVector new_groups_sel(STANDARD_VECTOR_SIZE);
+
+	BufferedChunkScanState scan_state;
+	DataChunk chunk;
+	while (source.Scan(scan_state, chunk)) {
+		const idx_t count = chunk.size();
+		VectorData states;
+		chunk.data[group_cols].Orrify(count, states);
+		auto states_data = (string_t *)states.data;
+		for (idx_t i = 0; i < count; i++) {
+			auto &state = states_data[states.sel->get_index(i)];
+			D_ASSERT(state.GetSize() == aggr_width);
+			source_addresses_ptr[i] = rows.get() + i * tuple_size;
+			memcpy(source_addresses_ptr[i] + aggr_offset, state.GetDataUnsafe(), aggr_width);
+		}
+
+		for (idx_t i = 0; i < group_cols; i++) {
+			groups.data[i].Reference(chunk.data[i]);
+		}
+		groups.SetCardinality(count);
+		groups.Hash(hashes);
+
+		FindOrCreateGroups(groups, hashes, group_addresses, new_groups_sel);
+		RowOperations::CombineStates(layout, source_addresses, group_addresses, count);
+	}
+	Verify();
+}
+
+idx_t GroupedAggregateHashTable::SizeInBytes() {
+	idx_t size_in_bytes = payload_hds.size() * Storage::BLOCK_ALLOC_SIZE;
+	if (hashes_hdl) {
+		idx_t entry_size = entry_type == HtEntryType::HT_WIDTH_64 ? sizeof(aggr_ht_entry_64) : sizeof(aggr_ht_entry_32);
+		size_in_bytes += MaxValue<idx_t>(capacity * entry_size, Storage::BLOCK_ALLOC_SIZE);
+	}
+	for (auto &block : string_heap->blocks) {
+		size_in_bytes += block.capacity * block.entry_size;
+	}
+	return size_in_bytes;
+}
+
 idx_t GroupedAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
 
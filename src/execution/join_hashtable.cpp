@@ -17,7 +17,9 @@ using ScanStructure = JoinHashTable::ScanStructure;
 JoinHashTable::JoinHashTable(BufferManager &buffer_manager, vector<JoinCondition> &conditions,
                              vector<LogicalType> btypes, JoinType type)
     : buffer_manager(buffer_manager), build_types(move(btypes)), entry_size(0), tuple_size(0),
-      vfound(Value::BOOLEAN(false)), join_type(type), finalized(false), has_null(false), count(0) {
+      vfound(Value::BOOLEAN(false)), join_type(type), finalized(false), has_null(false), build_bloom_filter(false),
+      count(0), heap_size(0), memory_budget(INVALID_INDEX), external(false), total_count(0), partition_start(0),
+      partition_end(0), probe_partition(0) {
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
 		auto type = condition.left->return_type;
@@ -179,6 +181,37 @@ void JoinHashTable::Build(DataChunk &keys, DataChunk &payload) {
 		info.correlated_counts->AddChunk(info.group_chunk, info.correlated_payload);
 	}
 
+	if (external) {
+		// the HT is partitioned: append the rows to the build partitions
+		unique_ptr<VectorData[]> key_data;
+		const SelectionVector *current_sel;
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		if (PrepareKeys(keys, key_data, current_sel, sel, true) < keys.size()) {
+			has_null = true;
+		}
+		auto types = keys.GetTypes();
+		for (idx_t i = 0; i < payload.ColumnCount(); i++) {
+			types.push_back(payload.data[i].GetType());
+		}
+		DataChunk input;
+		input.InitializeEmpty(types);
+		for (idx_t i = 0; i < keys.ColumnCount(); i++) {
+			input.data[i].Reference(keys.data[i]);
+		}
+		for (idx_t i = 0; i < payload.ColumnCount(); i++) {
+			input.data[keys.ColumnCount() + i].Reference(payload.data[i]);
+		}
+		input.SetCardinality(keys);
+
+		Vector hashes(LogicalType::HASH);
+		Hash(keys, FlatVector::INCREMENTAL_SELECTION_VECTOR, keys.size(), hashes);
+		PartitionChunk(input, hashes, build_partitions, nullptr);
+		return;
+	}
+	Insert(keys, payload);
+}
+
+void JoinHashTable::Insert(DataChunk &keys, DataChunk &payload) {
 	// prepare the keys for processing
 	unique_ptr<VectorData[]> key_data;
 	const SelectionVector *current_sel;
@@ -285,9 +318,42 @@ void JoinHashTable::Build(DataChunk &keys, DataChunk &payload) {
 
 	RowOperations::Scatter(source_chunk, source_data.data(), layout, addresses, *string_heap, *current_sel,
 	                       added_count);
+
+	lock_guard<mutex> append_lock(ht_lock);
+	PinHeapBlocks();
+	if (!external && correlated_mark_join_info.correlated_types.empty() && SizeInBytes() > memory_budget) {
+		// the HT has grown beyond its budget: partition the rest of the build side
+		InitializePartitions();
+	}
 }
 
-void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[]) {
+void JoinHashTable::InitializePartitions() {
+	// the partitions are created before the flag is set, so the other threads can append to them right away
+	for (idx_t i = 0; i < PARTITION_COUNT; i++) {
+		build_partitions.push_back(make_unique<BufferedChunkCollection>(buffer_manager));
+		probe_partitions.push_back(make_unique<BufferedChunkCollection>(buffer_manager));
+	}
+	partition_resident.resize(PARTITION_COUNT, false);
+	external = true;
+}
+
+void JoinHashTable::PinHeapBlocks() {
+	// the rows point into the blocks of the string heap: if such a block were evicted, it would be loaded at another
+	// address, so the blocks are kept pinned until the rows are released
+	lock_guard<mutex> heap_lock(string_heap->rc_lock);
+	for (idx_t i = heap_handles.size(); i < string_heap->blocks.size(); i++) {
+		auto &block = string_heap->blocks[i];
+		heap_handles.push_back(buffer_manager.Pin(block.block));
+		heap_size += block.capacity * block.entry_size;
+	}
+}
+
+idx_t JoinHashTable::SizeInBytes() {
+	idx_t hash_map_size = NextPowerOfTwo(count * 2) * sizeof(data_ptr_t);
+	return blocks.size() * block_capacity * entry_size + heap_size + hash_map_size;
+}
+
+void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel) {
 	D_ASSERT(hashes.GetType().id() == LogicalTypeId::HASH);
 
 	// use bitmask to get position in array
@@ -296,8 +362,20 @@ void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_loc
 	hashes.Normalify(count);
 
 	D_ASSERT(hashes.GetVectorType() == VectorType::FLAT_VECTOR);
-	auto pointers = (data_ptr_t *)hash_map->node->buffer;
 	auto indices = FlatVector::GetData<hash_t>(hashes);
+	if (parallel) {
+		// other threads are inserting into the same HT: swap in the pointer to the current tuple atomically
+		auto pointers = (atomic<data_ptr_t> *)hash_map->node->buffer;
+		for (idx_t i = 0; i < count; i++) {
+			auto &pointer = pointers[indices[i]];
+			data_ptr_t head = pointer.load();
+			do {
+				Store<data_ptr_t>(head, key_locations[i] + pointer_offset);
+			} while (!pointer.compare_exchange_weak(head, key_locations[i]));
+		}
+		return;
+	}
+	auto pointers = (data_ptr_t *)hash_map->node->buffer;
 	for (idx_t i = 0; i < count; i++) {
 		auto index = indices[i];
 		// set prev in current key to the value (NOTE: this will be nullptr if
@@ -310,6 +388,30 @@ void JoinHashTable::InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_loc
 }
 
 void JoinHashTable::Finalize() {
+	if (!external) {
+		ConstructHashMap();
+		return;
+	}
+	// the HT is partitioned: the rows that were added before the HT was partitioned are partitioned as well
+	PartitionRows();
+	total_count = 0;
+	for (auto &partition : build_partitions) {
+		total_count += partition->Count();
+	}
+	// now fill the HT with the first group of partitions, the probe side can probe these right away
+	PrepareNextPartitions();
+	for (idx_t i = partition_start; i < partition_end; i++) {
+		partition_resident[i] = true;
+	}
+}
+
+void JoinHashTable::ConstructHashMap() {
+	InitializeHashMap();
+	InsertBlocks(0, blocks.size(), false);
+	finalized = true;
+}
+
+void JoinHashTable::InitializeHashMap() {
 	// the build has finished, now iterate over all the nodes and construct the final hash table
 	// select a HT that has at least 50% empty space
 	idx_t capacity = NextPowerOfTwo(MaxValue<idx_t>(count * 2, (Storage::BLOCK_ALLOC_SIZE / sizeof(data_ptr_t)) + 1));
@@ -321,14 +423,27 @@ void JoinHashTable::Finalize() {
 	hash_map = buffer_manager.Allocate(capacity * sizeof(data_ptr_t));
 	memset(hash_map->node->buffer, 0, capacity * sizeof(data_ptr_t));
 
+	// every block gets a slot for its pinned handle, so that the blocks can be inserted by different threads
+	pinned_handles.clear();
+	pinned_handles.resize(blocks.size());
+
+	// the hashes of the keys of a partitioned HT are only inserted one group of partitions at a time
+	if (build_bloom_filter && !external && count > 0 && count <= BLOOM_FILTER_MAX_COUNT) {
+		D_ASSERT(equality_types.size() == 1);
+		bloom_filter = make_shared<BloomFilterData>(count);
+	}
+}
+
+void JoinHashTable::InsertBlocks(idx_t block_start, idx_t block_end, bool parallel) {
+	D_ASSERT(block_end <= blocks.size());
 	Vector hashes(LogicalType::HASH);
 	auto hash_data = FlatVector::GetData<hash_t>(hashes);
 	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
 	// now construct the actual hash table; scan the nodes
 	// as we can the nodes we pin all the blocks of the HT and keep them pinned until the HT is destroyed
 	// this is so that we can keep pointers around to the blocks
-	// FIXME: if we cannot keep everything pinned in memory, we could switch to an out-of-memory merge join or so
-	for (auto &block : blocks) {
+	for (idx_t block_idx = block_start; block_idx < block_end; block_idx++) {
+		auto &block = blocks[block_idx];
 		auto handle = buffer_manager.Pin(block.block);
 		data_ptr_t dataptr = handle->node->buffer;
 		idx_t entry = 0;
@@ -340,19 +455,252 @@ void JoinHashTable::Finalize() {
 				key_locations[i] = dataptr;
 				dataptr += entry_size;
 			}
+			if (bloom_filter) {
+				bloom_filter->Insert(hash_data, next, parallel);
+			}
 			// now insert into the hash table
-			InsertHashes(hashes, next, key_locations);
+			InsertHashes(hashes, next, key_locations, parallel);
 
 			entry += next;
 		}
-		pinned_handles.push_back(move(handle));
+		pinned_handles[block_idx] = move(handle);
 	}
+}
 
-	finalized = true;
+void JoinHashTable::Merge(JoinHashTable &other) {
+	D_ASSERT(!finalized && !other.finalized);
+	lock_guard<mutex> guard(ht_lock);
+	lock_guard<mutex> other_guard(other.ht_lock);
+	for (auto &block : other.blocks) {
+		blocks.push_back(move(block));
+	}
+	other.blocks.clear();
+	count += other.count;
+	other.count = 0;
+	has_null = has_null || other.has_null;
+
+	// the string heap moves over together with its pinned blocks
+	string_heap->Merge(*other.string_heap);
+	for (auto &handle : other.heap_handles) {
+		heap_handles.push_back(move(handle));
+	}
+	other.heap_handles.clear();
+	heap_size += other.heap_size;
+	other.heap_size = 0;
+
+	if (!external && (other.external || SizeInBytes() > memory_budget)) {
+		// the merged HT does not fit in memory: it is partitioned in Finalize
+		InitializePartitions();
+	}
+	if (other.external) {
+		for (idx_t i = 0; i < PARTITION_COUNT; i++) {
+			build_partitions[i]->Merge(*other.build_partitions[i]);
+		}
+	}
+}
+
+void JoinHashTable::ClearRows() {
+	pinned_handles.clear();
+	heap_handles.clear();
+	blocks.clear();
+	hash_map.reset();
+	string_heap = make_unique<RowDataCollection>(buffer_manager, Storage::BLOCK_ALLOC_SIZE / 8, 8);
+	heap_size = 0;
+	count = 0;
+	finalized = false;
+}
+
+void JoinHashTable::PartitionRows() {
+	auto types = condition_types;
+	types.insert(types.end(), build_types.begin(), build_types.end());
+	DataChunk chunk;
+	chunk.Initialize(types);
+
+	Vector addresses(LogicalType::POINTER);
+	auto key_locations = FlatVector::GetData<data_ptr_t>(addresses);
+	Vector hashes(LogicalType::HASH);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	const auto &sel = FlatVector::INCREMENTAL_SELECTION_VECTOR;
+	const auto &offsets = layout.GetOffsets();
+	for (auto &block : blocks) {
+		auto handle = buffer_manager.Pin(block.block);
+		data_ptr_t dataptr = handle->node->buffer;
+		idx_t entry = 0;
+		while (entry < block.count) {
+			// gather the next vector of rows and append them to their partitions
+			idx_t next = MinValue<idx_t>(STANDARD_VECTOR_SIZE, block.count - entry);
+			for (idx_t i = 0; i < next; i++) {
+				hash_data[i] = Load<hash_t>((data_ptr_t)(dataptr + pointer_offset));
+				key_locations[i] = dataptr;
+				dataptr += entry_size;
+			}
+			chunk.Reset();
+			for (idx_t col_no = 0; col_no < chunk.ColumnCount(); col_no++) {
+				RowOperations::Gather(addresses, sel, chunk.data[col_no], sel, next, offsets[col_no], col_no);
+			}
+			chunk.SetCardinality(next);
+			PartitionChunk(chunk, hashes, build_partitions, nullptr);
+
+			entry += next;
+		}
+	}
+	ClearRows();
+}
+
+idx_t JoinHashTable::PartitionChunk(DataChunk &input, Vector &hashes,
+                                    vector<unique_ptr<BufferedChunkCollection>> &partitions,
+                                    SelectionVector *resident_sel) {
+	VectorData hdata;
+	hashes.Orrify(input.size(), hdata);
+	auto hash_data = (hash_t *)hdata.data;
+
+	// the partition is determined by the upper bits of the hash, the HT uses the lower bits
+	idx_t partition_counts[PARTITION_COUNT];
+	memset(partition_counts, 0, sizeof(partition_counts));
+	sel_t row_partitions[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < input.size(); i++) {
+		auto hash = hash_data[hdata.sel->get_index(i)];
+		auto partition = hash >> (sizeof(hash_t) * 8 - PARTITION_RADIX_BITS);
+		row_partitions[i] = partition;
+		partition_counts[partition]++;
+	}
+	// now order the rows by partition
+	idx_t partition_offsets[PARTITION_COUNT];
+	idx_t offset = 0;
+	for (idx_t p = 0; p < PARTITION_COUNT; p++) {
+		partition_offsets[p] = offset;
+		offset += partition_counts[p];
+	}
+	sel_t partition_sel_data[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < input.size(); i++) {
+		partition_sel_data[partition_offsets[row_partitions[i]]++] = i;
+	}
+
+	idx_t resident_count = 0;
+	DataChunk partition_chunk;
+	partition_chunk.InitializeEmpty(input.GetTypes());
+	for (idx_t p = 0; p < PARTITION_COUNT; p++) {
+		if (partition_counts[p] == 0) {
+			continue;
+		}
+		SelectionVector sel(partition_sel_data + partition_offsets[p] - partition_counts[p]);
+		if (resident_sel && partition_resident[p]) {
+			for (idx_t i = 0; i < partition_counts[p]; i++) {
+				resident_sel->set_index(resident_count++, sel.get_index(i));
+			}
+			continue;
+		}
+		partition_chunk.Slice(input, sel, partition_counts[p]);
+		partitions[p]->Append(partition_chunk);
+	}
+	return resident_count;
+}
+
+bool JoinHashTable::PrepareNextPartitions() {
+	D_ASSERT(external);
+	// release the partitions that have been joined
+	ClearRows();
+	for (idx_t i = partition_start; i < partition_end; i++) {
+		build_partitions[i]->Clear();
+		probe_partitions[i]->Clear();
+		partition_resident[i] = false;
+	}
+	partition_start = partition_end;
+	if (partition_start >= PARTITION_COUNT) {
+		return false;
+	}
+	// take as many partitions as fit within the memory budget (but at least one)
+	idx_t group_size = 0;
+	for (partition_end = partition_start; partition_end < PARTITION_COUNT; partition_end++) {
+		auto &partition = *build_partitions[partition_end];
+		idx_t partition_size = partition.SizeInBytes() + partition.Count() * (entry_size + 2 * sizeof(data_ptr_t));
+		if (partition_end > partition_start && group_size + partition_size > memory_budget) {
+			break;
+		}
+		group_size += partition_size;
+	}
+	// now build the HT out of the rows of these partitions
+	DataChunk partition_chunk;
+	DataChunk keys;
+	DataChunk payload;
+	keys.InitializeEmpty(condition_types);
+	if (!build_types.empty()) {
+		payload.InitializeEmpty(build_types);
+	}
+	for (idx_t i = partition_start; i < partition_end; i++) {
+		BufferedChunkScanState scan_state;
+		while (build_partitions[i]->Scan(scan_state, partition_chunk)) {
+			for (idx_t col_idx = 0; col_idx < keys.ColumnCount(); col_idx++) {
+				keys.data[col_idx].Reference(partition_chunk.data[col_idx]);
+			}
+			for (idx_t col_idx = 0; col_idx < payload.ColumnCount(); col_idx++) {
+				payload.data[col_idx].Reference(partition_chunk.data[keys.ColumnCount() + col_idx]);
+			}
+			keys.SetCardinality(partition_chunk);
+			payload.SetCardinality(partition_chunk);
+			Insert(keys, payload);
+		}
+		// the rows now live in the HT
+		build_partitions[i]->Clear();
+	}
+	ConstructHashMap();
+
+	probe_partition = partition_start;
+	probe_scan_state.block_idx = 0;
+	probe_scan_state.position = 0;
+	return true;
+}
+
+void JoinHashTable::SpillProbe(DataChunk &keys, DataChunk &payload) {
+	D_ASSERT(external);
+	auto types = payload.GetTypes();
+	for (idx_t i = 0; i < keys.ColumnCount(); i++) {
+		types.push_back(keys.data[i].GetType());
+	}
+	DataChunk input;
+	input.InitializeEmpty(types);
+	for (idx_t i = 0; i < payload.ColumnCount(); i++) {
+		input.data[i].Reference(payload.data[i]);
+	}
+	for (idx_t i = 0; i < keys.ColumnCount(); i++) {
+		input.data[payload.ColumnCount() + i].Reference(keys.data[i]);
+	}
+	input.SetCardinality(keys);
+
+	Vector hashes(LogicalType::HASH);
+	Hash(keys, FlatVector::INCREMENTAL_SELECTION_VECTOR, keys.size(), hashes);
+	SelectionVector resident_sel(STANDARD_VECTOR_SIZE);
+	idx_t resident_count = PartitionChunk(input, hashes, probe_partitions, &resident_sel);
+	if (resident_count < keys.size()) {
+		keys.Slice(resident_sel, resident_count);
+		payload.Slice(resident_sel, resident_count);
+	}
+}
+
+bool JoinHashTable::ScanSpilledProbe(DataChunk &keys, DataChunk &payload) {
+	D_ASSERT(external);
+	while (probe_partition < partition_end) {
+		if (probe_partitions[probe_partition]->Scan(probe_scan_state, probe_chunk)) {
+			for (idx_t i = 0; i < payload.ColumnCount(); i++) {
+				payload.data[i].Reference(probe_chunk.data[i]);
+			}
+			for (idx_t i = 0; i < keys.ColumnCount(); i++) {
+				keys.data[i].Reference(probe_chunk.data[payload.ColumnCount() + i]);
+			}
+			payload.SetCardinality(probe_chunk);
+			keys.SetCardinality(probe_chunk);
+			return true;
+		}
+		// finished scanning this partition: move to the next one
+		probe_partition++;
+		probe_scan_state.block_idx = 0;
+		probe_scan_state.position = 0;
+	}
+	return false;
 }
 
 unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys) {
-	D_ASSERT(count > 0); // should be handled before
+	D_ASSERT(count > 0 || external); // should be handled before
 	D_ASSERT(finalized);
 
 	// set up the scan structure
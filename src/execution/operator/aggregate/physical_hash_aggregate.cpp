@@ -9,6 +9,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/common/atomic.hpp"
 
 namespace duckdb {
@@ -24,7 +25,7 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
                                              vector<unique_ptr<Expression>> groups_p, idx_t estimated_cardinality,
                                              PhysicalOperatorType type)
     : PhysicalSink(type, move(types), estimated_cardinality), groups(move(groups_p)), all_combinable(true),
-      any_distinct(false) {
+      all_serializable(true), any_distinct(false) {
 	// get a list of all aggregates to be computed
 	// fake a single group with a constant value for aggregation without groups
 	if (this->groups.empty()) {
@@ -57,6 +58,9 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
 		if (!aggr.function.combine) {
 			all_combinable = false;
 		}
+		if (aggr.function.destructor) {
+			all_serializable = false;
+		}
 		aggregates.push_back(move(expr));
 	}
 
@@ -91,11 +95,26 @@ PhysicalHashAggregate::PhysicalHashAggregate(ClientContext &context, vector<Logi
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+//! The amount of memory the HT of a single thread can use before its partitions are spilled to disk
+static idx_t GetMemoryBudget(ClientContext &context) {
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	if (buffer_manager.GetTemporaryDirectory().empty()) {
+		// without a temporary directory the partitions cannot be spilled
+		return INVALID_INDEX;
+	}
+	idx_t memory_limit = buffer_manager.GetMaxMemory();
+	memory_limit = MinValue<idx_t>(memory_limit, context.memory_tracker->GetLimit());
+	memory_limit = MinValue<idx_t>(memory_limit, context.query_memory_tracker->GetLimit());
+	// leave room for the final HTs and for the other operators of the query
+	return memory_limit / 2 / MaxValue<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads(), 1);
+}
+
 class HashAggregateGlobalState : public GlobalOperatorState {
 public:
 	HashAggregateGlobalState(PhysicalHashAggregate &op_p, ClientContext &context)
 	    : op(op_p), is_empty(true), total_groups(0),
-	      partition_info((idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads()) {
+	      partition_info((idx_t)TaskScheduler::GetScheduler(context).NumberOfThreads()),
+	      memory_budget(op_p.all_serializable ? GetMemoryBudget(context) : INVALID_INDEX) {
 	}
 
 	PhysicalHashAggregate &op;
@@ -110,6 +129,9 @@ public:
 	atomic<idx_t> total_groups;
 
 	RadixPartitionInfo partition_info;
+	//! The amount of memory the HT of a thread can use before its partitions are spilled (or INVALID_INDEX if the
+	//! partitions cannot be spilled)
+	idx_t memory_budget;
 };
 
 class HashAggregateLocalState : public LocalSinkState {
@@ -215,6 +237,12 @@ void PhysicalHashAggregate::Sink(ExecutionContext &context, GlobalOperatorState
 	gstate.total_groups +=
 	    llstate.ht->AddChunk(group_chunk, aggregate_input_chunk,
 	                         gstate.total_groups > radix_limit && gstate.partition_info.n_partitions > 1);
+
+	// when the HT of this thread exceeds its share of the memory, the partitions are spilled to disk
+	if (gstate.memory_budget != INVALID_INDEX && llstate.ht->IsPartitioned() &&
+	    llstate.ht->SizeInBytes() > gstate.memory_budget) {
+		llstate.ht->SpillPartitions();
+	}
 }
 
 class PhysicalHashAggregateState : public PhysicalOperatorState {
@@ -257,6 +285,11 @@ void PhysicalHashAggregate::Combine(ExecutionContext &context, GlobalOperatorSta
 		llstate.ht->Partition();
 	}
 
+	// if the HT did not fit in memory, spill the rest as well: the partitions are read back one at a time
+	if (llstate.ht->IsSpilled()) {
+		llstate.ht->SpillPartitions();
+	}
+
 	lock_guard<mutex> glock(gstate.lock);
 	D_ASSERT(all_combinable);
 	D_ASSERT(!any_distinct);
@@ -286,6 +319,11 @@ public:
 				gstate.finalized_hts[radix]->Combine(*ht);
 				ht.reset();
 			}
+			// read back the part of this partition that was spilled
+			auto spilled = pht->GetSpilledPartition(radix);
+			if (spilled) {
+				gstate.finalized_hts[radix]->CombineSerialized(*spilled);
+			}
 		}
 		gstate.finalized_hts[radix]->Finalize();
 	}
@@ -1,13 +1,18 @@
 #include "duckdb/execution/operator/aggregate/physical_window.hpp"
 
 #include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/common/types/row_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/window_segment_tree.hpp"
 #include "duckdb/parallel/task_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/common/windows_undefs.hpp"
 
 #include <cmath>
@@ -17,19 +22,39 @@ namespace duckdb {
 
 using counts_t = std::vector<size_t>;
 
+//	A range of hash bins that is sorted and evaluated by a single task
+class WindowHashGroup {
+public:
+	WindowHashGroup(hash_t bin_begin_p, hash_t bin_end_p) : bin_begin(bin_begin_p), bin_end(bin_end_p) {
+	}
+
+	//! The hash bins [bin_begin, bin_end) of the rows in this group
+	hash_t bin_begin;
+	hash_t bin_end;
+	//! The sorted input chunks
+	ChunkCollection chunks;
+	//! The sorted partition and order columns of the input chunks
+	ChunkCollection over_collection;
+	//! The computed window expressions
+	ChunkCollection window_results;
+};
+
 //	Global sink state
 class WindowGlobalState : public GlobalOperatorState {
 public:
-	WindowGlobalState(PhysicalWindow &op_p, ClientContext &context) : op(op_p) {
+	WindowGlobalState(PhysicalWindow &op_p, ClientContext &context)
+	    : op(op_p), buffer_manager(BufferManager::GetBufferManager(context)) {
 	}
 
 	PhysicalWindow &op;
+	BufferManager &buffer_manager;
 	mutex lock;
 	ChunkCollection chunks;
 	ChunkCollection over_collection;
 	ChunkCollection hash_collection;
-	ChunkCollection window_results;
 	counts_t counts;
+	//! The groups of hash bins that are evaluated independently (a single group if there is no partitioning)
+	vector<unique_ptr<WindowHashGroup>> hash_groups;
 };
 
 //	Per-thread sink state
@@ -366,31 +391,158 @@ static void MaterializeExpression(Expression *expr, ChunkCollection &input, Chun
 	MaterializeExpressions(&expr, 1, input, output, scalar);
 }
 
-static void SortCollectionForPartition(BoundWindowExpression *wexpr, ChunkCollection &input, ChunkCollection &output,
-                                       ChunkCollection &sort_collection) {
-	if (input.Count() == 0) {
+static void ReorderCollection(ChunkCollection &collection, idx_t order[]) {
+	ChunkCollection sorted;
+	for (idx_t offset = 0; offset < collection.Count(); offset += STANDARD_VECTOR_SIZE) {
+		DataChunk chunk;
+		chunk.Initialize(collection.Types());
+		collection.MaterializeSortedChunk(chunk, order, offset);
+		sorted.Append(chunk);
+	}
+	collection.Reset();
+	collection.Merge(sorted);
+}
+
+//! The string columns of an over collection, flattened so their payloads can be compared without creating Values
+struct WindowStringColumns {
+	WindowStringColumns(ChunkCollection &over_collection, const vector<bool> &descending_p) : descending(descending_p) {
+		for (idx_t c = 0; c < over_collection.ColumnCount(); ++c) {
+			if (over_collection.Types()[c].InternalType() == PhysicalType::VARCHAR) {
+				columns.push_back(c);
+			}
+		}
+		for (idx_t chunk_idx = 0; chunk_idx < over_collection.ChunkCount(); ++chunk_idx) {
+			auto &chunk = over_collection.GetChunk(chunk_idx);
+			for (auto c : columns) {
+				chunk.data[c].Normalify(chunk.size());
+				vectors.push_back(&chunk.data[c]);
+			}
+		}
+	}
+
+	//! The indices of the string columns
+	vector<idx_t> columns;
+	//! The vectors of the string columns, chunk by chunk
+	vector<Vector *> vectors;
+	const vector<bool> &descending;
+};
+
+//! Orders rows with equal keys by the part of their strings that did not fit in the key
+struct WindowStringComparator {
+	explicit WindowStringComparator(const WindowStringColumns &strings_p) : strings(strings_p) {
+	}
+
+	bool operator()(const idx_t &lhs, const idx_t &rhs) const {
+		const auto column_count = strings.columns.size();
+		const auto lhs_vectors = strings.vectors.data() + (lhs / STANDARD_VECTOR_SIZE) * column_count;
+		const auto rhs_vectors = strings.vectors.data() + (rhs / STANDARD_VECTOR_SIZE) * column_count;
+		const auto lhs_idx = lhs % STANDARD_VECTOR_SIZE;
+		const auto rhs_idx = rhs % STANDARD_VECTOR_SIZE;
+		for (idx_t i = 0; i < column_count; ++i) {
+			// the keys are equal, so either both values are NULL or neither is
+			if (FlatVector::IsNull(*lhs_vectors[i], lhs_idx)) {
+				continue;
+			}
+			const auto lval = FlatVector::GetData<string_t>(*lhs_vectors[i])[lhs_idx];
+			const auto rval = FlatVector::GetData<string_t>(*rhs_vectors[i])[rhs_idx];
+			if (Equals::Operation(lval, rval)) {
+				continue;
+			}
+			return LessThan::Operation(lval, rval) != strings.descending[strings.columns[i]];
+		}
+		return lhs < rhs;
+	}
+
+	const WindowStringColumns &strings;
+};
+
+//! Sorts the input and the over collection by the partition and order columns. The columns are serialized into
+//! memcmp-able keys with the encoding of PhysicalOrder, which are then radix sorted.
+static void SortCollectionForPartition(BufferManager &buffer_manager, BoundWindowExpression *wexpr,
+                                       ChunkCollection &input, ChunkCollection &over_collection) {
+	const auto count = input.Count();
+	if (count == 0) {
 		return;
 	}
-	vector<OrderType> orders;
-	vector<OrderByNullType> null_order_types;
+	vector<bool> descending;
+	vector<bool> nulls_first;
 
 	// we sort by both 1) partition by expression list and 2) order by expressions
 	for (idx_t prt_idx = 0; prt_idx < wexpr->partitions.size(); prt_idx++) {
-		orders.push_back(OrderType::ASCENDING);
-		null_order_types.push_back(OrderByNullType::NULLS_FIRST);
+		descending.push_back(false);
+		nulls_first.push_back(true);
 	}
 
 	for (idx_t ord_idx = 0; ord_idx < wexpr->orders.size(); ord_idx++) {
-		orders.push_back(wexpr->orders[ord_idx].type);
-		null_order_types.push_back(wexpr->orders[ord_idx].null_order);
+		descending.push_back(wexpr->orders[ord_idx].type == OrderType::DESCENDING);
+		nulls_first.push_back(wexpr->orders[ord_idx].null_order == OrderByNullType::NULLS_FIRST);
+	}
+
+	// every column takes a validity byte and its value (or the prefix of a string), followed by the row index
+	idx_t comp_size = 0;
+	bool has_strings = false;
+	for (auto &type : over_collection.Types()) {
+		auto physical_type = type.InternalType();
+		if (physical_type == PhysicalType::VARCHAR) {
+			comp_size += PhysicalOrder::STRING_RADIX_SIZE + 1;
+			has_strings = true;
+		} else if (TypeIsConstantSize(physical_type)) {
+			comp_size += GetTypeIdSize(physical_type) + 1;
+		} else {
+			throw NotImplementedException("Unable to order column with type %s", type.ToString());
+		}
+	}
+	const idx_t entry_size = comp_size + sizeof(idx_t);
+
+	// serialize the keys into a single block
+	const auto block_capacity = MaxValue<idx_t>(count, (Storage::BLOCK_ALLOC_SIZE + entry_size - 1) / entry_size);
+	RowDataCollection keys(buffer_manager, block_capacity, entry_size);
+	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
+	idx_t row_idx = 0;
+	for (idx_t chunk_idx = 0; chunk_idx < over_collection.ChunkCount(); ++chunk_idx) {
+		auto &over_chunk = over_collection.GetChunk(chunk_idx);
+		const auto chunk_size = over_chunk.size();
+		keys.Build(chunk_size, key_locations, nullptr);
+		for (idx_t c = 0; c < over_chunk.ColumnCount(); ++c) {
+			keys.SerializeVectorSortable(over_chunk.data[c], chunk_size, FlatVector::INCREMENTAL_SELECTION_VECTOR,
+			                             chunk_size, key_locations, descending[c], true, nulls_first[c],
+			                             PhysicalOrder::STRING_RADIX_SIZE);
+		}
+		// the key locations now point to the row index
+		for (idx_t i = 0; i < chunk_size; ++i) {
+			Store<idx_t>(row_idx + i, key_locations[i]);
+		}
+		row_idx += chunk_size;
+	}
+	D_ASSERT(keys.blocks.size() == 1);
+	auto key_handle = buffer_manager.Pin(keys.blocks[0].block);
+	const auto key_ptr = key_handle->Ptr();
+
+	RowOperations::RadixSort(buffer_manager, key_ptr, count, 0, comp_size, entry_size);
+
+	auto sorted_vector = unique_ptr<idx_t[]>(new idx_t[count]);
+	for (idx_t i = 0; i < count; ++i) {
+		sorted_vector[i] = Load<idx_t>(key_ptr + i * entry_size + comp_size);
 	}
 
-	auto sorted_vector = unique_ptr<idx_t[]>(new idx_t[input.Count()]);
-	sort_collection.Sort(orders, null_order_types, sorted_vector.get());
+	// rows with equal keys can still differ in the strings beyond their prefix
+	if (has_strings) {
+		WindowStringColumns strings(over_collection, descending);
+		idx_t tie_start = 0;
+		for (idx_t i = 1; i <= count; ++i) {
+			if (i < count && memcmp(key_ptr + tie_start * entry_size, key_ptr + i * entry_size, comp_size) == 0) {
+				continue;
+			}
+			if (i - tie_start > 1) {
+				std::sort(sorted_vector.get() + tie_start, sorted_vector.get() + i, WindowStringComparator(strings));
+			}
+			tie_start = i;
+		}
+	}
+	key_handle.reset();
 
-	input.Reorder(sorted_vector.get());
-	output.Reorder(sorted_vector.get());
-	sort_collection.Reorder(sorted_vector.get());
+	ReorderCollection(input, sorted_vector.get());
+	ReorderCollection(over_collection, sorted_vector.get());
 }
 
 static void HashChunk(counts_t &counts, DataChunk &hash_chunk, DataChunk &sort_chunk, const idx_t partition_cols) {
@@ -766,8 +918,9 @@ static void ComputeWindowExpression(BoundWindowExpression *wexpr, ChunkCollectio
 
 using WindowExpressions = vector<BoundWindowExpression *>;
 
-static void ComputeWindowExpressions(WindowExpressions &window_exprs, ChunkCollection &big_data,
-                                     ChunkCollection &window_results, ChunkCollection &over_collection) {
+static void ComputeWindowExpressions(BufferManager &buffer_manager, WindowExpressions &window_exprs,
+                                     ChunkCollection &big_data, ChunkCollection &window_results,
+                                     ChunkCollection &over_collection) {
 	//	Idempotency
 	if (big_data.Count() == 0) {
 		return;
@@ -778,9 +931,28 @@ static void ComputeWindowExpressions(WindowExpressions &window_exprs, ChunkColle
 	//	Sort the partition
 	const auto sort_col_count = over_expr->partitions.size() + over_expr->orders.size();
 	if (sort_col_count > 0) {
-		SortCollectionForPartition(over_expr, big_data, window_results, over_collection);
+		SortCollectionForPartition(buffer_manager, over_expr, big_data, over_collection);
 	}
 
+	//	Initialise the results to NULL
+	vector<LogicalType> window_types;
+	for (auto wexpr : window_exprs) {
+		window_types.push_back(wexpr->return_type);
+	}
+	for (idx_t i = 0; i < big_data.ChunkCount(); i++) {
+		DataChunk window_chunk;
+		window_chunk.Initialize(window_types);
+		window_chunk.SetCardinality(big_data.GetChunk(i).size());
+		for (idx_t col_idx = 0; col_idx < window_chunk.ColumnCount(); col_idx++) {
+			window_chunk.data[col_idx].SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(window_chunk.data[col_idx], true);
+		}
+
+		window_chunk.Verify();
+		window_results.Append(window_chunk);
+	}
+	D_ASSERT(window_results.ColumnCount() == window_exprs.size());
+
 	//	Set bits for the start of each partition
 	BitArray<uint64_t> partition_bits(big_data.Count());
 	partition_bits[0] = true;
@@ -811,34 +983,97 @@ static void AppendCollection(const ChunkCollection &source, ChunkCollection &tar
 	target.Append(chunk);
 }
 
-static void ExtractPartition(WindowGlobalState &gstate, ChunkCollection &chunks, ChunkCollection &window_results,
-                             ChunkCollection &over_collection, const hash_t hash_bin, const hash_t hash_mask) {
-
-	//	Copy the partition data so we can work with it on this thread
-	ChunkCollection &hashes = gstate.hash_collection;
-	SelectionVector sel;
-	for (idx_t chunk_idx = 0; chunk_idx < hashes.ChunkCount(); ++chunk_idx) {
-		//	Build a selection vector of matching hashes
-		auto &hash_chunk = hashes.GetChunk(chunk_idx);
-		auto hash_size = hash_chunk.size();
-		auto hash_data = FlatVector::GetData<hash_t>(hash_chunk.data[0]);
-		sel.Initialize(hash_size);
-		idx_t bin_size = 0;
-		for (idx_t i = 0; i < hash_size; ++i) {
-			if ((hash_data[i] & hash_mask) == hash_bin) {
-				sel.set_index(bin_size++, i);
+//! Divides the hash bins into groups of roughly the same size, so the groups can be evaluated in parallel
+static void CreateHashGroups(WindowGlobalState &gstate, idx_t num_threads) {
+	auto &counts = gstate.counts;
+	if (counts.empty()) {
+		// there is no partitioning: all rows end up in a single group
+		gstate.hash_groups.push_back(make_unique<WindowHashGroup>(0, 1));
+		return;
+	}
+
+	// create more groups than threads, since the partitions can be skewed
+	const auto group_count = MinValue<idx_t>(num_threads * 4, counts.size());
+	const auto group_size = (gstate.chunks.Count() + group_count - 1) / group_count;
+	hash_t bin_begin = 0;
+	idx_t current_size = 0;
+	for (hash_t hash_bin = 0; hash_bin < counts.size(); ++hash_bin) {
+		if (current_size == 0) {
+			bin_begin = hash_bin;
+		}
+		current_size += counts[hash_bin];
+		if (current_size >= group_size || (hash_bin + 1 == counts.size() && current_size > 0)) {
+			gstate.hash_groups.push_back(make_unique<WindowHashGroup>(bin_begin, hash_bin + 1));
+			current_size = 0;
+		}
+	}
+}
+
+//! Moves the input rows into the groups of their hash bins in a single pass over the input
+static void ScatterHashGroups(WindowGlobalState &gstate) {
+	auto &hash_groups = gstate.hash_groups;
+	if (gstate.counts.empty()) {
+		//	There is no partitioning: the whole input is a single group
+		D_ASSERT(hash_groups.size() == 1);
+		hash_groups[0]->chunks.Merge(gstate.chunks);
+		hash_groups[0]->over_collection.Merge(gstate.over_collection);
+	} else {
+		//	Map every hash bin to its group
+		const auto hash_mask = hash_t(gstate.counts.size() - 1);
+		vector<idx_t> bin_groups(gstate.counts.size());
+		for (idx_t group_idx = 0; group_idx < hash_groups.size(); ++group_idx) {
+			auto &hash_group = *hash_groups[group_idx];
+			for (auto hash_bin = hash_group.bin_begin; hash_bin < hash_group.bin_end; ++hash_bin) {
+				bin_groups[hash_bin] = group_idx;
 			}
 		}
 
-		//	Copy the data for each collection
-		if (bin_size == 0) {
-			continue;
+		//	Build a selection vector per group for every chunk and copy the selected rows
+		vector<SelectionVector> sels(hash_groups.size());
+		vector<idx_t> sel_counts(hash_groups.size());
+		for (auto &sel : sels) {
+			sel.Initialize(STANDARD_VECTOR_SIZE);
+		}
+		auto &hashes = gstate.hash_collection;
+		for (idx_t chunk_idx = 0; chunk_idx < hashes.ChunkCount(); ++chunk_idx) {
+			auto &hash_chunk = hashes.GetChunk(chunk_idx);
+			auto hash_data = FlatVector::GetData<hash_t>(hash_chunk.data[0]);
+			std::fill(sel_counts.begin(), sel_counts.end(), 0);
+			for (idx_t i = 0; i < hash_chunk.size(); ++i) {
+				const auto group_idx = bin_groups[hash_data[i] & hash_mask];
+				sels[group_idx].set_index(sel_counts[group_idx]++, i);
+			}
+			for (idx_t group_idx = 0; group_idx < hash_groups.size(); ++group_idx) {
+				if (sel_counts[group_idx] == 0) {
+					continue;
+				}
+				auto &hash_group = *hash_groups[group_idx];
+				AppendCollection(gstate.chunks, hash_group.chunks, sels[group_idx], sel_counts[group_idx], chunk_idx);
+				AppendCollection(gstate.over_collection, hash_group.over_collection, sels[group_idx],
+				                 sel_counts[group_idx], chunk_idx);
+			}
 		}
+	}
+
+	//	The input has been moved into the hash groups
+	gstate.chunks.Reset();
+	gstate.over_collection.Reset();
+	gstate.hash_collection.Reset();
+}
 
-		AppendCollection(gstate.chunks, chunks, sel, bin_size, chunk_idx);
-		AppendCollection(gstate.window_results, window_results, sel, bin_size, chunk_idx);
-		AppendCollection(gstate.over_collection, over_collection, sel, bin_size, chunk_idx);
+static void GenerateHashGroup(WindowGlobalState &gstate, WindowHashGroup &hash_group) {
+	auto &op = (PhysicalWindow &)gstate.op;
+	WindowExpressions window_exprs;
+	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
+		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
+		auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.select_list[expr_idx].get());
+		window_exprs.emplace_back(wexpr);
 	}
+
+	ComputeWindowExpressions(gstate.buffer_manager, window_exprs, hash_group.chunks, hash_group.window_results,
+	                         hash_group.over_collection);
+	//	The over collection is only needed to compute the window expressions
+	hash_group.over_collection.Reset();
 }
 
 //===--------------------------------------------------------------------===//
@@ -853,26 +1088,17 @@ idx_t PhysicalWindow::MaxThreads(ClientContext &context) {
 	}
 	auto &state = (WindowGlobalState &)*this->sink_state;
 
-	// If there is only one partition, we have to process it on one thread.
-	if (state.counts.empty()) {
-		return 1;
-	}
-
-	idx_t max_threads = 0;
-	for (const auto count : state.counts) {
-		max_threads += int(count > 0);
-	}
-
-	return max_threads;
+	// Every group of hash bins is scanned by a single thread
+	return MaxValue<idx_t>(state.hash_groups.size(), 1);
 }
 
 //	Global read state
 class WindowParallelState : public ParallelState {
 public:
-	WindowParallelState() : next_part(0) {
+	WindowParallelState() : next_group(0) {
 	}
-	//! The output read position.
-	atomic<idx_t> next_part;
+	//! The next hash group to scan.
+	atomic<idx_t> next_group;
 };
 
 unique_ptr<ParallelState> PhysicalWindow::GetParallelState() {
@@ -884,20 +1110,17 @@ unique_ptr<ParallelState> PhysicalWindow::GetParallelState() {
 class PhysicalWindowOperatorState : public PhysicalOperatorState {
 public:
 	PhysicalWindowOperatorState(PhysicalOperator &op, PhysicalOperator *child)
-	    : PhysicalOperatorState(op, child), parallel_state(nullptr), initialized(false) {
+	    : PhysicalOperatorState(op, child), parallel_state(nullptr), initialized(false), next_group(0),
+	      hash_group(nullptr), position(0) {
 	}
 
 	ParallelState *parallel_state;
 	bool initialized;
 
-	//! The number of partitions to process (0 if there is no partitioning)
-	size_t partitions;
-	//! The output read position.
-	size_t next_part;
-	//! The generated input chunks
-	ChunkCollection chunks;
-	//! The generated output chunks
-	ChunkCollection window_results;
+	//! The next hash group to scan (if there is no parallel state)
+	idx_t next_group;
+	//! The hash group that is being scanned
+	WindowHashGroup *hash_group;
 	//! The read cursor
 	idx_t position;
 };
@@ -906,42 +1129,9 @@ unique_ptr<PhysicalOperatorState> PhysicalWindow::GetOperatorState() {
 	return make_unique<PhysicalWindowOperatorState>(*this, children.empty() ? nullptr : children[0].get());
 }
 
-static void GeneratePartition(PhysicalWindowOperatorState &state, WindowGlobalState &gstate, const idx_t hash_bin) {
-	auto &op = (PhysicalWindow &)gstate.op;
-	WindowExpressions window_exprs;
-	for (idx_t expr_idx = 0; expr_idx < op.select_list.size(); ++expr_idx) {
-		D_ASSERT(op.select_list[expr_idx]->GetExpressionClass() == ExpressionClass::BOUND_WINDOW);
-		auto wexpr = reinterpret_cast<BoundWindowExpression *>(op.select_list[expr_idx].get());
-		window_exprs.emplace_back(wexpr);
-	}
-
-	//	Get rid of any stale data
-	state.chunks.Reset();
-	state.window_results.Reset();
-	state.position = 0;
-
-	if (gstate.counts.empty() && hash_bin == 0) {
-		ChunkCollection &big_data = gstate.chunks;
-		ChunkCollection &window_results = gstate.window_results;
-		ChunkCollection &over_collection = gstate.over_collection;
-		ComputeWindowExpressions(window_exprs, big_data, window_results, over_collection);
-		state.chunks.Merge(big_data);
-		state.window_results.Merge(window_results);
-	} else if (hash_bin < gstate.counts.size() && gstate.counts[hash_bin] > 0) {
-		ChunkCollection input;
-		ChunkCollection output;
-		ChunkCollection over;
-		const auto hash_mask = hash_t(gstate.counts.size() - 1);
-		ExtractPartition(gstate, input, output, over, hash_bin, hash_mask);
-		ComputeWindowExpressions(window_exprs, input, output, over);
-		state.chunks.Merge(input);
-		state.window_results.Merge(output);
-	}
-}
-
 static void Scan(PhysicalWindowOperatorState &state, DataChunk &chunk) {
-	ChunkCollection &big_data = state.chunks;
-	ChunkCollection &window_results = state.window_results;
+	ChunkCollection &big_data = state.hash_group->chunks;
+	ChunkCollection &window_results = state.hash_group->window_results;
 
 	if (state.position >= big_data.Count()) {
 		return;
@@ -971,14 +1161,9 @@ void PhysicalWindow::GetChunkInternal(ExecutionContext &context, DataChunk &chun
 	auto &gstate = (WindowGlobalState &)*sink_state;
 
 	if (!state.initialized) {
-		// initialize thread-local operator state
-		state.partitions = gstate.counts.size();
-		state.next_part = 0;
 		// record parallel state (if any)
 		state.parallel_state = nullptr;
 		auto &task = context.task;
-		// check if there is any parallel state to fetch
-		state.parallel_state = nullptr;
 		auto task_info = task.task_info.find(this);
 		if (task_info != task.task_info.end()) {
 			// parallel scan init
@@ -987,41 +1172,26 @@ void PhysicalWindow::GetChunkInternal(ExecutionContext &context, DataChunk &chun
 		state.initialized = true;
 	}
 
-	if (!state.parallel_state) {
-		// sequential scan
-		if (state.position >= state.chunks.Count()) {
-			auto hash_bin = state.next_part++;
-			for (; hash_bin < state.partitions; hash_bin = state.next_part++) {
-				if (gstate.counts[hash_bin] > 0) {
-					break;
-				}
+	while (true) {
+		if (!state.hash_group || state.position >= state.hash_group->chunks.Count()) {
+			// move on to the next hash group
+			idx_t group_idx;
+			if (state.parallel_state) {
+				auto &parallel_state = *reinterpret_cast<WindowParallelState *>(state.parallel_state);
+				group_idx = parallel_state.next_group++;
+			} else {
+				group_idx = state.next_group++;
 			}
-			GeneratePartition(state, gstate, hash_bin);
+			if (group_idx >= gstate.hash_groups.size()) {
+				break;
+			}
+			state.hash_group = gstate.hash_groups[group_idx].get();
+			state.position = 0;
 		}
 		Scan(state, chunk);
 		if (chunk.size() != 0) {
 			return;
 		}
-	} else {
-		// parallel scan
-		auto &parallel_state = *reinterpret_cast<WindowParallelState *>(state.parallel_state);
-		do {
-			if (state.position >= state.chunks.Count()) {
-				auto hash_bin = parallel_state.next_part++;
-				for (; hash_bin < state.partitions; hash_bin = parallel_state.next_part++) {
-					if (gstate.counts[hash_bin] > 0) {
-						break;
-					}
-				}
-				GeneratePartition(state, gstate, hash_bin);
-			}
-			Scan(state, chunk);
-			if (chunk.size() != 0) {
-				return;
-			} else {
-				break;
-			}
-		} while (true);
 	}
 	D_ASSERT(chunk.size() == 0);
 }
@@ -1076,41 +1246,56 @@ void PhysicalWindow::Combine(ExecutionContext &context, GlobalOperatorState &gst
 	}
 }
 
-bool PhysicalWindow::FinalizeInternal(ClientContext &context, unique_ptr<GlobalOperatorState> gstate_p) {
+// this task sorts and evaluates the window expressions of a group of hash bins
+class PhysicalWindowFinalizeTask : public Task {
+public:
+	PhysicalWindowFinalizeTask(Pipeline &parent_p, WindowGlobalState &state_p, WindowHashGroup &hash_group_p)
+	    : parent(parent_p), state(state_p), hash_group(hash_group_p) {
+	}
+
+	void Execute() override {
+		GenerateHashGroup(state, hash_group);
+		auto total_tasks = parent.total_tasks.load();
+		auto finished_tasks = ++parent.finished_tasks;
+		// finish the whole pipeline
+		if (total_tasks == finished_tasks) {
+			parent.Finish();
+		}
+	}
+
+private:
+	Pipeline &parent;
+	WindowGlobalState &state;
+	WindowHashGroup &hash_group;
+};
+
+bool PhysicalWindow::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> gstate_p) {
 	this->sink_state = move(gstate_p);
 	auto &gstate = (WindowGlobalState &)*this->sink_state;
 
-	ChunkCollection &big_data = gstate.chunks;
-	ChunkCollection &window_results = gstate.window_results;
-
-	if (big_data.Count() == 0) {
+	if (gstate.chunks.Count() == 0) {
 		return true;
 	}
 
-	vector<LogicalType> window_types;
-	for (idx_t expr_idx = 0; expr_idx < select_list.size(); expr_idx++) {
-		window_types.push_back(select_list[expr_idx]->return_type);
-	}
-
-	for (idx_t i = 0; i < big_data.ChunkCount(); i++) {
-		DataChunk window_chunk;
-		window_chunk.Initialize(window_types);
-		window_chunk.SetCardinality(big_data.GetChunk(i).size());
-		for (idx_t col_idx = 0; col_idx < window_chunk.ColumnCount(); col_idx++) {
-			window_chunk.data[col_idx].SetVectorType(VectorType::CONSTANT_VECTOR);
-			ConstantVector::SetNull(window_chunk.data[col_idx], true);
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	const idx_t num_threads = scheduler.NumberOfThreads();
+	CreateHashGroups(gstate, num_threads);
+	ScatterHashGroups(gstate);
+	if (num_threads <= 1 || gstate.hash_groups.size() <= 1) {
+		// evaluate the groups in this thread
+		for (auto &hash_group : gstate.hash_groups) {
+			GenerateHashGroup(gstate, *hash_group);
 		}
-
-		window_chunk.Verify();
-		window_results.Append(window_chunk);
+		return true;
 	}
 
-	D_ASSERT(window_results.ColumnCount() == select_list.size());
-	return true;
-}
-
-bool PhysicalWindow::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> gstate_p) {
-	return FinalizeInternal(context, move(gstate_p));
+	// schedule a task for every group of hash bins
+	pipeline.total_tasks += gstate.hash_groups.size();
+	for (auto &hash_group : gstate.hash_groups) {
+		auto new_task = make_unique<PhysicalWindowFinalizeTask>(pipeline, gstate, *hash_group);
+		scheduler.ScheduleTask(pipeline.token, move(new_task));
+	}
+	return false;
 }
 
 unique_ptr<LocalSinkState> PhysicalWindow::GetLocalSinkState(ExecutionContext &context) {
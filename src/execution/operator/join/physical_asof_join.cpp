@@ -0,0 +1,500 @@
+#include "duckdb/execution/operator/join/physical_asof_join.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/common/types/row_data_collection.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+PhysicalAsOfJoin::PhysicalAsOfJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                                   unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond,
+                                   JoinType join_type, idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::ASOF_JOIN, move(cond), join_type, estimated_cardinality) {
+	D_ASSERT(join_type == JoinType::INNER || join_type == JoinType::LEFT);
+	D_ASSERT(!conditions.empty());
+	for (auto &cond : conditions) {
+		D_ASSERT(cond.left->return_type == cond.right->return_type);
+		join_key_types.push_back(cond.left->return_type);
+	}
+	auto &inequality_type = conditions.back().left->return_type;
+	D_ASSERT(IsSupportedInequalityType(inequality_type));
+	// every key is serialized with a validity byte
+	hash_size = conditions.size() > 1 ? sizeof(hash_t) + 1 : 0;
+	key_size = hash_size + GetTypeIdSize(inequality_type.InternalType()) + 1;
+	children.push_back(move(left));
+	children.push_back(move(right));
+}
+
+bool PhysicalAsOfJoin::IsSupportedInequalityType(const LogicalType &type) {
+	// the keys are compared in their memcmp-able sorting representation, which has to be complete
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::FLOAT:
+	case PhysicalType::DOUBLE:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Keys
+//===--------------------------------------------------------------------===//
+//! Selects the rows of a chunk of join keys that have no NULL key, these are the only rows that can have a match
+static idx_t SelectValidKeys(DataChunk &join_keys, SelectionVector &sel) {
+	const auto count = join_keys.size();
+	auto key_data = join_keys.Orrify();
+	idx_t valid_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		bool is_valid = true;
+		for (idx_t c = 0; c < join_keys.ColumnCount(); c++) {
+			if (!key_data[c].validity.RowIsValid(key_data[c].sel->get_index(i))) {
+				is_valid = false;
+				break;
+			}
+		}
+		if (is_valid) {
+			sel.set_index(valid_count++, i);
+		}
+	}
+	return valid_count;
+}
+
+//! Serializes the keys of the selected rows: the hash of the equality keys followed by the inequality key, both in the
+//! memcmp-able representation of PhysicalOrder
+static void SerializeKeys(RowDataCollection &serializer, DataChunk &join_keys, const SelectionVector &sel,
+                          idx_t valid_count, data_ptr_t key_locations[]) {
+	const auto count = join_keys.size();
+	const auto equality_count = join_keys.ColumnCount() - 1;
+	if (equality_count > 0) {
+		Vector hashes(LogicalType::HASH);
+		VectorOperations::Hash(join_keys.data[0], hashes, count);
+		for (idx_t c = 1; c < equality_count; c++) {
+			VectorOperations::CombineHash(hashes, join_keys.data[c], count);
+		}
+		serializer.SerializeVectorSortable(hashes, count, sel, valid_count, key_locations, false, true, true, 0);
+	}
+	serializer.SerializeVectorSortable(join_keys.data[equality_count], count, sel, valid_count, key_locations, false,
+	                                   true, true, 0);
+}
+
+//! Finds the first of the sorted entries whose key is larger than the key (upper) or not smaller than it (lower). The
+//! search gallops from the position that was found for the previous key, so merging sorted keys stays linear.
+static idx_t SearchKeys(data_ptr_t entries, idx_t count, idx_t entry_size, data_ptr_t key, idx_t key_size, bool upper,
+                        idx_t hint) {
+	auto before_key = [&](idx_t position) {
+		auto cmp = memcmp(entries + position * entry_size, key, key_size);
+		return upper ? cmp <= 0 : cmp < 0;
+	};
+	// narrow down [lower, upper): every position before lower is before the key, upper is not (or the end)
+	idx_t lower = 0;
+	idx_t upper_bound = count;
+	idx_t step = 1;
+	if (hint < count && before_key(hint)) {
+		lower = hint + 1;
+		while (lower < count) {
+			auto probe = MinValue<idx_t>(lower + step - 1, count - 1);
+			if (!before_key(probe)) {
+				upper_bound = probe;
+				break;
+			}
+			lower = probe + 1;
+			step *= 2;
+		}
+	} else {
+		upper_bound = MinValue<idx_t>(hint, count);
+		while (upper_bound > 0) {
+			auto probe = upper_bound > step ? upper_bound - step : 0;
+			if (before_key(probe)) {
+				lower = probe + 1;
+				break;
+			}
+			upper_bound = probe;
+			step *= 2;
+		}
+	}
+	while (lower < upper_bound) {
+		auto middle = lower + (upper_bound - lower) / 2;
+		if (before_key(middle)) {
+			lower = middle + 1;
+		} else {
+			upper_bound = middle;
+		}
+	}
+	return lower;
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class AsOfLocalState : public LocalSinkState {
+public:
+	explicit AsOfLocalState(const vector<JoinCondition> &conditions) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			rhs_executor.AddExpression(*cond.right);
+			condition_types.push_back(cond.right->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	//! The chunk holding the right condition
+	DataChunk join_keys;
+	//! The executor of the RHS condition
+	ExpressionExecutor rhs_executor;
+	//! The materialized data of the RHS sunk by this thread
+	ChunkCollection right_chunks;
+	//! The materialized join keys of the RHS sunk by this thread
+	ChunkCollection right_conditions;
+};
+
+class AsOfGlobalState : public GlobalOperatorState {
+public:
+	AsOfGlobalState() : count(0) {
+	}
+
+	mutex lock;
+	//! The materialized data of the RHS
+	ChunkCollection right_chunks;
+	//! The materialized join keys of the RHS
+	ChunkCollection right_conditions;
+	//! The amount of rows of the RHS that can have a match
+	idx_t count;
+	//! The entries of the rows of the RHS that can have a match in sorted order: their serialized keys, followed by
+	//! their index in the materialized RHS
+	unique_ptr<RowDataCollection> right_rows;
+	//! The pinned block of the sorted entries
+	unique_ptr<BufferHandle> right_handle;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalAsOfJoin::GetGlobalState(ClientContext &context) {
+	return make_unique<AsOfGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalAsOfJoin::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<AsOfLocalState>(conditions);
+}
+
+void PhysicalAsOfJoin::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+                            DataChunk &input) const {
+	auto &asof_state = (AsOfLocalState &)lstate;
+
+	// resolve the join keys for this chunk
+	asof_state.rhs_executor.SetChunk(input);
+
+	asof_state.join_keys.Reset();
+	asof_state.join_keys.SetCardinality(input);
+	for (idx_t k = 0; k < conditions.size(); k++) {
+		asof_state.rhs_executor.ExecuteExpression(k, asof_state.join_keys.data[k]);
+	}
+	asof_state.right_chunks.Append(input);
+	asof_state.right_conditions.Append(asof_state.join_keys);
+}
+
+void PhysicalAsOfJoin::Combine(ExecutionContext &context, GlobalOperatorState &gstate_p, LocalSinkState &lstate) {
+	auto &gstate = (AsOfGlobalState &)gstate_p;
+	auto &state = (AsOfLocalState &)lstate;
+	{
+		// both collections were appended the same chunks, so they are merged in the same order
+		lock_guard<mutex> glock(gstate.lock);
+		gstate.right_chunks.Merge(state.right_chunks);
+		gstate.right_conditions.Merge(state.right_conditions);
+	}
+	context.thread.profiler.Flush(this, &state.rhs_executor, "rhs_executor", 1);
+	context.client.profiler->Flush(context.thread.profiler);
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+bool PhysicalAsOfJoin::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
+	auto &gstate = (AsOfGlobalState &)*state;
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto &input = gstate.right_chunks;
+	auto &input_keys = gstate.right_conditions;
+	if (input.Count() == 0) {
+		PhysicalSink::Finalize(pipeline, context, move(state));
+		return true;
+	}
+	// every row takes its keys, followed by the row index; rows with a NULL key can not match and are left out
+	const idx_t entry_size = key_size + sizeof(idx_t);
+	const auto block_capacity =
+	    MaxValue<idx_t>(input.Count(), (Storage::BLOCK_ALLOC_SIZE + entry_size - 1) / entry_size);
+	auto rows = make_unique<RowDataCollection>(buffer_manager, block_capacity, entry_size);
+	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t row_idx = 0;
+	for (idx_t chunk_idx = 0; chunk_idx < input_keys.ChunkCount(); chunk_idx++) {
+		auto &key_chunk = input_keys.GetChunk(chunk_idx);
+		const auto valid_count = SelectValidKeys(key_chunk, sel);
+		if (valid_count > 0) {
+			rows->Build(valid_count, key_locations, nullptr);
+			SerializeKeys(*rows, key_chunk, sel, valid_count, key_locations);
+			// the key locations now point to the row index
+			for (idx_t i = 0; i < valid_count; i++) {
+				Store<idx_t>(row_idx + sel.get_index(i), key_locations[i]);
+			}
+			gstate.count += valid_count;
+		}
+		row_idx += key_chunk.size();
+	}
+	const auto count = gstate.count;
+	if (count > 0) {
+		// sorting on the hash partitions the rows on their equality keys, the partitions are sorted on the inequality
+		// key; the payload stays where it is and is gathered through the row index of the entries
+		D_ASSERT(rows->blocks.size() == 1);
+		gstate.right_handle = buffer_manager.Pin(rows->blocks[0].block);
+		RowOperations::RadixSort(buffer_manager, gstate.right_handle->Ptr(), count, 0, key_size, entry_size);
+		gstate.right_rows = move(rows);
+		if (conditions.size() == 1) {
+			// the keys are only gathered to tell apart the rows of which the hashes collide
+			input_keys.Reset();
+		}
+	} else {
+		input.Reset();
+		input_keys.Reset();
+	}
+	PhysicalSink::Finalize(pipeline, context, move(state));
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// GetChunkInternal
+//===--------------------------------------------------------------------===//
+class PhysicalAsOfJoinState : public PhysicalOperatorState {
+public:
+	PhysicalAsOfJoinState(PhysicalOperator &op, PhysicalOperator *left, const vector<JoinCondition> &conditions,
+	                      idx_t key_size)
+	    : PhysicalOperatorState(op, left), left_keys(new data_t[STANDARD_VECTOR_SIZE * key_size]) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			lhs_executor.AddExpression(*cond.left);
+			condition_types.push_back(cond.left->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	DataChunk join_keys;
+	//! The executor of the LHS condition
+	ExpressionExecutor lhs_executor;
+	//! Serializes the keys of the LHS
+	unique_ptr<RowDataCollection> serializer;
+	//! The serialized keys of the current chunk of the LHS, by row
+	unique_ptr<data_t[]> left_keys;
+	//! The gathered join keys of the candidate matches
+	DataChunk right_conditions;
+	//! The gathered data of the matches
+	DataChunk right_payload;
+};
+
+void PhysicalAsOfJoin::GetChunkInternal(ExecutionContext &context, DataChunk &chunk,
+                                        PhysicalOperatorState *state_p) const {
+	auto &state = (PhysicalAsOfJoinState &)*state_p;
+	auto &gstate = (AsOfGlobalState &)*sink_state;
+	const auto left_columns = children[0]->types.size();
+	const auto equality_count = conditions.size() - 1;
+	const auto inequality = conditions.back().comparison;
+	// the closest row is the last one before the key for > and >=, and the first one after it for < and <=
+	const bool search_upper = inequality == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+	                          inequality == ExpressionType::COMPARE_LESSTHAN;
+	const bool search_backward = inequality == ExpressionType::COMPARE_GREATERTHANOREQUALTO ||
+	                             inequality == ExpressionType::COMPARE_GREATERTHAN;
+	if (!state.serializer) {
+		auto &buffer_manager = BufferManager::GetBufferManager(context.client);
+		state.serializer = make_unique<RowDataCollection>(
+		    buffer_manager, (Storage::BLOCK_ALLOC_SIZE + key_size - 1) / key_size, key_size);
+		state.right_payload.Initialize(children[1]->types);
+		if (equality_count > 0) {
+			state.right_conditions.Initialize(join_key_types);
+		}
+	}
+	const auto right_entries = gstate.right_handle ? gstate.right_handle->Ptr() : nullptr;
+	const auto entry_size = key_size + sizeof(idx_t);
+	const auto right_count = gstate.count;
+	do {
+		children[0]->GetChunk(context, state.child_chunk, state.child_state.get());
+		const auto count = state.child_chunk.size();
+		if (count == 0) {
+			return;
+		}
+		if (right_count == 0) {
+			// empty RHS (or only NULL keys): no matches
+			if (join_type == JoinType::INNER) {
+				return;
+			}
+			ConstructEmptyJoinResult(join_type, false, state.child_chunk, chunk);
+			return;
+		}
+
+		// resolve and serialize the join keys of the rows that can have a match
+		state.join_keys.Reset();
+		state.lhs_executor.SetChunk(state.child_chunk);
+		state.join_keys.SetCardinality(state.child_chunk);
+		for (idx_t k = 0; k < conditions.size(); k++) {
+			state.lhs_executor.ExecuteExpression(k, state.join_keys.data[k]);
+		}
+		SelectionVector valid_sel(STANDARD_VECTOR_SIZE);
+		const auto valid_count = SelectValidKeys(state.join_keys, valid_sel);
+		data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
+		for (idx_t i = 0; i < valid_count; i++) {
+			key_locations[i] = state.left_keys.get() + valid_sel.get_index(i) * key_size;
+		}
+		SerializeKeys(*state.serializer, state.join_keys, valid_sel, valid_count, key_locations);
+
+		// sort the rows on their keys, so the search only moves forward through the RHS
+		idx_t order[STANDARD_VECTOR_SIZE];
+		for (idx_t i = 0; i < valid_count; i++) {
+			order[i] = valid_sel.get_index(i);
+		}
+		const auto left_keys = state.left_keys.get();
+		const auto key_size_p = key_size;
+		std::sort(order, order + valid_count, [&](const idx_t &lhs, const idx_t &rhs) {
+			return memcmp(left_keys + lhs * key_size_p, left_keys + rhs * key_size_p, key_size_p) < 0;
+		});
+
+		// merge them with the RHS: the candidate match is the closest row in the partition of the hash
+		idx_t right_match[STANDARD_VECTOR_SIZE];
+		for (idx_t i = 0; i < count; i++) {
+			right_match[i] = INVALID_INDEX;
+		}
+		idx_t pending[STANDARD_VECTOR_SIZE];
+		idx_t pending_count = 0;
+		idx_t hint = 0;
+		for (idx_t i = 0; i < valid_count; i++) {
+			const auto row = order[i];
+			const auto key = left_keys + row * key_size;
+			hint = SearchKeys(right_entries, right_count, entry_size, key, key_size, search_upper, hint);
+			idx_t candidate;
+			if (search_backward) {
+				if (hint == 0) {
+					continue;
+				}
+				candidate = hint - 1;
+			} else {
+				if (hint == right_count) {
+					continue;
+				}
+				candidate = hint;
+			}
+			if (memcmp(right_entries + candidate * entry_size, key, hash_size) != 0) {
+				continue;
+			}
+			right_match[row] = candidate;
+			pending[pending_count++] = row;
+		}
+
+		// the rows of the partition of a hash only have equal keys if the hashes did not collide: verify the
+		// candidates and move on to the next row of the partition if they do not match
+		while (equality_count > 0 && pending_count > 0) {
+			SelectionVector left_sel(STANDARD_VECTOR_SIZE);
+			idx_t candidates[STANDARD_VECTOR_SIZE];
+			for (idx_t i = 0; i < pending_count; i++) {
+				left_sel.set_index(i, pending[i]);
+				candidates[i] = Load<idx_t>(right_entries + right_match[pending[i]] * entry_size + key_size);
+			}
+			state.right_conditions.Reset();
+			gstate.right_conditions.MaterializeHeapChunk(state.right_conditions, candidates, 0, pending_count);
+
+			SelectionVector match_sel(STANDARD_VECTOR_SIZE);
+			SelectionVector next_sel(STANDARD_VECTOR_SIZE);
+			const SelectionVector *current_sel = nullptr;
+			idx_t match_count = pending_count;
+			for (idx_t c = 0; c < equality_count && match_count > 0; c++) {
+				Vector left_vector(state.join_keys.data[c], left_sel, pending_count);
+				match_count = VectorOperations::Equals(left_vector, state.right_conditions.data[c], current_sel,
+				                                       match_count, &next_sel, nullptr);
+				match_sel.Initialize(next_sel);
+				next_sel.Initialize(STANDARD_VECTOR_SIZE);
+				current_sel = &match_sel;
+			}
+			bool verified[STANDARD_VECTOR_SIZE];
+			memset(verified, 0, sizeof(bool) * pending_count);
+			for (idx_t i = 0; i < match_count; i++) {
+				verified[match_sel.get_index(i)] = true;
+			}
+			idx_t remaining_count = 0;
+			for (idx_t i = 0; i < pending_count; i++) {
+				if (verified[i]) {
+					continue;
+				}
+				const auto row = pending[i];
+				auto &candidate = right_match[row];
+				if (search_backward ? candidate == 0 : candidate + 1 == right_count) {
+					candidate = INVALID_INDEX;
+					continue;
+				}
+				candidate = search_backward ? candidate - 1 : candidate + 1;
+				if (memcmp(right_entries + candidate * entry_size, left_keys + row * key_size, hash_size) != 0) {
+					candidate = INVALID_INDEX;
+					continue;
+				}
+				pending[remaining_count++] = row;
+			}
+			pending_count = remaining_count;
+		}
+
+		// construct the result: the matched rows, and for LEFT joins the unmatched rows with NULL values on the RHS
+		SelectionVector result_sel(STANDARD_VECTOR_SIZE);
+		idx_t result_rows[STANDARD_VECTOR_SIZE];
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < count; i++) {
+			if (right_match[i] != INVALID_INDEX || join_type == JoinType::LEFT) {
+				result_sel.set_index(result_count, i);
+				result_rows[result_count++] = right_match[i];
+			}
+		}
+		if (result_count == 0) {
+			continue;
+		}
+		idx_t gather_rows[STANDARD_VECTOR_SIZE];
+		for (idx_t i = 0; i < result_count; i++) {
+			gather_rows[i] = result_rows[i] == INVALID_INDEX
+			                     ? 0
+			                     : Load<idx_t>(right_entries + result_rows[i] * entry_size + key_size);
+		}
+		state.right_payload.Reset();
+		gstate.right_chunks.MaterializeHeapChunk(state.right_payload, gather_rows, 0, result_count);
+		for (idx_t i = 0; i < result_count; i++) {
+			if (result_rows[i] != INVALID_INDEX) {
+				continue;
+			}
+			for (idx_t c = 0; c < state.right_payload.ColumnCount(); c++) {
+				FlatVector::SetNull(state.right_payload.data[c], i, true);
+			}
+		}
+		chunk.Slice(state.child_chunk, result_sel, result_count);
+		for (idx_t c = 0; c < state.right_payload.ColumnCount(); c++) {
+			chunk.data[left_columns + c].Reference(state.right_payload.data[c]);
+		}
+	} while (chunk.size() == 0);
+}
+
+unique_ptr<PhysicalOperatorState> PhysicalAsOfJoin::GetOperatorState() {
+	return make_unique<PhysicalAsOfJoinState>(*this, children[0].get(), conditions, key_size);
+}
+
+void PhysicalAsOfJoin::FinalizeOperatorState(PhysicalOperatorState &state, ExecutionContext &context) {
+	auto &state_p = (PhysicalAsOfJoinState &)state;
+	context.thread.profiler.Flush(this, &state_p.lhs_executor, "lhs_executor", 0);
+	if (!children.empty() && state.child_state) {
+		children[0]->FinalizeOperatorState(*state.child_state, context);
+	}
+}
+
+} // namespace duckdb
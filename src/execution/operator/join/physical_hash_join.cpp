@@ -1,4 +1,6 @@
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -7,6 +9,11 @@
 #include "duckdb/function/aggregate/distributive_functions.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
 
 namespace duckdb {
 
@@ -45,6 +52,11 @@ public:
 	DataChunk build_chunk;
 	DataChunk join_keys;
 	ExpressionExecutor build_executor;
+	//! The thread-local HT the rows are collected in, merged into the global HT in Combine
+	unique_ptr<JoinHashTable> hash_table;
+	//! The range of the build keys of the conditions with a runtime filter
+	vector<Value> key_min;
+	vector<Value> key_max;
 };
 
 class HashJoinGlobalState : public GlobalOperatorState {
@@ -56,12 +68,170 @@ public:
 	unique_ptr<JoinHashTable> hash_table;
 	//! Only used for FULL OUTER JOIN: scan state of the final scan to find unmatched tuples in the build-side
 	JoinHTScanState ht_scan_state;
+	//! The range of the build keys of the conditions with a runtime filter
+	mutex key_lock;
+	vector<Value> key_min;
+	vector<Value> key_max;
 };
 
+//! The amount of memory the hash table of a join can use before it is partitioned and spilled to disk
+static idx_t GetMemoryBudget(ClientContext &context) {
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	if (buffer_manager.GetTemporaryDirectory().empty()) {
+		// without a temporary directory the partitions cannot be spilled, so partitioning does not save any memory
+		return INVALID_INDEX;
+	}
+	idx_t memory_limit = buffer_manager.GetMaxMemory();
+	memory_limit = MinValue<idx_t>(memory_limit, context.memory_tracker->GetLimit());
+	memory_limit = MinValue<idx_t>(memory_limit, context.query_memory_tracker->GetLimit());
+	// leave room for the probe side and for the other operators of the query
+	return memory_limit / 2;
+}
+
+//===--------------------------------------------------------------------===//
+// Runtime Filters
+//===--------------------------------------------------------------------===//
+void PhysicalHashJoin::RegisterRuntimeFilters() {
+	runtime_filter_conditions.resize(conditions.size(), false);
+	if (join_type != JoinType::INNER && join_type != JoinType::SEMI && join_type != JoinType::RIGHT) {
+		// the probe rows without a match are part of the result
+		return;
+	}
+	for (idx_t i = 0; i < conditions.size(); i++) {
+		auto &condition = conditions[i];
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL || condition.null_values_are_equal ||
+		    condition.left->type != ExpressionType::BOUND_REF) {
+			continue;
+		}
+		idx_t column_index = ((BoundReferenceExpression &)*condition.left).index;
+		auto scan = PhysicalTableScan::FindRuntimeFilterScan(children[0].get(), column_index);
+		if (!scan) {
+			continue;
+		}
+		scan->AddRuntimeFilter(this, i, column_index);
+		runtime_filter_conditions[i] = true;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateKeyRange(Vector &keys, idx_t count, Value &min, Value &max) {
+	VectorData vdata;
+	keys.Orrify(count, vdata);
+	auto data = (T *)vdata.data;
+	T min_value, max_value;
+	idx_t min_row = INVALID_INDEX;
+	idx_t max_row = INVALID_INDEX;
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		if (min_row == INVALID_INDEX || data[idx] < min_value) {
+			min_value = data[idx];
+			min_row = i;
+		}
+		if (max_row == INVALID_INDEX || data[idx] > max_value) {
+			max_value = data[idx];
+			max_row = i;
+		}
+	}
+	if (min_row == INVALID_INDEX) {
+		// only NULL values
+		return;
+	}
+	auto chunk_min = keys.GetValue(min_row);
+	auto chunk_max = keys.GetValue(max_row);
+	if (min.is_null || chunk_min < min) {
+		min = chunk_min;
+	}
+	if (max.is_null || chunk_max > max) {
+		max = chunk_max;
+	}
+}
+
+//! Widen the range [min, max] to include the given keys; the range is only kept for integral keys
+static void UpdateKeyRange(Vector &keys, idx_t count, Value &min, Value &max) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateKeyRange<int8_t>(keys, count, min, max);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateKeyRange<int16_t>(keys, count, min, max);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateKeyRange<int32_t>(keys, count, min, max);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateKeyRange<int64_t>(keys, count, min, max);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateKeyRange<hugeint_t>(keys, count, min, max);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateKeyRange<uint8_t>(keys, count, min, max);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateKeyRange<uint16_t>(keys, count, min, max);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateKeyRange<uint32_t>(keys, count, min, max);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateKeyRange<uint64_t>(keys, count, min, max);
+		break;
+	default:
+		break;
+	}
+}
+
+unique_ptr<TableFilter> PhysicalHashJoin::GetRuntimeFilter(idx_t condition_idx) const {
+	if (!sink_state) {
+		return nullptr;
+	}
+	auto &sink = (HashJoinGlobalState &)*sink_state;
+	auto result = make_unique<ConjunctionAndFilter>();
+	auto &min = sink.key_min[condition_idx];
+	auto &max = sink.key_max[condition_idx];
+	if (!min.is_null) {
+		result->child_filters.push_back(make_unique<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, min));
+		result->child_filters.push_back(make_unique<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, max));
+	}
+	auto &hash_table = *sink.hash_table;
+	if (condition_idx == 0 && hash_table.finalized && hash_table.bloom_filter) {
+		result->child_filters.push_back(make_unique<BloomFilter>(hash_table.bloom_filter));
+	}
+	if (result->child_filters.empty()) {
+		return nullptr;
+	}
+	if (result->child_filters.size() == 1) {
+		return move(result->child_filters[0]);
+	}
+	return move(result);
+}
+
+bool PhysicalHashJoin::IsCorrelatedMarkJoin() const {
+	return !delim_types.empty() && join_type == JoinType::MARK && delim_types.size() + 1 == conditions.size();
+}
+
 unique_ptr<GlobalOperatorState> PhysicalHashJoin::GetGlobalState(ClientContext &context) {
 	auto state = make_unique<HashJoinGlobalState>();
 	state->hash_table =
 	    make_unique<JoinHashTable>(BufferManager::GetBufferManager(context), conditions, build_types, join_type);
+	state->hash_table->SetMemoryBudget(GetMemoryBudget(context));
+	if (runtime_filter_conditions.empty()) {
+		// the probe side is part of the pipeline that depends on this sink, so the filters are known before it runs
+		RegisterRuntimeFilters();
+	}
+	idx_t equality_count = 0;
+	for (auto &condition : conditions) {
+		if (condition.comparison == ExpressionType::COMPARE_EQUAL) {
+			equality_count++;
+		}
+	}
+	// the HT hashes the equality keys only: the hashes can only be used for a Bloom filter if there is a single one
+	state->hash_table->build_bloom_filter = equality_count == 1 && runtime_filter_conditions[0];
+	state->key_min.resize(conditions.size());
+	state->key_max.resize(conditions.size());
 	if (!delim_types.empty() && join_type == JoinType::MARK) {
 		// correlated MARK join
 		if (delim_types.size() + 1 == conditions.size()) {
@@ -114,6 +284,21 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 		state->build_executor.AddExpression(*cond.right);
 	}
 	state->join_keys.Initialize(condition_types);
+	state->key_min.resize(conditions.size());
+	state->key_max.resize(conditions.size());
+	if (!IsCorrelatedMarkJoin()) {
+		// the rows are collected in a thread-local HT, the correlated counts of a correlated MARK join are kept
+		// in the global HT only
+		auto &client = context.client;
+		state->hash_table =
+		    make_unique<JoinHashTable>(BufferManager::GetBufferManager(client), conditions, build_types, join_type);
+		auto memory_budget = GetMemoryBudget(client);
+		if (memory_budget != INVALID_INDEX) {
+			// the threads share the budget of the join
+			memory_budget /= MaxValue<idx_t>(TaskScheduler::GetScheduler(client).NumberOfThreads(), 1);
+		}
+		state->hash_table->SetMemoryBudget(memory_budget);
+	}
 	return move(state);
 }
 
@@ -121,8 +306,14 @@ void PhysicalHashJoin::Sink(ExecutionContext &context, GlobalOperatorState &stat
                             DataChunk &input) const {
 	auto &sink = (HashJoinGlobalState &)state;
 	auto &lstate = (HashJoinLocalState &)lstate_p;
+	auto &hash_table = lstate.hash_table ? *lstate.hash_table : *sink.hash_table;
 	// resolve the join keys for the right chunk
 	lstate.build_executor.Execute(input, lstate.join_keys);
+	for (idx_t i = 0; i < conditions.size(); i++) {
+		if (runtime_filter_conditions[i]) {
+			UpdateKeyRange(lstate.join_keys.data[i], lstate.join_keys.size(), lstate.key_min[i], lstate.key_max[i]);
+		}
+	}
 	// build the HT
 	if (!right_projection_map.empty()) {
 		// there is a projection map: fill the build chunk with the projected columns
@@ -131,26 +322,70 @@ void PhysicalHashJoin::Sink(ExecutionContext &context, GlobalOperatorState &stat
 		for (idx_t i = 0; i < right_projection_map.size(); i++) {
 			lstate.build_chunk.data[i].Reference(input.data[right_projection_map[i]]);
 		}
-		sink.hash_table->Build(lstate.join_keys, lstate.build_chunk);
+		hash_table.Build(lstate.join_keys, lstate.build_chunk);
 	} else if (!build_types.empty()) {
 		// there is not a projected map: place the entire right chunk in the HT
-		sink.hash_table->Build(lstate.join_keys, input);
+		hash_table.Build(lstate.join_keys, input);
 	} else {
 		// there are only keys: place an empty chunk in the payload
 		lstate.build_chunk.SetCardinality(input.size());
-		sink.hash_table->Build(lstate.join_keys, lstate.build_chunk);
+		hash_table.Build(lstate.join_keys, lstate.build_chunk);
 	}
 }
 
 //===--------------------------------------------------------------------===//
 // Finalize
 //===--------------------------------------------------------------------===//
+class HashJoinFinalizeTask : public Task {
+public:
+	HashJoinFinalizeTask(Pipeline &parent_p, JoinHashTable &hash_table_p, idx_t block_start_p, idx_t block_end_p)
+	    : parent(parent_p), hash_table(hash_table_p), block_start(block_start_p), block_end(block_end_p) {
+	}
+
+	void Execute() override {
+		hash_table.InsertBlocks(block_start, block_end, true);
+		auto total_tasks = parent.total_tasks.load();
+		auto finished_tasks = ++parent.finished_tasks;
+		// finish the whole pipeline
+		if (total_tasks == finished_tasks) {
+			hash_table.finalized = true;
+			parent.Finish();
+		}
+	}
+
+private:
+	Pipeline &parent;
+	JoinHashTable &hash_table;
+	idx_t block_start;
+	idx_t block_end;
+};
+
 bool PhysicalHashJoin::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
 	auto &sink = (HashJoinGlobalState &)*state;
-	sink.hash_table->Finalize();
-
+	auto &hash_table = *sink.hash_table;
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	idx_t num_threads = scheduler.NumberOfThreads();
+	if (hash_table.IsExternal() || num_threads <= 1 || hash_table.size() < PARALLEL_FINALIZE_THRESHOLD) {
+		// construct the hash map in this thread
+		hash_table.Finalize();
+		PhysicalSink::Finalize(pipeline, context, move(state));
+		return true;
+	}
+	// schedule tasks that insert disjoint ranges of blocks into the hash map
+	hash_table.InitializeHashMap();
 	PhysicalSink::Finalize(pipeline, context, move(state));
-	return true;
+
+	idx_t block_count = hash_table.BlockCount();
+	idx_t num_tasks = MinValue<idx_t>(num_threads, block_count);
+	idx_t blocks_per_task = (block_count + num_tasks - 1) / num_tasks;
+	num_tasks = (block_count + blocks_per_task - 1) / blocks_per_task;
+	pipeline.total_tasks += num_tasks;
+	for (idx_t block_start = 0; block_start < block_count; block_start += blocks_per_task) {
+		auto block_end = MinValue<idx_t>(block_start + blocks_per_task, block_count);
+		auto new_task = make_unique<HashJoinFinalizeTask>(pipeline, hash_table, block_start, block_end);
+		scheduler.ScheduleTask(pipeline.token, move(new_task));
+	}
+	return false;
 }
 
 //===--------------------------------------------------------------------===//
@@ -167,6 +402,8 @@ public:
 	DataChunk join_keys;
 	ExpressionExecutor probe_executor;
 	unique_ptr<JoinHashTable::ScanStructure> scan_structure;
+	//! Whether or not the probe side has been consumed and the spilled probe rows of a partitioned HT are probed
+	bool probe_spilled = false;
 };
 
 unique_ptr<PhysicalOperatorState> PhysicalHashJoin::GetOperatorState() {
@@ -187,7 +424,7 @@ void PhysicalHashJoin::GetChunkInternal(ExecutionContext &context, DataChunk &ch
 	    (sink.hash_table->join_type == JoinType::INNER || sink.hash_table->join_type == JoinType::RIGHT ||
 	     sink.hash_table->join_type == JoinType::SEMI);
 
-	if (sink.hash_table->size() == 0 && join_is_inner_right_semi) {
+	if (sink.hash_table->TotalCount() == 0 && join_is_inner_right_semi) {
 		// empty hash table with INNER, RIGHT or SEMI join means empty result set
 		return;
 	}
@@ -204,6 +441,17 @@ void PhysicalHashJoin::GetChunkInternal(ExecutionContext &context, DataChunk &ch
 			    if (IsRightOuterJoin(join_type)) {
 				// check if we need to scan any unmatched tuples from the RHS for the full/right outer join
 				sink.hash_table->ScanFullOuter(chunk, sink.ht_scan_state);
+				if (chunk.size() > 0) {
+					return;
+				}
+			}
+			if (sink.hash_table->IsExternal() && sink.hash_table->PrepareNextPartitions()) {
+				// the HT is partitioned: join the next group of spilled partitions
+				state->probe_spilled = true;
+				state->scan_structure = nullptr;
+				sink.ht_scan_state.position = 0;
+				sink.ht_scan_state.block_position = 0;
+				continue;
 			}
 			return;
 		} else {
@@ -247,23 +495,47 @@ void PhysicalHashJoin::ProbeHashTable(ExecutionContext &context, DataChunk &chun
 
 	// probe the HT
 	do {
-		// fetch the chunk from the left side
-		children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
-		if (state->child_chunk.size() == 0) {
-			return;
-		}
-		if (sink.hash_table->size() == 0) {
-			ConstructEmptyJoinResult(sink.hash_table->join_type, sink.hash_table->has_null, state->child_chunk, chunk);
-			return;
+		if (state->probe_spilled) {
+			// fetch the next chunk of spilled probe rows (together with their join keys)
+			if (!sink.hash_table->ScanSpilledProbe(state->join_keys, state->child_chunk)) {
+				state->child_chunk.SetCardinality(0);
+				return;
+			}
+		} else {
+			// fetch the chunk from the left side
+			children[0]->GetChunk(context, state->child_chunk, state->child_state.get());
+			if (state->child_chunk.size() == 0) {
+				return;
+			}
+			if (sink.hash_table->TotalCount() == 0) {
+				ConstructEmptyJoinResult(sink.hash_table->join_type, sink.hash_table->has_null, state->child_chunk,
+				                         chunk);
+				return;
+			}
+			// resolve the join keys for the left chunk
+			state->probe_executor.Execute(state->child_chunk, state->join_keys);
+			if (sink.hash_table->IsExternal()) {
+				// the rows of partitions that are not in the HT are probed after the left side has been consumed
+				sink.hash_table->SpillProbe(state->join_keys, state->child_chunk);
+				if (state->child_chunk.size() == 0) {
+					continue;
+				}
+			}
 		}
-		// resolve the join keys for the left chunk
-		state->probe_executor.Execute(state->child_chunk, state->join_keys);
 
 		// perform the actual probe
 		state->scan_structure = sink.hash_table->Probe(state->join_keys);
 		state->scan_structure->Next(state->join_keys, state->child_chunk, chunk);
 	} while (chunk.size() == 0);
 }
+bool PhysicalHashJoin::IsExternal() {
+	if (!sink_state) {
+		return false;
+	}
+	auto &sink = (HashJoinGlobalState &)*sink_state;
+	return sink.hash_table->IsExternal();
+}
+
 void PhysicalHashJoin::FinalizeOperatorState(PhysicalOperatorState &state, ExecutionContext &context) {
 	auto &state_p = reinterpret_cast<PhysicalHashJoinState &>(state);
 	context.thread.profiler.Flush(this, &state_p.probe_executor, "probe_executor", 0);
@@ -273,6 +545,26 @@ void PhysicalHashJoin::FinalizeOperatorState(PhysicalOperatorState &state, Execu
 }
 void PhysicalHashJoin::Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) {
 	auto &state = (HashJoinLocalState &)lstate;
+	auto &sink = (HashJoinGlobalState &)gstate;
+	if (state.hash_table) {
+		sink.hash_table->Merge(*state.hash_table);
+	}
+	{
+		lock_guard<mutex> guard(sink.key_lock);
+		for (idx_t i = 0; i < conditions.size(); i++) {
+			auto &min = state.key_min[i];
+			auto &max = state.key_max[i];
+			if (min.is_null) {
+				continue;
+			}
+			if (sink.key_min[i].is_null || min < sink.key_min[i]) {
+				sink.key_min[i] = min;
+			}
+			if (sink.key_max[i].is_null || max > sink.key_max[i]) {
+				sink.key_max[i] = max;
+			}
+		}
+	}
 	context.thread.profiler.Flush(this, &state.build_executor, "build_executor", 1);
 	context.client.profiler->Flush(context.thread.profiler);
 }
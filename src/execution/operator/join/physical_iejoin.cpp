@@ -0,0 +1,543 @@
+#include "duckdb/execution/operator/join/physical_iejoin.hpp"
+
+#include "duckdb/common/row_operations/row_operations.hpp"
+#include "duckdb/common/types/chunk_collection.hpp"
+#include "duckdb/common/types/row_data_collection.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+namespace duckdb {
+
+PhysicalIEJoin::PhysicalIEJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left,
+                               unique_ptr<PhysicalOperator> right, vector<JoinCondition> cond, JoinType join_type,
+                               idx_t estimated_cardinality)
+    : PhysicalComparisonJoin(op, PhysicalOperatorType::IE_JOIN, move(cond), join_type, estimated_cardinality) {
+	D_ASSERT(CanJoin(join_type, conditions));
+	for (auto &cond : conditions) {
+		join_key_types.push_back(cond.left->return_type);
+	}
+	children.push_back(move(left));
+	children.push_back(move(right));
+}
+
+bool PhysicalIEJoin::CanJoin(JoinType join_type, const vector<JoinCondition> &conditions) {
+	if (join_type != JoinType::INNER || conditions.size() != 2) {
+		return false;
+	}
+	for (auto &cond : conditions) {
+		switch (cond.comparison) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			break;
+		default:
+			return false;
+		}
+		if (cond.left->return_type != cond.right->return_type) {
+			return false;
+		}
+		// the keys are compared in their memcmp-able sorting representation, which has to be complete
+		switch (cond.left->return_type.InternalType()) {
+		case PhysicalType::BOOL:
+		case PhysicalType::INT8:
+		case PhysicalType::INT16:
+		case PhysicalType::INT32:
+		case PhysicalType::INT64:
+		case PhysicalType::INT128:
+		case PhysicalType::UINT8:
+		case PhysicalType::UINT16:
+		case PhysicalType::UINT32:
+		case PhysicalType::UINT64:
+		case PhysicalType::FLOAT:
+		case PhysicalType::DOUBLE:
+			break;
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Sorted Tables
+//===--------------------------------------------------------------------===//
+//! The keys of the rows of a block with the smallest and largest key of both conditions
+struct IEJoinBlockStats {
+	idx_t min_row[2];
+	idx_t max_row[2];
+};
+
+//! The rows of one side of the join, sorted on the key of the first condition. Rows with a NULL key can not have any
+//! matches and are left out. The keys are serialized into the memcmp-able representation of PhysicalOrder, so they
+//! are compared with memcmp. Block i of the table consists of the rows in chunk i of the payload.
+class IEJoinSortedTable {
+public:
+	IEJoinSortedTable(BufferManager &buffer_manager, ChunkCollection &input, ChunkCollection &input_keys);
+
+	idx_t BlockCount() const {
+		return payload.ChunkCount();
+	}
+	data_ptr_t GetKey(idx_t cond_idx, idx_t row) const {
+		return keys[cond_idx].get() + row * key_sizes[cond_idx];
+	}
+
+	//! The payload of the rows in sorted order
+	ChunkCollection payload;
+	//! The amount of rows
+	idx_t count;
+	//! The size of the serialized keys of both conditions
+	idx_t key_sizes[2];
+	//! The serialized keys of both conditions in sorted order
+	unique_ptr<data_t[]> keys[2];
+	//! The statistics of every block
+	vector<IEJoinBlockStats> stats;
+};
+
+IEJoinSortedTable::IEJoinSortedTable(BufferManager &buffer_manager, ChunkCollection &input,
+                                     ChunkCollection &input_keys)
+    : count(0) {
+	D_ASSERT(input_keys.ColumnCount() == 2);
+	for (idx_t c = 0; c < 2; c++) {
+		key_sizes[c] = GetTypeIdSize(input_keys.Types()[c].InternalType()) + 1;
+	}
+	if (input.Count() == 0) {
+		return;
+	}
+	// every row takes both keys, followed by the row index
+	const idx_t entry_size = key_sizes[0] + key_sizes[1] + sizeof(idx_t);
+	const auto block_capacity =
+	    MaxValue<idx_t>(input.Count(), (Storage::BLOCK_ALLOC_SIZE + entry_size - 1) / entry_size);
+	RowDataCollection rows(buffer_manager, block_capacity, entry_size);
+	data_ptr_t key_locations[STANDARD_VECTOR_SIZE];
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t row_idx = 0;
+	for (idx_t chunk_idx = 0; chunk_idx < input_keys.ChunkCount(); chunk_idx++) {
+		auto &key_chunk = input_keys.GetChunk(chunk_idx);
+		const auto chunk_size = key_chunk.size();
+		VectorData key_data[2];
+		for (idx_t c = 0; c < 2; c++) {
+			key_chunk.data[c].Orrify(chunk_size, key_data[c]);
+		}
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < chunk_size; i++) {
+			if (key_data[0].validity.RowIsValid(key_data[0].sel->get_index(i)) &&
+			    key_data[1].validity.RowIsValid(key_data[1].sel->get_index(i))) {
+				sel.set_index(valid_count++, i);
+			}
+		}
+		if (valid_count > 0) {
+			rows.Build(valid_count, key_locations, nullptr);
+			for (idx_t c = 0; c < 2; c++) {
+				rows.SerializeVectorSortable(key_chunk.data[c], chunk_size, sel, valid_count, key_locations, false,
+				                             true, true, 0);
+			}
+			// the key locations now point to the row index
+			for (idx_t i = 0; i < valid_count; i++) {
+				Store<idx_t>(row_idx + sel.get_index(i), key_locations[i]);
+			}
+			count += valid_count;
+		}
+		row_idx += chunk_size;
+	}
+	if (count == 0) {
+		return;
+	}
+	D_ASSERT(rows.blocks.size() == 1);
+	auto handle = buffer_manager.Pin(rows.blocks[0].block);
+	const auto row_ptr = handle->Ptr();
+
+	RowOperations::RadixSort(buffer_manager, row_ptr, count, 0, key_sizes[0], entry_size);
+
+	auto order = unique_ptr<idx_t[]>(new idx_t[count]);
+	for (idx_t c = 0; c < 2; c++) {
+		keys[c] = unique_ptr<data_t[]>(new data_t[count * key_sizes[c]]);
+	}
+	for (idx_t i = 0; i < count; i++) {
+		auto entry = row_ptr + i * entry_size;
+		memcpy(keys[0].get() + i * key_sizes[0], entry, key_sizes[0]);
+		memcpy(keys[1].get() + i * key_sizes[1], entry + key_sizes[0], key_sizes[1]);
+		order[i] = Load<idx_t>(entry + key_sizes[0] + key_sizes[1]);
+	}
+	handle.reset();
+
+	// gather the payload in sorted order
+	for (idx_t position = 0; position < count;) {
+		DataChunk chunk;
+		chunk.Initialize(input.Types());
+		position = input.MaterializeHeapChunk(chunk, order.get(), position, count);
+		payload.Append(chunk);
+	}
+
+	// the table is sorted on the first key, the second key has to be searched
+	for (idx_t block_start = 0; block_start < count; block_start += STANDARD_VECTOR_SIZE) {
+		const idx_t block_end = MinValue<idx_t>(block_start + STANDARD_VECTOR_SIZE, count);
+		IEJoinBlockStats block_stats;
+		block_stats.min_row[0] = block_start;
+		block_stats.max_row[0] = block_end - 1;
+		block_stats.min_row[1] = block_start;
+		block_stats.max_row[1] = block_start;
+		for (idx_t i = block_start + 1; i < block_end; i++) {
+			if (memcmp(GetKey(1, i), GetKey(1, block_stats.min_row[1]), key_sizes[1]) < 0) {
+				block_stats.min_row[1] = i;
+			}
+			if (memcmp(GetKey(1, i), GetKey(1, block_stats.max_row[1]), key_sizes[1]) > 0) {
+				block_stats.max_row[1] = i;
+			}
+		}
+		stats.push_back(block_stats);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// IEJoin
+//===--------------------------------------------------------------------===//
+static bool CompareKeys(ExpressionType comparison, data_ptr_t left, data_ptr_t right, idx_t key_size) {
+	auto cmp = memcmp(left, right, key_size);
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		return cmp < 0;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return cmp <= 0;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return cmp > 0;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return cmp >= 0;
+	default:
+		throw InternalException("Unsupported comparison type for IEJoin");
+	}
+}
+
+static bool IsStrictComparison(ExpressionType comparison) {
+	return comparison == ExpressionType::COMPARE_LESSTHAN || comparison == ExpressionType::COMPARE_GREATERTHAN;
+}
+
+static bool IsLessThanComparison(ExpressionType comparison) {
+	return comparison == ExpressionType::COMPARE_LESSTHAN || comparison == ExpressionType::COMPARE_LESSTHANOREQUALTO;
+}
+
+//! Orders the rows of the union of a left and a right block on one of the keys. The rows [0, left_count) of the
+//! union are the rows of the left block, the other rows are the rows of the right block.
+struct IEJoinUnionOrder {
+	IEJoinUnionOrder(data_ptr_t left_keys, data_ptr_t right_keys, idx_t key_size, idx_t left_count, bool descending,
+	                 bool right_first)
+	    : left_keys(left_keys), right_keys(right_keys), key_size(key_size), left_count(left_count),
+	      descending(descending), right_first(right_first) {
+	}
+
+	data_ptr_t GetKey(idx_t row) const {
+		return row < left_count ? left_keys + row * key_size : right_keys + (row - left_count) * key_size;
+	}
+
+	bool operator()(const idx_t &lhs, const idx_t &rhs) const {
+		auto cmp = memcmp(GetKey(lhs), GetKey(rhs), key_size);
+		if (cmp != 0) {
+			return descending ? cmp > 0 : cmp < 0;
+		}
+		// equal keys: the order of the sides decides whether or not rows with equal keys match
+		bool lhs_right = lhs >= left_count;
+		bool rhs_right = rhs >= left_count;
+		if (lhs_right != rhs_right) {
+			return right_first ? lhs_right : rhs_right;
+		}
+		return lhs < rhs;
+	}
+
+	data_ptr_t left_keys;
+	data_ptr_t right_keys;
+	idx_t key_size;
+	idx_t left_count;
+	bool descending;
+	bool right_first;
+};
+
+//! Finds the pairs of rows of a left and a right block that satisfy both conditions
+static void IEJoinBlocks(const IEJoinSortedTable &left, idx_t left_block, const IEJoinSortedTable &right,
+                         idx_t right_block, const vector<JoinCondition> &conditions, vector<sel_t> &left_matches,
+                         vector<sel_t> &right_matches) {
+	auto &left_stats = left.stats[left_block];
+	auto &right_stats = right.stats[right_block];
+	// check whether none or all of the pairs of rows can satisfy the conditions
+	bool all_match = true;
+	for (idx_t c = 0; c < 2; c++) {
+		auto comparison = conditions[c].comparison;
+		auto less_than = IsLessThanComparison(comparison);
+		auto some_left = left.GetKey(c, less_than ? left_stats.min_row[c] : left_stats.max_row[c]);
+		auto some_right = right.GetKey(c, less_than ? right_stats.max_row[c] : right_stats.min_row[c]);
+		if (!CompareKeys(comparison, some_left, some_right, left.key_sizes[c])) {
+			return;
+		}
+		auto all_left = left.GetKey(c, less_than ? left_stats.max_row[c] : left_stats.min_row[c]);
+		auto all_right = right.GetKey(c, less_than ? right_stats.min_row[c] : right_stats.max_row[c]);
+		if (!CompareKeys(comparison, all_left, all_right, left.key_sizes[c])) {
+			all_match = false;
+		}
+	}
+	const idx_t left_start = left_block * STANDARD_VECTOR_SIZE;
+	const idx_t right_start = right_block * STANDARD_VECTOR_SIZE;
+	const idx_t left_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, left.count - left_start);
+	const idx_t right_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, right.count - right_start);
+	if (all_match) {
+		for (idx_t l = 0; l < left_count; l++) {
+			for (idx_t r = 0; r < right_count; r++) {
+				left_matches.push_back(l);
+				right_matches.push_back(r);
+			}
+		}
+		return;
+	}
+
+	// L1: the union ordered on the first key, so that the rows that satisfy the first condition for a left row come
+	// after it. Rows with equal keys satisfy the condition only if it is not strict.
+	const idx_t count = left_count + right_count;
+	auto first = conditions[0].comparison;
+	vector<idx_t> l1(count);
+	std::iota(l1.begin(), l1.end(), 0);
+	std::sort(l1.begin(), l1.end(),
+	          IEJoinUnionOrder(left.GetKey(0, left_start), right.GetKey(0, right_start), left.key_sizes[0],
+	                           left_count, !IsLessThanComparison(first), IsStrictComparison(first)));
+	vector<idx_t> l1_position(count);
+	for (idx_t i = 0; i < count; i++) {
+		l1_position[l1[i]] = i;
+	}
+
+	// L2: the union ordered on the second key, so that the rows that satisfy the second condition for a left row
+	// come before it
+	auto second = conditions[1].comparison;
+	vector<idx_t> l2(count);
+	std::iota(l2.begin(), l2.end(), 0);
+	std::sort(l2.begin(), l2.end(),
+	          IEJoinUnionOrder(left.GetKey(1, left_start), right.GetKey(1, right_start), left.key_sizes[1],
+	                           left_count, IsLessThanComparison(second), !IsStrictComparison(second)));
+
+	// visit the rows in the order of L2: set the bit of every right row at its position in L1, and emit the right
+	// rows with a bit that is set after the position of every left row
+	const idx_t word_count = (count + 63) / 64;
+	vector<uint64_t> bits(word_count, 0);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = l2[i];
+		auto position = l1_position[row];
+		if (row >= left_count) {
+			bits[position / 64] |= uint64_t(1) << (position % 64);
+			continue;
+		}
+		const idx_t start = position + 1;
+		for (idx_t word_idx = start / 64; word_idx < word_count; word_idx++) {
+			auto word = bits[word_idx];
+			if (word_idx == start / 64) {
+				word &= ~uint64_t(0) << (start % 64);
+			}
+			for (idx_t bit = 0; word; bit++, word >>= 1) {
+				if (word & 1) {
+					left_matches.push_back(row);
+					right_matches.push_back(l1[word_idx * 64 + bit] - left_count);
+				}
+			}
+		}
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class IEJoinLocalState : public LocalSinkState {
+public:
+	explicit IEJoinLocalState(const vector<JoinCondition> &conditions) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			rhs_executor.AddExpression(*cond.right);
+			condition_types.push_back(cond.right->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	//! The chunk holding the right condition
+	DataChunk join_keys;
+	//! The executor of the RHS condition
+	ExpressionExecutor rhs_executor;
+	//! The materialized data of the RHS sunk by this thread
+	ChunkCollection right_chunks;
+	//! The materialized join keys of the RHS sunk by this thread
+	ChunkCollection right_conditions;
+};
+
+class IEJoinGlobalState : public GlobalOperatorState {
+public:
+	mutex lock;
+	//! The materialized data of the RHS
+	ChunkCollection right_chunks;
+	//! The materialized join keys of the RHS
+	ChunkCollection right_conditions;
+	//! The sorted RHS
+	unique_ptr<IEJoinSortedTable> right_table;
+};
+
+unique_ptr<GlobalOperatorState> PhysicalIEJoin::GetGlobalState(ClientContext &context) {
+	return make_unique<IEJoinGlobalState>();
+}
+
+unique_ptr<LocalSinkState> PhysicalIEJoin::GetLocalSinkState(ExecutionContext &context) {
+	return make_unique<IEJoinLocalState>(conditions);
+}
+
+void PhysicalIEJoin::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+                          DataChunk &input) const {
+	auto &ie_state = (IEJoinLocalState &)lstate;
+
+	// resolve the join keys for this chunk
+	ie_state.rhs_executor.SetChunk(input);
+
+	ie_state.join_keys.Reset();
+	ie_state.join_keys.SetCardinality(input);
+	for (idx_t k = 0; k < conditions.size(); k++) {
+		ie_state.rhs_executor.ExecuteExpression(k, ie_state.join_keys.data[k]);
+	}
+	ie_state.right_chunks.Append(input);
+	ie_state.right_conditions.Append(ie_state.join_keys);
+}
+
+void PhysicalIEJoin::Combine(ExecutionContext &context, GlobalOperatorState &gstate_p, LocalSinkState &lstate) {
+	auto &gstate = (IEJoinGlobalState &)gstate_p;
+	auto &state = (IEJoinLocalState &)lstate;
+	{
+		// both collections were appended the same chunks, so they are merged in the same order
+		lock_guard<mutex> glock(gstate.lock);
+		gstate.right_chunks.Merge(state.right_chunks);
+		gstate.right_conditions.Merge(state.right_conditions);
+	}
+	context.thread.profiler.Flush(this, &state.rhs_executor, "rhs_executor", 1);
+	context.client.profiler->Flush(context.thread.profiler);
+}
+
+//===--------------------------------------------------------------------===//
+// Finalize
+//===--------------------------------------------------------------------===//
+bool PhysicalIEJoin::Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) {
+	auto &gstate = (IEJoinGlobalState &)*state;
+	gstate.right_table = make_unique<IEJoinSortedTable>(BufferManager::GetBufferManager(context), gstate.right_chunks,
+	                                                    gstate.right_conditions);
+	gstate.right_chunks.Reset();
+	gstate.right_conditions.Reset();
+	PhysicalSink::Finalize(pipeline, context, move(state));
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// GetChunkInternal
+//===--------------------------------------------------------------------===//
+class PhysicalIEJoinState : public PhysicalOperatorState {
+public:
+	PhysicalIEJoinState(PhysicalOperator &op, PhysicalOperator *left, const vector<JoinCondition> &conditions)
+	    : PhysicalOperatorState(op, left), left_block(0), right_block(0), match_left_block(0), match_right_block(0),
+	      match_position(0) {
+		vector<LogicalType> condition_types;
+		for (auto &cond : conditions) {
+			lhs_executor.AddExpression(*cond.left);
+			condition_types.push_back(cond.left->return_type);
+		}
+		join_keys.Initialize(condition_types);
+	}
+
+	DataChunk join_keys;
+	//! The executor of the LHS condition
+	ExpressionExecutor lhs_executor;
+	//! The sorted part of the LHS that is joined by this thread
+	unique_ptr<IEJoinSortedTable> left_table;
+	//! The next pair of blocks to join
+	idx_t left_block;
+	idx_t right_block;
+	//! The pair of blocks of the matches that are being output
+	idx_t match_left_block;
+	idx_t match_right_block;
+	vector<sel_t> left_matches;
+	vector<sel_t> right_matches;
+	idx_t match_position;
+};
+
+void PhysicalIEJoin::GetChunkInternal(ExecutionContext &context, DataChunk &chunk,
+                                      PhysicalOperatorState *state_p) const {
+	auto &state = (PhysicalIEJoinState &)*state_p;
+	auto &gstate = (IEJoinGlobalState &)*sink_state;
+	auto &right_table = *gstate.right_table;
+	if (right_table.count == 0) {
+		// empty RHS (or only NULL keys): empty result
+		return;
+	}
+
+	if (!state.left_table) {
+		// materialize the part of the LHS that is scanned by this thread, and sort it
+		ChunkCollection left_chunks;
+		ChunkCollection left_conditions;
+		while (true) {
+			children[0]->GetChunk(context, state.child_chunk, state.child_state.get());
+			if (state.child_chunk.size() == 0) {
+				break;
+			}
+			state.join_keys.Reset();
+			state.lhs_executor.SetChunk(state.child_chunk);
+			state.join_keys.SetCardinality(state.child_chunk);
+			for (idx_t k = 0; k < conditions.size(); k++) {
+				state.lhs_executor.ExecuteExpression(k, state.join_keys.data[k]);
+			}
+			left_chunks.Append(state.child_chunk);
+			left_conditions.Append(state.join_keys);
+		}
+		state.left_table = make_unique<IEJoinSortedTable>(BufferManager::GetBufferManager(context.client),
+		                                                  left_chunks, left_conditions);
+	}
+	auto &left_table = *state.left_table;
+
+	while (true) {
+		if (state.match_position < state.left_matches.size()) {
+			// output the next batch of matches of the current pair of blocks
+			const idx_t result_count =
+			    MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.left_matches.size() - state.match_position);
+			SelectionVector left_sel(STANDARD_VECTOR_SIZE);
+			SelectionVector right_sel(STANDARD_VECTOR_SIZE);
+			for (idx_t i = 0; i < result_count; i++) {
+				left_sel.set_index(i, state.left_matches[state.match_position + i]);
+				right_sel.set_index(i, state.right_matches[state.match_position + i]);
+			}
+			state.match_position += result_count;
+			chunk.Slice(left_table.payload.GetChunk(state.match_left_block), left_sel, result_count);
+			chunk.Slice(right_table.payload.GetChunk(state.match_right_block), right_sel, result_count,
+			            children[0]->types.size());
+			return;
+		}
+		if (state.left_block >= left_table.BlockCount()) {
+			// joined all pairs of blocks: done
+			return;
+		}
+		if (state.right_block >= right_table.BlockCount()) {
+			// move to the next block on the left side
+			state.left_block++;
+			state.right_block = 0;
+			continue;
+		}
+		state.left_matches.clear();
+		state.right_matches.clear();
+		state.match_position = 0;
+		state.match_left_block = state.left_block;
+		state.match_right_block = state.right_block++;
+		IEJoinBlocks(left_table, state.match_left_block, right_table, state.match_right_block, conditions,
+		             state.left_matches, state.right_matches);
+	}
+}
+
+unique_ptr<PhysicalOperatorState> PhysicalIEJoin::GetOperatorState() {
+	return make_unique<PhysicalIEJoinState>(*this, children[0].get(), conditions);
+}
+
+void PhysicalIEJoin::FinalizeOperatorState(PhysicalOperatorState &state, ExecutionContext &context) {
+	auto &state_p = (PhysicalIEJoinState &)state;
+	context.thread.profiler.Flush(this, &state_p.lhs_executor, "lhs_executor", 0);
+	if (!children.empty() && state.child_state) {
+		children[0]->FinalizeOperatorState(*state.child_state, context);
+	}
+}
+
+} // namespace duckdb
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/order/physical_order.hpp"
 
+#include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_context.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
@@ -79,6 +80,15 @@ public:
 	idx_t r_start;
 };
 
+//! The amount of memory that the sort can use, sorted runs that are not being merged are spilled beyond this limit
+static idx_t GetMemoryLimit(ClientContext &context) {
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	idx_t memory_limit = buffer_manager.GetMaxMemory();
+	memory_limit = MinValue<idx_t>(memory_limit, context.memory_tracker->GetLimit());
+	memory_limit = MinValue<idx_t>(memory_limit, context.query_memory_tracker->GetLimit());
+	return memory_limit;
+}
+
 class OrderLocalState : public LocalSinkState {
 public:
 	OrderLocalState() : initialized(false) {
@@ -145,14 +155,16 @@ public:
 			}
 			size_in_bytes += sizes_block->count * sizeof(idx_t);
 		}
-		// get the max memory and number of threads
-		auto &buffer_manager = BufferManager::GetBufferManager(context);
+		// get the memory limit and number of threads
 		auto &task_scheduler = TaskScheduler::GetScheduler(context);
-		idx_t max_memory = buffer_manager.GetMaxMemory();
+		idx_t memory_limit = GetMemoryLimit(context);
 		idx_t num_threads = task_scheduler.NumberOfThreads();
-		// memory usage per thread should scale with max mem / num threads
-		// we take 10% of the max memory, to be VERY conservative
-		return size_in_bytes > (0.1 * max_memory / num_threads);
+		// memory usage per thread should scale with the memory limit / num threads
+		// we take 10% of the memory limit, to be VERY conservative: the merge pins blocks of up to this size
+		// the sorted runs themselves are unpinned, and are spilled to disk if they do not fit in memory
+		// runs smaller than a block only waste space, so we do not go below that
+		idx_t run_size = MaxValue<idx_t>(0.1 * memory_limit / num_threads, Storage::BLOCK_ALLOC_SIZE);
+		return size_in_bytes > run_size;
 	}
 
 	//! Sorting columns, and variable size sorting data (if any)
@@ -726,9 +738,6 @@ private:
 	const SortingState &sorting_state;
 	const PayloadState &payload_state;
 
-	//! Handle and ptr for sorting_blocks
-	unique_ptr<BufferHandle> sorting_handle;
-
 	idx_t capacity;
 };
 
@@ -989,44 +998,6 @@ static void ComputeTies(data_ptr_t dataptr, const idx_t &count, const idx_t &col
 	ties[count - 1] = false;
 }
 
-//! Textbook LSD radix sort
-static void RadixSort(BufferManager &buffer_manager, data_ptr_t dataptr, const idx_t &count, const idx_t &col_offset,
-                      const idx_t &sorting_size, const SortingState &sorting_state) {
-	auto temp_block =
-	    buffer_manager.Allocate(MaxValue(count * sorting_state.entry_size, (idx_t)Storage::BLOCK_ALLOC_SIZE));
-	data_ptr_t temp = temp_block->Ptr();
-	bool swap = false;
-
-	idx_t counts[256];
-	uint8_t byte;
-	for (idx_t offset = col_offset + sorting_size - 1; offset + 1 > col_offset; offset--) {
-		// init to 0
-		memset(counts, 0, sizeof(counts));
-		// collect counts
-		for (idx_t i = 0; i < count; i++) {
-			byte = *(dataptr + i * sorting_state.entry_size + offset);
-			counts[byte]++;
-		}
-		// compute offsets from counts
-		for (idx_t val = 1; val < 256; val++) {
-			counts[val] = counts[val] + counts[val - 1];
-		}
-		// re-order the data in temporary array
-		for (idx_t i = count; i > 0; i--) {
-			byte = *(dataptr + (i - 1) * sorting_state.entry_size + offset);
-			memcpy(temp + (counts[byte] - 1) * sorting_state.entry_size, dataptr + (i - 1) * sorting_state.entry_size,
-			       sorting_state.entry_size);
-			counts[byte]--;
-		}
-		std::swap(dataptr, temp);
-		swap = !swap;
-	}
-	// move data back to original buffer (if it was swapped)
-	if (swap) {
-		memcpy(temp, dataptr, count * sorting_state.entry_size);
-	}
-}
-
 static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t dataptr, const idx_t &count,
                               const idx_t &col_offset, const idx_t &sorting_size, bool ties[],
                               const SortingState &sorting_state) {
@@ -1041,8 +1012,8 @@ static void SubSortTiedTuples(BufferManager &buffer_manager, const data_ptr_t da
 				break;
 			}
 		}
-		RadixSort(buffer_manager, dataptr + i * sorting_state.entry_size, j - i + 1, col_offset, sorting_size,
-		          sorting_state);
+		RowOperations::RadixSort(buffer_manager, dataptr + i * sorting_state.entry_size, j - i + 1, col_offset,
+		                         sorting_size, sorting_state.entry_size);
 		i = j;
 	}
 }
@@ -1061,7 +1032,7 @@ static void SortInMemory(BufferManager &buffer_manager, SortedBlock &cb, const S
 	}
 
 	if (sorting_state.all_constant) {
-		RadixSort(buffer_manager, dataptr, count, 0, sorting_state.comp_size, sorting_state);
+		RowOperations::RadixSort(buffer_manager, dataptr, count, 0, sorting_state.comp_size, sorting_state.entry_size);
 		return;
 	}
 
@@ -1079,7 +1050,7 @@ static void SortInMemory(BufferManager &buffer_manager, SortedBlock &cb, const S
 
 		if (!ties) {
 			// this is the first sort
-			RadixSort(buffer_manager, dataptr, count, col_offset, sorting_size, sorting_state);
+			RowOperations::RadixSort(buffer_manager, dataptr, count, col_offset, sorting_size, sorting_state.entry_size);
 			ties_handle = buffer_manager.Allocate(MaxValue(count, (idx_t)Storage::BLOCK_ALLOC_SIZE));
 			ties = (bool *)ties_handle->Ptr();
 			std::fill_n(ties, count - 1, true);
@@ -1355,6 +1326,9 @@ public:
 			Merge(*result->payload_data, *left.payload_data, *right.payload_data, next, left_smaller, next_entry_sizes);
 		}
 		D_ASSERT(result->Count() == l_count + r_count);
+		// release the pins on the input runs, only the blocks that are being merged stay in memory
+		left_block = nullptr;
+		right_block = nullptr;
 
 		lock_guard<mutex> glock(state.lock);
 		parent.finished_tasks++;
@@ -1,9 +1,12 @@
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
 
 #include "duckdb/common/assert.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -23,14 +26,20 @@ public:
 	}
 
 	TopNHeap(const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
-	    : limit(limit), offset(offset), heap_size(0) {
+	    : limit(limit), offset(offset), heap_size(0), has_boundary(false), prune_input(true) {
 		for (auto &order : orders) {
 			auto &expr = order.expression;
 			sort_types.push_back(expr->return_type);
 			order_types.push_back(order.type);
 			null_order_types.push_back(order.type == OrderType::DESCENDING ? FlipNullOrder(order.null_order)
 			                                                               : order.null_order);
+			nulls_first.push_back(order.null_order == OrderByNullType::NULLS_FIRST);
 			executor.AddExpression(*expr);
+			auto internal_type = expr->return_type.InternalType();
+			if (internal_type == PhysicalType::STRUCT || internal_type == PhysicalType::LIST) {
+				// nested keys can not be compared with the vectorized comparisons
+				prune_input = false;
+			}
 		}
 		// preallocate the heap
 		heap = unique_ptr<idx_t[]>(new idx_t[limit + offset]);
@@ -42,9 +51,19 @@ public:
 		D_ASSERT(heap_data.Count() == top_data.Count());
 	}
 
-	void Sink(DataChunk &input);
+	//! Appends the rows of the input that sort before the boundary, returns whether or not any rows were appended
+	bool Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to the top rows, returns whether or not the boundary was tightened
+	bool Reduce();
+
+	//! Compares the keys of two rows in the order of the top-n (negative if the left row sorts first)
+	int CompareKeys(const vector<Value> &left, const vector<Value> &right) const;
+	//! Replaces the boundary with the given keys if they sort before the current boundary, returns whether or not the
+	//! boundary was replaced
+	bool TightenBoundary(const vector<Value> &keys);
+	//! Selects the rows of the chunk with keys that sort before the boundary, returns the amount of selected rows
+	idx_t SelectBeforeBoundary(DataChunk &heap_chunk, SelectionVector &result_sel);
 
 	idx_t MaterializeTopChunk(DataChunk &top_chunk, idx_t position) {
 		return top_data.MaterializeHeapChunk(top_chunk, heap.get(), position, heap_size);
@@ -57,20 +76,141 @@ public:
 	vector<LogicalType> sort_types;
 	vector<OrderType> order_types;
 	vector<OrderByNullType> null_order_types;
+	//! Whether or not NULL values sort before all other values of the key (after taking the order type into account)
+	vector<bool> nulls_first;
 	ChunkCollection top_data;
 	ChunkCollection heap_data;
 	unique_ptr<idx_t[]> heap;
+	//! Whether or not a boundary has been found
+	bool has_boundary;
+	//! The keys of the last row of a full heap: rows that do not sort before them can never be part of the result
+	vector<Value> boundary;
+	//! Whether or not a boundary is kept to check input rows against before they are appended
+	bool prune_input;
 };
 
-void TopNHeap::Sink(DataChunk &input) {
+bool TopNHeap::Sink(DataChunk &input) {
 	// compute the ordering values for the new chunk
 	DataChunk heap_chunk;
 	heap_chunk.Initialize(sort_types);
 
 	executor.Execute(input, heap_chunk);
 
+	if (has_boundary) {
+		// only keep the rows that sort before the boundary
+		SelectionVector sel(STANDARD_VECTOR_SIZE);
+		idx_t count = SelectBeforeBoundary(heap_chunk, sel);
+		if (count == 0) {
+			return false;
+		}
+		if (count < input.size()) {
+			DataChunk top_chunk;
+			top_chunk.InitializeEmpty(input.GetTypes());
+			top_chunk.Slice(input, sel, count);
+			heap_chunk.Slice(sel, count);
+			Append(top_chunk, heap_chunk);
+			return true;
+		}
+	}
+
 	// append the new chunk to what we have already
 	Append(input, heap_chunk);
+	return true;
+}
+
+int TopNHeap::CompareKeys(const vector<Value> &left, const vector<Value> &right) const {
+	for (idx_t col_idx = 0; col_idx < left.size(); col_idx++) {
+		auto &left_value = left[col_idx];
+		auto &right_value = right[col_idx];
+		int cmp;
+		if (left_value.is_null || right_value.is_null) {
+			if (left_value.is_null && right_value.is_null) {
+				continue;
+			}
+			// NULL values are not affected by the order type
+			cmp = left_value.is_null == nulls_first[col_idx] ? -1 : 1;
+			return cmp;
+		}
+		if (left_value == right_value) {
+			continue;
+		}
+		cmp = left_value < right_value ? -1 : 1;
+		return order_types[col_idx] == OrderType::DESCENDING ? -cmp : cmp;
+	}
+	return 0;
+}
+
+bool TopNHeap::TightenBoundary(const vector<Value> &keys) {
+	if (has_boundary && CompareKeys(keys, boundary) >= 0) {
+		return false;
+	}
+	boundary = keys;
+	has_boundary = true;
+	return true;
+}
+
+idx_t TopNHeap::SelectBeforeBoundary(DataChunk &heap_chunk, SelectionVector &result_sel) {
+	idx_t result_count = 0;
+	// the rows that are equal to the boundary in all keys compared so far
+	SelectionVector remaining_sel(STANDARD_VECTOR_SIZE);
+	idx_t remaining_count = heap_chunk.size();
+	for (idx_t i = 0; i < remaining_count; i++) {
+		remaining_sel.set_index(i, i);
+	}
+	SelectionVector valid_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector before_sel(STANDARD_VECTOR_SIZE);
+	SelectionVector equal_sel(STANDARD_VECTOR_SIZE);
+	for (idx_t col_idx = 0; col_idx < heap_chunk.ColumnCount() && remaining_count > 0; col_idx++) {
+		auto &keys = heap_chunk.data[col_idx];
+		// NULL keys sort before or after every valid key, and are equal to a NULL boundary
+		VectorData kdata;
+		keys.Orrify(heap_chunk.size(), kdata);
+		auto &bound = boundary[col_idx];
+		bool null_before = !bound.is_null && nulls_first[col_idx];
+		bool valid_before = bound.is_null && !nulls_first[col_idx];
+		idx_t null_count = 0;
+		idx_t valid_count = 0;
+		for (idx_t i = 0; i < remaining_count; i++) {
+			auto idx = remaining_sel.get_index(i);
+			if (kdata.validity.RowIsValid(kdata.sel->get_index(idx))) {
+				valid_sel.set_index(valid_count++, idx);
+			} else if (null_before) {
+				result_sel.set_index(result_count++, idx);
+			} else if (bound.is_null) {
+				remaining_sel.set_index(null_count++, idx);
+			}
+		}
+		if (bound.is_null) {
+			// the valid keys all sort before or after the boundary, only the NULL keys remain
+			if (valid_before) {
+				for (idx_t i = 0; i < valid_count; i++) {
+					result_sel.set_index(result_count++, valid_sel.get_index(i));
+				}
+			}
+			remaining_count = null_count;
+			continue;
+		}
+		if (valid_count == 0) {
+			remaining_count = 0;
+			break;
+		}
+		Vector bound_vector(bound);
+		idx_t before_count;
+		if (order_types[col_idx] == OrderType::DESCENDING) {
+			before_count =
+			    VectorOperations::GreaterThan(keys, bound_vector, &valid_sel, valid_count, &before_sel, &equal_sel);
+		} else {
+			before_count =
+			    VectorOperations::LessThan(keys, bound_vector, &valid_sel, valid_count, &before_sel, &equal_sel);
+		}
+		for (idx_t i = 0; i < before_count; i++) {
+			result_sel.set_index(result_count++, before_sel.get_index(i));
+		}
+		remaining_count = VectorOperations::Equals(keys, bound_vector, &equal_sel, valid_count - before_count,
+		                                           &remaining_sel, nullptr);
+	}
+	// rows that are equal to the boundary in all keys can be left out as well: the heap is already full
+	return result_count;
 }
 
 void TopNHeap::Combine(TopNHeap &other) {
@@ -81,10 +221,10 @@ void TopNHeap::Combine(TopNHeap &other) {
 	}
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	heap_size = (heap_data.Count() > offset) ? MinValue(limit + offset, heap_data.Count()) : 0;
 	if (heap_size == 0) {
-		return;
+		return false;
 	}
 
 	// create the heap
@@ -107,21 +247,42 @@ void TopNHeap::Reduce() {
 	// replace the old data
 	std::swap(top_data, new_top);
 	std::swap(heap_data, new_heap);
+
+	if (!prune_input || heap_size < limit + offset) {
+		return false;
+	}
+	// the heap is full: the keys of its last row are the boundary for new rows
+	vector<Value> keys;
+	for (idx_t col_idx = 0; col_idx < heap_data.ColumnCount(); col_idx++) {
+		keys.push_back(heap_data.GetValue(col_idx, heap_size - 1));
+	}
+	return TightenBoundary(keys);
 }
 
 class TopNGlobalState : public GlobalOperatorState {
 public:
-	TopNGlobalState(const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset) : heap(orders, limit, offset) {
+	TopNGlobalState(const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset,
+	                shared_ptr<DynamicFilterData> dynamic_filter)
+	    : heap(orders, limit, offset), boundary_version(0), dynamic_filter(move(dynamic_filter)) {
 	}
 	mutex lock;
 	TopNHeap heap;
+	//! The tightest boundary found by any of the threads (protected by the lock)
+	vector<Value> boundary;
+	//! Incremented whenever the boundary changes
+	atomic<idx_t> boundary_version;
+	//! The filter that is pushed into the scan (if any)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 };
 
 class TopNLocalState : public LocalSinkState {
 public:
-	TopNLocalState(const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset) : heap(orders, limit, offset) {
+	TopNLocalState(const vector<BoundOrderByNode> &orders, idx_t limit, idx_t offset)
+	    : heap(orders, limit, offset), boundary_version(0) {
 	}
 	TopNHeap heap;
+	//! The version of the global boundary that was last taken over
+	idx_t boundary_version;
 };
 
 unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &context) {
@@ -129,7 +290,40 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalOperatorState> PhysicalTopN::GetGlobalState(ClientContext &context) {
-	return make_unique<TopNGlobalState>(orders, limit, offset);
+	RegisterRuntimeFilter();
+	return make_unique<TopNGlobalState>(orders, limit, offset, dynamic_filter);
+}
+
+//===--------------------------------------------------------------------===//
+// Runtime Filter
+//===--------------------------------------------------------------------===//
+void PhysicalTopN::RegisterRuntimeFilter() {
+	dynamic_filter.reset();
+	if (limit + offset == 0 || orders[0].expression->type != ExpressionType::BOUND_REF) {
+		return;
+	}
+	auto internal_type = orders[0].expression->return_type.InternalType();
+	if (internal_type == PhysicalType::STRUCT || internal_type == PhysicalType::LIST) {
+		return;
+	}
+	idx_t column_index = ((BoundReferenceExpression &)*orders[0].expression).index;
+	auto scan = PhysicalTableScan::FindRuntimeFilterScan(children[0].get(), column_index);
+	if (!scan) {
+		return;
+	}
+	// rows that are equal to the boundary pass the filter: the boundary only covers the first key
+	auto comparison_type = orders[0].type == OrderType::DESCENDING ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+	                                                                : ExpressionType::COMPARE_LESSTHANOREQUALTO;
+	dynamic_filter =
+	    make_shared<DynamicFilterData>(comparison_type, orders[0].null_order == OrderByNullType::NULLS_FIRST);
+	scan->AddRuntimeFilter(this, 0, column_index);
+}
+
+unique_ptr<TableFilter> PhysicalTopN::GetRuntimeFilter() const {
+	if (!dynamic_filter) {
+		return nullptr;
+	}
+	return make_unique<DynamicFilter>(dynamic_filter);
 }
 
 //===--------------------------------------------------------------------===//
@@ -137,10 +331,35 @@ unique_ptr<GlobalOperatorState> PhysicalTopN::GetGlobalState(ClientContext &cont
 //===--------------------------------------------------------------------===//
 void PhysicalTopN::Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
                         DataChunk &input) const {
-	// append to the local sink state
+	auto &gstate = (TopNGlobalState &)state;
 	auto &sink = (TopNLocalState &)lstate;
-	sink.heap.Sink(input);
-	sink.heap.Reduce();
+	auto &heap = sink.heap;
+
+	// take over the boundary of the other threads if it is tighter than our own
+	if (sink.boundary_version != gstate.boundary_version) {
+		lock_guard<mutex> glock(gstate.lock);
+		sink.boundary_version = gstate.boundary_version;
+		heap.TightenBoundary(gstate.boundary);
+	}
+
+	// append to the local sink state
+	if (!heap.Sink(input)) {
+		return;
+	}
+	if (!heap.Reduce()) {
+		return;
+	}
+
+	// publish our boundary if it is tighter than the boundary of the other threads
+	lock_guard<mutex> glock(gstate.lock);
+	if (!gstate.boundary.empty() && heap.CompareKeys(heap.boundary, gstate.boundary) >= 0) {
+		return;
+	}
+	gstate.boundary = heap.boundary;
+	sink.boundary_version = ++gstate.boundary_version;
+	if (gstate.dynamic_filter && !gstate.boundary[0].is_null) {
+		gstate.dynamic_filter->SetConstant(gstate.boundary[0]);
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -20,6 +20,11 @@
 #include <cstring>
 #include <fstream>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DUCKDB_CSV_SSE2
+#endif
+
 namespace duckdb {
 
 static string GetLineNumberStr(idx_t linenr, bool linenr_estimated) {
@@ -123,6 +128,57 @@ TextSearchShiftArray::TextSearchShiftArray(string search_term) : length(search_t
 	}
 }
 
+constexpr const idx_t SpecialCharacterSearch::BLOCK_SIZE;
+
+SpecialCharacterSearch::SpecialCharacterSearch() : SpecialCharacterSearch('\n', '\n', '\n') {
+}
+
+SpecialCharacterSearch::SpecialCharacterSearch(char delimiter, char quote, char escape) {
+	characters[0] = delimiter;
+	characters[1] = quote;
+	characters[2] = escape;
+	characters[3] = '\n';
+	characters[4] = '\r';
+	memset(is_special, 0, sizeof(is_special));
+	for (auto c : characters) {
+		is_special[(uint8_t)c] = true;
+	}
+	block_begin = 0;
+	block_length = 0;
+	block_mask = 0;
+	Reset();
+}
+
+void SpecialCharacterSearch::ComputeBlock(const char *buffer, idx_t position, idx_t end) {
+	block_buffer = buffer;
+	block_begin = position;
+	block_length = MinValue<idx_t>(BLOCK_SIZE, end - position);
+	block_mask = 0;
+	auto data = buffer + position;
+	idx_t i = 0;
+#ifdef DUCKDB_CSV_SSE2
+	if (block_length == BLOCK_SIZE) {
+		// compare 16 bytes at a time against every special character
+		__m128i special[5];
+		for (idx_t c = 0; c < 5; c++) {
+			special[c] = _mm_set1_epi8(characters[c]);
+		}
+		for (; i < BLOCK_SIZE; i += 16) {
+			auto bytes = _mm_loadu_si128((const __m128i *)(data + i));
+			auto matches = _mm_cmpeq_epi8(bytes, special[0]);
+			for (idx_t c = 1; c < 5; c++) {
+				matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, special[c]));
+			}
+			block_mask |= uint64_t(uint16_t(_mm_movemask_epi8(matches))) << i;
+		}
+	}
+#endif
+	// scalar fallback, also used for the last (partial) block of the buffer
+	for (; i < block_length; i++) {
+		block_mask |= uint64_t(is_special[(uint8_t)data[i]]) << i;
+	}
+}
+
 BufferedCSVReader::BufferedCSVReader(ClientContext &context, BufferedCSVReaderOptions options_p,
                                      const vector<LogicalType> &requested_types)
     : fs(FileSystem::GetFileSystem(context)), options(move(options_p)), buffer_size(0), position(0), start(0) {
@@ -130,8 +186,36 @@ BufferedCSVReader::BufferedCSVReader(ClientContext &context, BufferedCSVReaderOp
 	Initialize(requested_types);
 }
 
+BufferedCSVReader::BufferedCSVReader(ClientContext &context, BufferedCSVReaderOptions options_p,
+                                     const vector<LogicalType> &requested_types, idx_t range_begin,
+                                     idx_t range_end_p, bool range_begin_is_record_start)
+    : fs(FileSystem::GetFileSystem(context)), options(move(options_p)), buffer_size(0), position(0), start(0) {
+	D_ASSERT(!options.auto_detect);
+	file_handle = OpenCSV(context, options);
+	if (!plain_file_source) {
+		// we can only start reading in the middle of plain files
+		D_ASSERT(range_begin == 0);
+		Initialize(requested_types);
+		return;
+	}
+	if (range_begin == 0) {
+		// the first byte range skips the leading rows and the header
+		Initialize(requested_types);
+	} else {
+		sql_types = requested_types;
+		PrepareParser();
+		if (range_begin_is_record_start) {
+			StartAtRecord(range_begin);
+		} else {
+			SkipToRecordStart(range_begin, range_end_p);
+		}
+		InitParseChunk(sql_types.size());
+	}
+	range_end = range_end_p;
+}
+
 void BufferedCSVReader::Initialize(const vector<LogicalType> &requested_types) {
-	PrepareComplexParser();
+	PrepareParser();
 	if (options.auto_detect) {
 		sql_types = SniffCSV(requested_types);
 		if (cached_chunks.empty()) {
@@ -145,10 +229,11 @@ void BufferedCSVReader::Initialize(const vector<LogicalType> &requested_types) {
 	InitParseChunk(sql_types.size());
 }
 
-void BufferedCSVReader::PrepareComplexParser() {
+void BufferedCSVReader::PrepareParser() {
 	delimiter_search = TextSearchShiftArray(options.delimiter);
 	escape_search = TextSearchShiftArray(options.escape);
 	quote_search = TextSearchShiftArray(options.quote);
+	special_search = SpecialCharacterSearch(options.delimiter[0], options.quote[0], options.escape[0]);
 }
 
 unique_ptr<FileHandle> BufferedCSVReader::OpenCSV(ClientContext &context, const BufferedCSVReaderOptions &options) {
@@ -318,6 +403,92 @@ void BufferedCSVReader::SkipRowsAndReadHeader(idx_t skip_rows, bool skip_header)
 	}
 }
 
+void BufferedCSVReader::SeekToPosition(idx_t file_position) {
+	ResetBuffer();
+	file_handle->Seek(file_position);
+	buffer_offset = file_position;
+	// a byte order mark can only occur at the start of the file
+	bom_checked = true;
+}
+
+void BufferedCSVReader::SkipToRecordStart(idx_t range_begin, idx_t range_limit) {
+	D_ASSERT(range_begin > 0);
+	// a record starts after every newline that is not quoted: look for the first newline from the byte right before
+	// range_begin onwards, and check whether the rows after it can be parsed
+	idx_t search_position = range_begin - 1;
+	idx_t record_start;
+	linenr = 0;
+	while (true) {
+		SeekToPosition(search_position);
+		bool found_newline = false;
+		while (true) {
+			if (position >= buffer_size) {
+				start = position;
+				if (!ReadBuffer(start)) {
+					break;
+				}
+			}
+			if (StringUtil::CharacterIsNewline(buffer[position])) {
+				found_newline = true;
+				break;
+			}
+			position++;
+		}
+		if (found_newline) {
+			// skip the newline, which can be \r\n
+			bool carriage_return = buffer[position] == '\r';
+			position++;
+			if (carriage_return && position >= buffer_size) {
+				start = position;
+				ReadBuffer(start);
+			}
+			if (carriage_return && position < buffer_size && buffer[position] == '\n') {
+				position++;
+			}
+		}
+		record_start = FilePosition();
+		if (!found_newline || record_start >= range_limit) {
+			// no record starts in the byte range
+			break;
+		}
+		if (IsRecordStart(record_start)) {
+			// estimate the line number from the length of the rows that were parsed
+			idx_t parsed_bytes = FilePosition() - record_start;
+			if (parsed_bytes > 0 && !sniffed_column_counts.empty()) {
+				linenr = (idx_t)round(record_start / (parsed_bytes / (double)sniffed_column_counts.size()));
+			}
+			break;
+		}
+		search_position = record_start;
+	}
+	StartAtRecord(record_start);
+}
+
+void BufferedCSVReader::StartAtRecord(idx_t record_start) {
+	sniffed_column_counts.clear();
+	linenr_estimated = true;
+	end_of_file_reached = false;
+	row_empty = false;
+	range_start = record_start;
+	SeekToPosition(record_start);
+}
+
+bool BufferedCSVReader::IsRecordStart(idx_t file_position) {
+	SeekToPosition(file_position);
+	sniffed_column_counts.clear();
+	try {
+		ParseCSV(ParserMode::SNIFFING_DIALECT);
+	} catch (const InvalidInputException &e) {
+		return false;
+	}
+	for (auto &column_count : sniffed_column_counts) {
+		if (column_count != sql_types.size()) {
+			return false;
+		}
+	}
+	return true;
+}
+
 bool BufferedCSVReader::JumpToNextSample() {
 	// get bytes contained in the previously read chunk
 	idx_t remaining_bytes_in_buffer = buffer_size - start;
@@ -485,7 +656,7 @@ vector<LogicalType> BufferedCSVReader::SniffCSV(const vector<LogicalType> &reque
 					sniff_info.escape = escape;
 
 					options = sniff_info;
-					PrepareComplexParser();
+					PrepareParser();
 
 					JumpToBeginning(original_options.skip_rows);
 					sniffed_column_counts.clear();
@@ -584,6 +755,7 @@ vector<LogicalType> BufferedCSVReader::SniffCSV(const vector<LogicalType> &reque
 	}
 	for (auto &info_candidate : info_candidates) {
 		options = info_candidate;
+		PrepareParser();
 		vector<vector<LogicalType>> info_sql_types_candidates(options.num_cols, type_candidates);
 		std::map<LogicalTypeId, bool> has_format_candidates;
 		std::map<LogicalTypeId, vector<string>> format_candidates;
@@ -718,6 +890,7 @@ vector<LogicalType> BufferedCSVReader::SniffCSV(const vector<LogicalType> &reque
 	}
 
 	options = best_options;
+	PrepareParser();
 	for (const auto &best : best_format_candidates) {
 		if (!best.second.empty()) {
 			SetDateFormat(best.second.back(), best.first);
@@ -896,6 +1069,10 @@ void BufferedCSVReader::ParseComplexCSV(DataChunk &insert_chunk) {
 	uint8_t delimiter_pos = 0, escape_pos = 0, quote_pos = 0;
 	idx_t offset = 0;
 
+	if (ReachedRangeEnd()) {
+		// the remaining records belong to the next byte range
+		return;
+	}
 	// read values into the buffer (if any)
 	if (position >= buffer_size) {
 		if (!ReadBuffer(start)) {
@@ -984,6 +1161,9 @@ add_row : {
 		if (finished_chunk) {
 			return;
 		}
+		if (ReachedRangeEnd()) {
+			goto final_state;
+		}
 		goto value_start;
 	}
 }
@@ -1091,6 +1271,9 @@ carriage_return:
 	if (finished_chunk) {
 		return;
 	}
+	if (ReachedRangeEnd()) {
+		goto final_state;
+	}
 	goto value_start;
 final_state:
 	if (finished_chunk) {
@@ -1117,6 +1300,10 @@ void BufferedCSVReader::ParseSimpleCSV(DataChunk &insert_chunk) {
 	idx_t offset = 0;
 	vector<idx_t> escape_positions;
 
+	if (ReachedRangeEnd()) {
+		// the remaining records belong to the next byte range
+		return;
+	}
 	// read values into the buffer (if any)
 	if (position >= buffer_size) {
 		if (!ReadBuffer(start)) {
@@ -1143,7 +1330,8 @@ normal:
 	/* state: normal parsing state */
 	// this state parses the remainder of a non-quoted value until we reach a delimiter or newline
 	do {
-		for (; position < buffer_size; position++) {
+		// only the special characters can end the value, so skip directly to the next one
+		for (; (position = special_search.Next(buffer.get(), position, buffer_size)) < buffer_size; position++) {
 			if (buffer[position] == options.delimiter[0]) {
 				// delimiter: end the value and add it to the chunk
 				goto add_value;
@@ -1185,6 +1373,9 @@ add_row : {
 		if (finished_chunk) {
 			return;
 		}
+		if (ReachedRangeEnd()) {
+			goto final_state;
+		}
 		goto value_start;
 	}
 }
@@ -1193,7 +1384,7 @@ in_quotes:
 	// this state parses the remainder of a quoted value
 	position++;
 	do {
-		for (; position < buffer_size; position++) {
+		for (; (position = special_search.Next(buffer.get(), position, buffer_size)) < buffer_size; position++) {
 			if (buffer[position] == options.quote[0]) {
 				// quote: move to unquoted state
 				goto unquote;
@@ -1266,6 +1457,9 @@ carriage_return:
 	if (finished_chunk) {
 		return;
 	}
+	if (ReachedRangeEnd()) {
+		goto final_state;
+	}
 	goto value_start;
 final_state:
 	if (finished_chunk) {
@@ -1305,6 +1499,9 @@ bool BufferedCSVReader::ReadBuffer(idx_t &start) {
 		// remaining from last buffer: copy it here
 		memcpy(buffer.get(), old_buffer.get() + start, remaining);
 	}
+	if (plain_file_source) {
+		buffer_offset = file_handle->SeekPosition() - remaining;
+	}
 	idx_t read_count = file_handle->Read(buffer.get() + remaining, buffer_read_size);
 
 	bytes_in_chunk += read_count;
@@ -1313,6 +1510,7 @@ bool BufferedCSVReader::ReadBuffer(idx_t &start) {
 	if (old_buffer) {
 		cached_buffers.push_back(move(old_buffer));
 	}
+	special_search.Reset();
 	start = 0;
 	position = remaining;
 	if (!bom_checked) {
@@ -1,4 +1,5 @@
 #include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 
 #include <algorithm>
@@ -11,7 +12,7 @@ public:
 	    : rows_copied(0), global_state(move(global_state)) {
 	}
 
-	idx_t rows_copied;
+	atomic<idx_t> rows_copied;
 	unique_ptr<GlobalFunctionData> global_state;
 };
 
@@ -27,7 +28,7 @@ void PhysicalCopyToFile::GetChunkInternal(ExecutionContext &context, DataChunk &
 	auto &g = (CopyToFunctionGlobalState &)*sink_state;
 
 	chunk.SetCardinality(1);
-	chunk.SetValue(0, 0, Value::BIGINT(g.rows_copied));
+	chunk.SetValue(0, 0, Value::BIGINT(g.rows_copied.load()));
 
 	state->finished = true;
 }
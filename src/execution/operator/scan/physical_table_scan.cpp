@@ -2,8 +2,12 @@
 
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/parallel/task_context.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
 #include <utility>
@@ -20,6 +24,8 @@ public:
 	unique_ptr<FunctionOperatorData> operator_data;
 	//! Whether or not the scan has been initialized
 	bool initialized;
+	//! The table filters including the runtime filters of the joins (if there are any)
+	unique_ptr<TableFilterSet> runtime_filter_set;
 };
 
 PhysicalTableScan::PhysicalTableScan(vector<LogicalType> types, TableFunction function_p,
@@ -44,7 +50,14 @@ void PhysicalTableScan::GetChunkInternal(ExecutionContext &context, DataChunk &c
 			// check if there is any parallel state to fetch
 			state.parallel_state = nullptr;
 			auto task_info = task.task_info.find(this);
-			TableFilterCollection filters(table_filters.get());
+			auto table_filter_set = table_filters.get();
+			if (!runtime_filters.empty()) {
+				state.runtime_filter_set = CreateRuntimeFilterSet();
+				if (state.runtime_filter_set) {
+					table_filter_set = state.runtime_filter_set.get();
+				}
+			}
+			TableFilterCollection filters(table_filter_set);
 			if (task_info != task.task_info.end()) {
 				// parallel scan init
 				state.parallel_state = task_info->second;
@@ -135,4 +148,87 @@ unique_ptr<PhysicalOperatorState> PhysicalTableScan::GetOperatorState() {
 	return make_unique<PhysicalTableScanOperatorState>(*this);
 }
 
+bool PhysicalTableScan::SupportsRuntimeFilters(idx_t column_index) const {
+	// only the scans of base tables evaluate all types of table filters
+	if (function.name != "seq_scan" || !function.filter_pushdown) {
+		return false;
+	}
+	return column_index < column_ids.size() && column_ids[column_index] != COLUMN_IDENTIFIER_ROW_ID;
+}
+
+void PhysicalTableScan::AddRuntimeFilter(PhysicalOperator *op, idx_t filter_idx, idx_t column_index) {
+	D_ASSERT(SupportsRuntimeFilters(column_index));
+	for (auto &runtime_filter : runtime_filters) {
+		if (runtime_filter.op == op && runtime_filter.filter_idx == filter_idx) {
+			return;
+		}
+	}
+	runtime_filters.push_back(RuntimeFilterSource {op, filter_idx, column_index});
+}
+
+PhysicalTableScan *PhysicalTableScan::FindRuntimeFilterScan(PhysicalOperator *op, idx_t &column_index) {
+	while (true) {
+		switch (op->type) {
+		case PhysicalOperatorType::TABLE_SCAN: {
+			auto &scan = (PhysicalTableScan &)*op;
+			return scan.SupportsRuntimeFilters(column_index) ? &scan : nullptr;
+		}
+		case PhysicalOperatorType::FILTER:
+			op = op->children[0].get();
+			break;
+		case PhysicalOperatorType::PROJECTION: {
+			auto &expr = *((PhysicalProjection &)*op).select_list[column_index];
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return nullptr;
+			}
+			column_index = ((BoundReferenceExpression &)expr).index;
+			op = op->children[0].get();
+			break;
+		}
+		case PhysicalOperatorType::HASH_JOIN: {
+			// the columns of the probe side come first in the result of a hash join, and the probe side is part of
+			// the same pipeline
+			auto join_type = ((PhysicalHashJoin &)*op).join_type;
+			if (join_type == JoinType::RIGHT || join_type == JoinType::OUTER) {
+				// removing probe rows would turn their matches into unmatched build rows
+				return nullptr;
+			}
+			if (column_index >= op->children[0]->types.size()) {
+				return nullptr;
+			}
+			op = op->children[0].get();
+			break;
+		}
+		default:
+			return nullptr;
+		}
+	}
+}
+
+unique_ptr<TableFilterSet> PhysicalTableScan::CreateRuntimeFilterSet() const {
+	unique_ptr<TableFilterSet> result;
+	for (auto &runtime_filter : runtime_filters) {
+		unique_ptr<TableFilter> filter;
+		switch (runtime_filter.op->type) {
+		case PhysicalOperatorType::HASH_JOIN:
+			filter = ((PhysicalHashJoin &)*runtime_filter.op).GetRuntimeFilter(runtime_filter.filter_idx);
+			break;
+		case PhysicalOperatorType::TOP_N:
+			filter = ((PhysicalTopN &)*runtime_filter.op).GetRuntimeFilter();
+			break;
+		default:
+			throw InternalException("Unsupported operator for runtime filters");
+		}
+		if (!filter) {
+			continue;
+		}
+		if (!result) {
+			// the regular table filters are evaluated first
+			result = table_filters ? table_filters->Copy() : make_unique<TableFilterSet>();
+		}
+		result->PushFilter(runtime_filter.column_index, move(filter));
+	}
+	return result;
+}
+
 } // namespace duckdb
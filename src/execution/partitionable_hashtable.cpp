@@ -157,6 +157,49 @@ HashTableList PartitionableHashTable::GetUnpartitioned() {
 	return move(unpartitioned_hts);
 }
 
+idx_t PartitionableHashTable::SizeInBytes() {
+	idx_t size_in_bytes = 0;
+	for (auto &ht : unpartitioned_hts) {
+		size_in_bytes += ht->SizeInBytes();
+	}
+	for (auto &ht_list : radix_partitioned_hts) {
+		for (auto &ht : ht_list.second) {
+			size_in_bytes += ht->SizeInBytes();
+		}
+	}
+	return size_in_bytes;
+}
+
+void PartitionableHashTable::SpillPartitions() {
+	D_ASSERT(IsPartitioned());
+	if (!IsSpilled()) {
+		for (idx_t r = 0; r < partition_info.n_partitions; r++) {
+			spilled_partitions.push_back(make_unique<BufferedChunkCollection>(buffer_manager));
+		}
+	}
+	for (auto &ht_list : radix_partitioned_hts) {
+		for (auto &ht : ht_list.second) {
+			ht->SerializeStates(*spilled_partitions[ht_list.first]);
+			ht.reset();
+		}
+		// the next chunk for this partition creates a new HT
+		ht_list.second.clear();
+	}
+}
+
+bool PartitionableHashTable::IsSpilled() {
+	return !spilled_partitions.empty();
+}
+
+unique_ptr<BufferedChunkCollection> PartitionableHashTable::GetSpilledPartition(idx_t partition) {
+	D_ASSERT(IsPartitioned());
+	if (!IsSpilled()) {
+		return nullptr;
+	}
+	D_ASSERT(partition < spilled_partitions.size());
+	return move(spilled_partitions[partition]);
+}
+
 void PartitionableHashTable::Finalize() {
 	if (IsPartitioned()) {
 		for (auto &ht_list : radix_partitioned_hts) {
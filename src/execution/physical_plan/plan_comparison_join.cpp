@@ -1,5 +1,7 @@
+#include "duckdb/execution/operator/join/physical_asof_join.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/join/physical_iejoin.hpp"
 #include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
@@ -74,6 +76,15 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparison
 	auto right = CreatePlan(*op.children[1]);
 	D_ASSERT(left && right);
 
+	if (op.type == LogicalOperatorType::LOGICAL_ASOF_JOIN) {
+		// the planner has put the inequality condition last
+		auto &inequality_type = op.conditions.back().left->return_type;
+		if (!PhysicalAsOfJoin::IsSupportedInequalityType(inequality_type)) {
+			throw NotImplementedException("ASOF JOIN on an inequality of type %s", inequality_type.ToString());
+		}
+		return make_unique<PhysicalAsOfJoin>(op, move(left), move(right), move(op.conditions), op.join_type,
+		                                     op.estimated_cardinality);
+	}
 	if (op.conditions.empty()) {
 		// no conditions: insert a cross product
 		return make_unique<PhysicalCrossProduct>(op.types, move(left), move(right), op.estimated_cardinality);
@@ -124,6 +135,10 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalComparison
 			// range join: use piecewise merge join
 			plan = make_unique<PhysicalPiecewiseMergeJoin>(op, move(left), move(right), move(op.conditions),
 			                                               op.join_type, op.estimated_cardinality);
+		} else if (PhysicalIEJoin::CanJoin(op.join_type, op.conditions)) {
+			// two range conditions: use the IEJoin
+			plan = make_unique<PhysicalIEJoin>(op, move(left), move(right), move(op.conditions), op.join_type,
+			                                   op.estimated_cardinality);
 		} else {
 			// inequality join: use nested loop
 			plan = make_unique<PhysicalNestedLoopJoin>(op, move(left), move(right), move(op.conditions), op.join_type,
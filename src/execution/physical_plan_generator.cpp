@@ -82,6 +82,7 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalOperator &
 	case LogicalOperatorType::LOGICAL_DELIM_JOIN:
 		return CreatePlan((LogicalDelimJoin &)op);
 	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_ASOF_JOIN:
 		return CreatePlan((LogicalComparisonJoin &)op);
 	case LogicalOperatorType::LOGICAL_CROSS_PRODUCT:
 		return CreatePlan((LogicalCrossProduct &)op);
@@ -12,7 +12,7 @@ WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData
                                      const LogicalType &result_type_p, ChunkCollection *input)
     : aggregate(aggregate), bind_info(bind_info), result_type(result_type_p), state(aggregate.state_size()),
       statep(Value::POINTER((idx_t)state.data())), frame(0, 0), result(result_type_p), internal_nodes(0),
-      input_ref(input) {
+      input_ref(input), use_window_callback(aggregate.window != nullptr) {
 #if STANDARD_VECTOR_SIZE < 512
 	throw NotImplementedException("Window functions are not supported for vector sizes < 512");
 #endif
@@ -20,9 +20,16 @@ WindowSegmentTree::WindowSegmentTree(AggregateFunction &aggregate, FunctionData
 
 	if (input_ref && input_ref->ColumnCount() > 0) {
 		inputs.Initialize(input_ref->Types());
+		for (auto &type : input_ref->Types()) {
+			if (type.InternalType() == PhysicalType::STRUCT || type.InternalType() == PhysicalType::LIST) {
+				// nested inputs are not materialized into a single vector: use the segment tree instead
+				use_window_callback = false;
+			}
+		}
 		// if we have a frame-by-frame method, share the single state
-		if (aggregate.window) {
+		if (use_window_callback) {
 			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+			MaterializeInputs();
 			AggregateInit();
 		} else if (aggregate.combine) {
 			ConstructTree();
@@ -50,7 +57,7 @@ WindowSegmentTree::~WindowSegmentTree() {
 		aggregate.destructor(addresses, count);
 	}
 
-	if (aggregate.window) {
+	if (use_window_callback) {
 		(void)AggegateFinal();
 	}
 }
@@ -71,6 +78,30 @@ Value WindowSegmentTree::AggegateFinal() {
 	return result.GetValue(0);
 }
 
+void WindowSegmentTree::MaterializeInputs() {
+	// frame-by-frame methods index the whole input, so frames are not limited to the size of a single vector
+	const auto count = input_ref->Count();
+	const auto &types = input_ref->Types();
+	for (idx_t col_idx = 0; col_idx < types.size(); col_idx++) {
+		window_inputs.emplace_back(types[col_idx], count);
+		auto &target = window_inputs.back();
+		// only allocate a validity mask if there are NULL values, the window methods have fast paths without one
+		for (auto &chunk : input_ref->Chunks()) {
+			VectorData vdata;
+			chunk->data[col_idx].Orrify(chunk->size(), vdata);
+			if (!vdata.validity.AllValid()) {
+				FlatVector::Validity(target).Initialize(count);
+				break;
+			}
+		}
+		idx_t offset = 0;
+		for (auto &chunk : input_ref->Chunks()) {
+			VectorOperations::Copy(chunk->data[col_idx], target, chunk->size(), 0, offset);
+			offset += chunk->size();
+		}
+	}
+}
+
 void WindowSegmentTree::ExtractFrame(idx_t begin, idx_t end) {
 	const auto size = end - begin;
 	if (size >= STANDARD_VECTOR_SIZE) {
@@ -185,17 +216,15 @@ Value WindowSegmentTree::Compute(idx_t begin, idx_t end) {
 	}
 
 	// If we have a window function, use that
-	if (aggregate.window) {
+	if (use_window_callback) {
 		// Frame boundaries
 		auto prev = frame;
 		frame = FrameBounds(begin, end);
 
-		// Extract the range
-		ExtractFrame(MinValue(frame.first, prev.first), MaxValue(frame.second, prev.second));
-
 		ConstantVector::SetNull(result, false);
 
-		aggregate.window(inputs.data.data(), bind_info, inputs.ColumnCount(), state.data(), frame, prev, result);
+		aggregate.window(window_inputs.data(), bind_info, window_inputs.size(), state.data(), frame, prev, result,
+		                 input_ref->Count());
 		return result.GetValue(0);
 	}
 
@@ -39,6 +39,10 @@ struct AverageSetOperation {
 	static void AddValues(STATE *state, idx_t count) {
 		state->count += count;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE *state, idx_t count) {
+		state->count -= count;
+	}
 };
 
 static double GetAverageDivident(uint64_t count, FunctionData *bind_data) {
@@ -105,24 +109,37 @@ struct NumericAverageOperation : public BaseSumOperation<AverageSetOperation, Re
 
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
-	case PhysicalType::INT16:
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+	case PhysicalType::INT16: {
+		auto function = AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
 		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.window =
+		    AggregateFunction::UnaryInvertibleWindow<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>;
+		return function;
+	}
 	case PhysicalType::INT32: {
 		auto function =
 		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
 		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.window = AggregateFunction::UnaryInvertibleWindow<AvgState<hugeint_t>, int32_t, double,
+		                                                           IntegerAverageOperationHugeint>;
 		return function;
 	}
 	case PhysicalType::INT64: {
 		auto function =
 		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
 		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.window = AggregateFunction::UnaryInvertibleWindow<AvgState<hugeint_t>, int64_t, double,
+		                                                           IntegerAverageOperationHugeint>;
+		return function;
+	}
+	case PhysicalType::INT128: {
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
+		        LogicalType::HUGEINT, LogicalType::DOUBLE);
+		function.window =
+		    AggregateFunction::UnaryInvertibleWindow<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>;
 		return function;
 	}
-	case PhysicalType::INT128:
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
-		    LogicalType::HUGEINT, LogicalType::DOUBLE);
 	default:
 		throw NotImplementedException("Unimplemented average aggregate");
 	}
@@ -47,14 +47,21 @@ struct CountFunction : public BaseCountFunction {
 		*state += count;
 	}
 
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Inverse(STATE *state, FunctionData *bind_data, INPUT_TYPE *input, ValidityMask &mask, idx_t idx) {
+		*state -= 1;
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
 };
 
 AggregateFunction CountFun::GetFunction() {
-	return AggregateFunction::UnaryAggregate<int64_t, int64_t, int64_t, CountFunction>(LogicalType(LogicalTypeId::ANY),
-	                                                                                   LogicalType::BIGINT);
+	auto function = AggregateFunction::UnaryAggregate<int64_t, int64_t, int64_t, CountFunction>(
+	    LogicalType(LogicalTypeId::ANY), LogicalType::BIGINT);
+	function.window = AggregateFunction::UnaryInvertibleWindow<int64_t, int64_t, int64_t, CountFunction>;
+	return function;
 }
 
 AggregateFunction CountStarFun::GetFunction() {
@@ -11,29 +11,34 @@ namespace duckdb {
 template <class T>
 struct SumState {
 	T value;
-	bool isset;
+	//! The number of values summed up, kept (rather than a flag) so values can be removed again in windows
+	idx_t count;
 };
 
 struct SumSetOperation {
 	template <class STATE>
 	static void Initialize(STATE *state) {
-		state->isset = false;
+		state->count = 0;
 	}
 	template <class STATE>
 	static void Combine(const STATE &source, STATE *target) {
-		target->isset = source.isset || target->isset;
+		target->count += source.count;
 		target->value += source.value;
 	}
 	template <class STATE>
 	static void AddValues(STATE *state, idx_t count) {
-		state->isset = true;
+		state->count += count;
+	}
+	template <class STATE>
+	static void RemoveValues(STATE *state, idx_t count) {
+		state->count -= count;
 	}
 };
 
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
 	template <class T, class STATE>
 	static void Finalize(Vector &result, FunctionData *, STATE *state, T *target, ValidityMask &mask, idx_t idx) {
-		if (!state->isset) {
+		if (state->count == 0) {
 			mask.SetInvalid(idx);
 		} else {
 			target[idx] = Hugeint::Convert(state->value);
@@ -44,7 +49,7 @@ struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd
 struct SumToHugeintOperation : public BaseSumOperation<SumSetOperation, HugeintAdd> {
 	template <class T, class STATE>
 	static void Finalize(Vector &result, FunctionData *, STATE *state, T *target, ValidityMask &mask, idx_t idx) {
-		if (!state->isset) {
+		if (state->count == 0) {
 			mask.SetInvalid(idx);
 		} else {
 			target[idx] = state->value;
@@ -55,7 +60,7 @@ struct SumToHugeintOperation : public BaseSumOperation<SumSetOperation, HugeintA
 struct NumericSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
 	template <class T, class STATE>
 	static void Finalize(Vector &result, FunctionData *, STATE *state, T *target, ValidityMask &mask, idx_t idx) {
-		if (!state->isset) {
+		if (state->count == 0) {
 			mask.SetInvalid(idx);
 		} else {
 			if (!Value::DoubleIsValid(state->value)) {
@@ -69,7 +74,7 @@ struct NumericSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd
 struct HugeintSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
 	template <class T, class STATE>
 	static void Finalize(Vector &result, FunctionData *, STATE *state, T *target, ValidityMask &mask, idx_t idx) {
-		if (!state->isset) {
+		if (state->count == 0) {
 			mask.SetInvalid(idx);
 		} else {
 			target[idx] = state->value;
@@ -77,6 +82,14 @@ struct HugeintSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd
 	}
 };
 
+template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
+static AggregateFunction GetInvertibleSumAggregate(const LogicalType &input_type) {
+	auto function =
+	    AggregateFunction::UnaryAggregate<STATE, INPUT_TYPE, RESULT_TYPE, OP>(input_type, LogicalType::HUGEINT);
+	function.window = AggregateFunction::UnaryInvertibleWindow<STATE, INPUT_TYPE, RESULT_TYPE, OP>;
+	return function;
+}
+
 unique_ptr<BaseStatistics> SumPropagateStats(ClientContext &context, BoundAggregateExpression &expr,
                                              FunctionData *bind_data, vector<unique_ptr<BaseStatistics>> &child_stats,
                                              NodeStatistics *node_stats) {
@@ -111,15 +124,13 @@ unique_ptr<BaseStatistics> SumPropagateStats(ClientContext &context, BoundAggreg
 		// total sum is guaranteed to fit in a single int64: use int64 sum instead of hugeint sum
 		switch (internal_type) {
 		case PhysicalType::INT32:
-			expr.function =
-			    AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
-			        LogicalType::INTEGER, LogicalType::HUGEINT);
+			expr.function = GetInvertibleSumAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
+			    LogicalType::INTEGER);
 			expr.function.name = "sum";
 			break;
 		case PhysicalType::INT64:
-			expr.function =
-			    AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
-			        LogicalType::BIGINT, LogicalType::HUGEINT);
+			expr.function = GetInvertibleSumAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
+			    LogicalType::BIGINT);
 			expr.function.name = "sum";
 			break;
 		default:
@@ -132,25 +143,23 @@ unique_ptr<BaseStatistics> SumPropagateStats(ClientContext &context, BoundAggreg
 AggregateFunction SumFun::GetSumAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16:
-		return AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
-		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		return GetInvertibleSumAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
+		    LogicalType::SMALLINT);
 	case PhysicalType::INT32: {
-		auto function =
-		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
-		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		auto function = GetInvertibleSumAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
+		    LogicalType::INTEGER);
 		function.statistics = SumPropagateStats;
 		return function;
 	}
 	case PhysicalType::INT64: {
-		auto function =
-		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
-		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		auto function = GetInvertibleSumAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
+		    LogicalType::BIGINT);
 		function.statistics = SumPropagateStats;
 		return function;
 	}
 	case PhysicalType::INT128:
-		return AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
-		    LogicalType::HUGEINT, LogicalType::HUGEINT);
+		return GetInvertibleSumAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
+		    LogicalType::HUGEINT);
 	default:
 		throw NotImplementedException("Unimplemented sum aggregate");
 	}
@@ -166,8 +166,8 @@ struct ModeFunction {
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
 	static void Window(const INPUT_TYPE *data, const ValidityMask &dmask, FunctionData *bind_data_p, STATE *state,
-	                   const FrameBounds &frame, const FrameBounds &prev, RESULT_TYPE *result, ValidityMask &rmask) {
-		const auto bias = MinValue(frame.first, prev.first);
+	                   const FrameBounds &frame, const FrameBounds &prev, RESULT_TYPE *result, ValidityMask &rmask,
+	                   idx_t count) {
 		if (!state->frequency_map) {
 			state->frequency_map = new unordered_map<KEY_TYPE, size_t>();
 		}
@@ -176,31 +176,31 @@ struct ModeFunction {
 			state->Reset();
 			// for f ∈ F do
 			for (auto f = frame.first; f < frame.second; ++f) {
-				if (dmask.RowIsValid(f - bias)) {
+				if (dmask.RowIsValid(f)) {
 					state->ModeAdd(KEY_TYPE(data[f]));
 				}
 			}
 		} else {
 			// for f ∈ P \ F do
 			for (auto p = prev.first; p < frame.first; ++p) {
-				if (dmask.RowIsValid(p - bias)) {
+				if (dmask.RowIsValid(p)) {
 					state->ModeRm(KEY_TYPE(data[p]));
 				}
 			}
 			for (auto p = frame.second; p < prev.second; ++p) {
-				if (dmask.RowIsValid(p - bias)) {
+				if (dmask.RowIsValid(p)) {
 					state->ModeRm(KEY_TYPE(data[p]));
 				}
 			}
 
 			// for f ∈ F \ P do
 			for (auto f = frame.first; f < prev.first; ++f) {
-				if (dmask.RowIsValid(f - bias)) {
+				if (dmask.RowIsValid(f)) {
 					state->ModeAdd(KEY_TYPE(data[f]));
 				}
 			}
 			for (auto f = prev.second; f < frame.second; ++f) {
-				if (dmask.RowIsValid(f - bias)) {
+				if (dmask.RowIsValid(f)) {
 					state->ModeAdd(KEY_TYPE(data[f]));
 				}
 			}
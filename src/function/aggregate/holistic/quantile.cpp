@@ -19,6 +19,86 @@ timestamp_t Cast::Operation(date_t date) {
 
 using FrameBounds = std::pair<idx_t, idx_t>;
 
+template <class INPUT_TYPE>
+struct IndirectLess {
+	inline explicit IndirectLess(const INPUT_TYPE *inputs_p) : inputs(inputs_p) {
+	}
+
+	inline bool operator()(const idx_t &lhi, const idx_t &rhi) const {
+		return inputs[lhi] < inputs[rhi];
+	}
+
+	const INPUT_TYPE *inputs;
+};
+
+//! A merge sort tree over the valid rows of a window input. The leaves are the rows in value order and every node
+//! holds the rows below it in row order, so the n-th smallest value of a frame is found by descending from the root
+//! while counting the rows of each child that fall into the frame.
+struct QuantileMergeSortTree {
+	static constexpr idx_t FANOUT = 16;
+
+	template <class INPUT_TYPE>
+	QuantileMergeSortTree(const INPUT_TYPE *data, const ValidityMask &dmask, idx_t count) {
+		vector<idx_t> leaves;
+		leaves.reserve(count);
+		for (idx_t i = 0; i < count; ++i) {
+			if (dmask.RowIsValid(i)) {
+				leaves.push_back(i);
+			}
+		}
+		// equal values keep their row order, so every row has its own leaf
+		IndirectLess<INPUT_TYPE> lt(data);
+		std::stable_sort(leaves.begin(), leaves.end(), lt);
+		const auto valid = leaves.size();
+		levels.push_back(move(leaves));
+
+		// every level sorts runs of FANOUT times as many leaves by row
+		for (idx_t run = 1; run < valid;) {
+			run *= FANOUT;
+			auto level = levels.back();
+			for (idx_t begin = 0; begin < valid; begin += run) {
+				std::sort(level.begin() + begin, level.begin() + MinValue(begin + run, valid));
+			}
+			levels.push_back(move(level));
+		}
+	}
+
+	//! The number of valid rows in the frame
+	idx_t Count(const FrameBounds &frame) const {
+		auto &root = levels.back();
+		return std::lower_bound(root.begin(), root.end(), frame.second) -
+		       std::lower_bound(root.begin(), root.end(), frame.first);
+	}
+
+	//! The row of the n-th smallest value in the frame, n must be smaller than Count(frame)
+	idx_t SelectNth(const FrameBounds &frame, idx_t n) const {
+		idx_t run = 1;
+		for (idx_t level_idx = 1; level_idx < levels.size(); ++level_idx) {
+			run *= FANOUT;
+		}
+		idx_t begin = 0;
+		for (idx_t level_idx = levels.size() - 1; level_idx > 0; --level_idx) {
+			auto &children = levels[level_idx - 1];
+			const auto end = MinValue<idx_t>(begin + run, children.size());
+			run /= FANOUT;
+			for (; begin < end; begin += run) {
+				auto lo = children.begin() + begin;
+				auto hi = children.begin() + MinValue(begin + run, end);
+				const idx_t matches = std::lower_bound(lo, hi, frame.second) - std::lower_bound(lo, hi, frame.first);
+				if (n < matches) {
+					break;
+				}
+				n -= matches;
+			}
+			D_ASSERT(begin < end);
+		}
+		return levels[0][begin];
+	}
+
+	//! The sorted runs of every level, level 0 holds the rows in value order
+	vector<vector<idx_t>> levels;
+};
+
 template <class SAVE_TYPE>
 struct QuantileState {
 	data_ptr_t v;
@@ -26,6 +106,8 @@ struct QuantileState {
 	idx_t pos;
 
 	SAVE_TYPE moving;
+	//! The merge sort tree used for large window frames, built on the first one
+	unique_ptr<QuantileMergeSortTree> tree;
 
 	QuantileState() : v(nullptr), len(0), pos(0) {
 	}
@@ -117,26 +199,13 @@ static bool ReplaceIndex(STATE *state, const INPUT_TYPE *fdata, const idx_t k, c
 }
 
 struct IndirectNotNull {
-	inline explicit IndirectNotNull(const ValidityMask &mask_p, idx_t bias_p) : mask(mask_p), bias(bias_p) {
+	inline explicit IndirectNotNull(const ValidityMask &mask_p) : mask(mask_p) {
 	}
 
 	inline bool operator()(const idx_t &idx) const {
-		return mask.RowIsValid(idx - bias);
+		return mask.RowIsValid(idx);
 	}
 	const ValidityMask &mask;
-	const idx_t bias;
-};
-
-template <class INPUT_TYPE>
-struct IndirectLess {
-	inline explicit IndirectLess(const INPUT_TYPE *inputs_p) : inputs(inputs_p) {
-	}
-
-	inline bool operator()(const idx_t &lhi, const idx_t &rhi) const {
-		return inputs[lhi] < inputs[rhi];
-	}
-
-	const INPUT_TYPE *inputs;
 };
 
 struct QuantileBindData : public FunctionData {
@@ -241,6 +310,8 @@ static AggregateFunction QuantileListAggregate(const LogicalType &input_type, co
 
 template <class SAVE_TYPE>
 struct DiscreteQuantileOperation : public QuantileOperation<SAVE_TYPE> {
+	//! The frame size from which on windows use the merge sort tree
+	static constexpr idx_t TREE_THRESHOLD = 1024;
 
 	template <class RESULT_TYPE, class STATE>
 	static void Finalize(Vector &result, FunctionData *bind_data_p, STATE *state, RESULT_TYPE *target,
@@ -261,7 +332,26 @@ struct DiscreteQuantileOperation : public QuantileOperation<SAVE_TYPE> {
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE>
 	static void Window(const INPUT_TYPE *data, const ValidityMask &dmask, FunctionData *bind_data_p, STATE *state,
-	                   const FrameBounds &frame, const FrameBounds &prev, RESULT_TYPE *result, ValidityMask &rmask) {
+	                   const FrameBounds &frame, const FrameBounds &prev, RESULT_TYPE *result, ValidityMask &rmask,
+	                   idx_t count) {
+		D_ASSERT(bind_data_p);
+		auto bind_data = (QuantileBindData *)bind_data_p;
+
+		if (state->tree || frame.second - frame.first >= TREE_THRESHOLD) {
+			//  Large frames: select from the merge sort tree instead of partitioning the frame for every row
+			if (!state->tree) {
+				state->tree = make_unique<QuantileMergeSortTree>(data, dmask, count);
+			}
+			auto valid = state->tree->Count(frame);
+			if (valid) {
+				auto offset = (idx_t)(double(valid - 1) * bind_data->quantiles[0]);
+				result[0] = RESULT_TYPE(data[state->tree->SelectNth(frame, offset)]);
+			} else {
+				rmask.Set(0, false);
+			}
+			return;
+		}
+
 		//  Lazily initialise frame state
 		state->pos = frame.second - frame.first;
 		state->template Resize<idx_t>(state->pos);
@@ -269,8 +359,6 @@ struct DiscreteQuantileOperation : public QuantileOperation<SAVE_TYPE> {
 		D_ASSERT(state->v);
 		auto index = (idx_t *)state->v;
 
-		D_ASSERT(bind_data_p);
-		auto bind_data = (QuantileBindData *)bind_data_p;
 		auto offset = (idx_t)(double(state->pos - 1) * bind_data->quantiles[0]);
 		auto same = false;
 
@@ -284,7 +372,7 @@ struct DiscreteQuantileOperation : public QuantileOperation<SAVE_TYPE> {
 		if (!same) {
 			auto valid = state->pos;
 			if (!dmask.AllValid()) {
-				IndirectNotNull not_null(dmask, MinValue(frame.first, prev.first));
+				IndirectNotNull not_null(dmask);
 				valid = std::partition(index, index + valid, not_null) - index;
 				offset = (idx_t)(double(valid - 1) * bind_data->quantiles[0]);
 			}
@@ -78,6 +78,24 @@ static void PragmaMemoryLimit(ClientContext &context, const FunctionParameters &
 	BufferManager::GetBufferManager(context).SetLimit(new_limit);
 }
 
+static void PragmaConnectionMemoryLimit(ClientContext &context, const FunctionParameters &parameters) {
+	context.memory_tracker->SetLimit(DBConfig::ParseMemoryLimit(parameters.values[0].ToString()));
+}
+
+static void PragmaQueryMemoryLimit(ClientContext &context, const FunctionParameters &parameters) {
+	context.query_memory_tracker->SetLimit(DBConfig::ParseMemoryLimit(parameters.values[0].ToString()));
+}
+
+static void PragmaQueryPriority(ClientContext &context, const FunctionParameters &parameters) {
+	context.query_priority = DBConfig::ParseQueryPriority(parameters.values[0].ToString());
+	context.scheduling_group->SetPriority(context.query_priority);
+}
+
+static void PragmaEvictionPolicy(ClientContext &context, const FunctionParameters &parameters) {
+	auto &config = DBConfig::GetConfig(context);
+	config.eviction_policy = DBConfig::ParseEvictionPolicy(parameters.values[0].ToString());
+}
+
 static void PragmaCollation(ClientContext &context, const FunctionParameters &parameters) {
 	auto collation_param = StringUtil::Lower(parameters.values[0].ToString());
 	// bind the collation to verify that it exists
@@ -116,6 +134,12 @@ static void PragmaSetThreads(ClientContext &context, const FunctionParameters &p
 	TaskScheduler::GetScheduler(context).SetThreads(nr_threads);
 }
 
+static void PragmaNumaMode(ClientContext &context, const FunctionParameters &parameters) {
+	auto &config = DBConfig::GetConfig(context);
+	config.numa_mode = parameters.values[0].GetValue<bool>();
+	TaskScheduler::GetScheduler(context).SetNumaMode(config.numa_mode);
+}
+
 static void PragmaEnableProgressBar(ClientContext &context, const FunctionParameters &parameters) {
 	context.enable_progress_bar = true;
 }
@@ -258,6 +282,12 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaAssignment("profiling_output", PragmaProfileOutput, LogicalType::VARCHAR));
 
 	set.AddFunction(PragmaFunction::PragmaAssignment("memory_limit", PragmaMemoryLimit, LogicalType::VARCHAR));
+	set.AddFunction(PragmaFunction::PragmaAssignment("eviction_policy", PragmaEvictionPolicy, LogicalType::VARCHAR));
+	set.AddFunction(PragmaFunction::PragmaAssignment("connection_memory_limit", PragmaConnectionMemoryLimit,
+	                                                 LogicalType::VARCHAR));
+	set.AddFunction(
+	    PragmaFunction::PragmaAssignment("query_memory_limit", PragmaQueryMemoryLimit, LogicalType::VARCHAR));
+	set.AddFunction(PragmaFunction::PragmaAssignment("query_priority", PragmaQueryPriority, LogicalType::VARCHAR));
 
 	set.AddFunction(PragmaFunction::PragmaAssignment("collation", PragmaCollation, LogicalType::VARCHAR));
 	set.AddFunction(PragmaFunction::PragmaAssignment("default_collation", PragmaCollation, LogicalType::VARCHAR));
@@ -270,6 +300,7 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 
 	set.AddFunction(PragmaFunction::PragmaAssignment("threads", PragmaSetThreads, LogicalType::BIGINT));
 	set.AddFunction(PragmaFunction::PragmaAssignment("worker_threads", PragmaSetThreads, LogicalType::BIGINT));
+	set.AddFunction(PragmaFunction::PragmaAssignment("numa_mode", PragmaNumaMode, LogicalType::BOOLEAN));
 
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_verification", PragmaEnableVerification));
 	set.AddFunction(PragmaFunction::PragmaStatement("disable_verification", PragmaDisableVerification));
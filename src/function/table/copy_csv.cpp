@@ -241,6 +241,12 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, CopyInfo &in
 			if (options.sample_chunks < 1) {
 				throw BinderException("Unsupported parameter for SAMPLE_CHUNKS: cannot be smaller than 1");
 			}
+		} else if (loption == "range_size") {
+			int64_t range_size = ParseInteger(set);
+			if (range_size < 1) {
+				throw BinderException("Unsupported parameter for RANGE_SIZE: cannot be smaller than 1");
+			}
+			options.range_size = range_size;
 		} else if (loption == "force_not_null") {
 			options.force_not_null = ParseColumnList(set, expected_names);
 		} else if (loption == "date_format" || loption == "dateformat") {
@@ -9,6 +9,7 @@
 #include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/tableref/table_function_ref.hpp"
 
+#include <algorithm>
 #include <limits>
 
 namespace duckdb {
@@ -118,6 +119,12 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, vector<Value
 			result->include_file_name = kv.second.value_.boolean;
 		} else if (kv.first == "skip") {
 			options.skip_rows = kv.second.GetValue<int64_t>();
+		} else if (kv.first == "range_size") {
+			int64_t range_size = kv.second.GetValue<int64_t>();
+			if (range_size < 1) {
+				throw BinderException("Unsupported parameter for RANGE_SIZE: cannot be smaller than 1");
+			}
+			options.range_size = range_size;
 		}
 	}
 	if (!options.auto_detect && return_types.empty()) {
@@ -134,6 +141,7 @@ static unique_ptr<FunctionData> ReadCSVBind(ClientContext &context, vector<Value
 
 		return_types.assign(initial_reader->sql_types.begin(), initial_reader->sql_types.end());
 		names.assign(initial_reader->col_names.begin(), initial_reader->col_names.end());
+		result->sql_types = initial_reader->sql_types;
 		result->initial_reader = move(initial_reader);
 	} else {
 		result->sql_types = return_types;
@@ -151,6 +159,12 @@ struct ReadCSVOperatorData : public FunctionOperatorData {
 	unique_ptr<BufferedCSVReader> csv_reader;
 	//! The index of the next file to read (i.e. current file + 1)
 	idx_t file_index;
+	//! The index of the byte range that is read (parallel scans only)
+	idx_t range_index;
+	//! The chunks of the byte ranges whose records have been verified, which are ready to be emitted
+	vector<unique_ptr<DataChunk>> verified_chunks;
+	//! The index of the next of those chunks to emit
+	idx_t verified_index = 0;
 };
 
 static unique_ptr<FunctionOperatorData> ReadCSVInit(ClientContext &context, const FunctionData *bind_data_p,
@@ -179,6 +193,14 @@ static unique_ptr<FunctionData> ReadCSVAutoBind(ClientContext &context, vector<V
 	return ReadCSVBind(context, inputs, named_parameters, input_table_types, input_table_names, return_types, names);
 }
 
+static void ReadCSVSetFileName(ReadCSVData &bind_data, const string &file_path, DataChunk &output) {
+	if (bind_data.include_file_name) {
+		auto &col = output.data.back();
+		col.SetValue(0, Value(file_path));
+		col.SetVectorType(VectorType::CONSTANT_VECTOR);
+	}
+}
+
 static void ReadCSVFunction(ClientContext &context, const FunctionData *bind_data_p,
                             FunctionOperatorData *operator_state, DataChunk *input, DataChunk &output) {
 	auto &bind_data = (ReadCSVData &)*bind_data_p;
@@ -196,11 +218,260 @@ static void ReadCSVFunction(ClientContext &context, const FunctionData *bind_dat
 			break;
 		}
 	} while (true);
-	if (bind_data.include_file_name) {
-		auto &col = output.data.back();
-		col.SetValue(0, Value(data.csv_reader->options.file_path));
-		col.SetVectorType(VectorType::CONSTANT_VECTOR);
+	ReadCSVSetFileName(bind_data, data.csv_reader->options.file_path, output);
+}
+
+//===--------------------------------------------------------------------===//
+// Parallel Scan
+//===--------------------------------------------------------------------===//
+//! The records read from a byte range of a file
+struct ReadCSVRange {
+	explicit ReadCSVRange(idx_t range_end_p) : range_end(range_end_p) {
+	}
+
+	//! The end of the byte range
+	idx_t range_end;
+	//! Whether or not the records of the byte range have been read
+	bool finished = false;
+	//! The [start, end) positions of the records that were read, the start is INVALID_INDEX if reading them failed
+	idx_t record_start = 0;
+	idx_t record_end = 0;
+	//! The records that were read, which are only emitted once the start of the first record has been verified
+	vector<unique_ptr<DataChunk>> chunks;
+};
+
+//! The byte ranges of a file that is read in parallel
+struct ReadCSVFileRanges {
+	//! Whether or not the file is split up into byte ranges (files that do not support seeking are read as a whole)
+	bool split = false;
+	//! The size of the file
+	idx_t file_size = 0;
+	//! The byte ranges that have been handed out
+	vector<ReadCSVRange> ranges;
+	//! The number of byte ranges (in order) of which the records have been verified
+	idx_t verified_ranges = 0;
+	//! The end of the records of the verified byte ranges, which is where the records of the next byte range start
+	idx_t verified_end = 0;
+	//! Whether or not a thread is verifying the finished byte ranges
+	bool verifying = false;
+};
+
+struct ReadCSVParallelState : public ParallelState {
+	mutex lock;
+	//! The options of the readers, with the dialect that was detected (if any)
+	BufferedCSVReaderOptions options;
+	//! The index of the file that is being split up into byte ranges
+	idx_t file_index;
+	//! The beginning of the next byte range of that file
+	idx_t next_range;
+	//! The byte ranges of every file
+	vector<ReadCSVFileRanges> file_ranges;
+};
+
+static idx_t ReadCSVMaxThreads(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	// estimate the number of byte ranges from the size of the first file
+	idx_t file_size;
+	if (bind_data.initial_reader) {
+		file_size = bind_data.initial_reader->file_size;
+	} else {
+		auto &fs = FileSystem::GetFileSystem(context);
+		auto handle = fs.OpenFile(bind_data.files[0], FileFlags::FILE_FLAGS_READ);
+		file_size = handle->GetFileSize();
+	}
+	return (file_size / bind_data.options.range_size + 1) * bind_data.files.size();
+}
+
+static unique_ptr<ParallelState> ReadCSVInitParallelState(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	auto result = make_unique<ReadCSVParallelState>();
+	// the byte ranges are read with the dialect that was detected in the first file
+	if (bind_data.initial_reader) {
+		result->options = bind_data.initial_reader->options;
+	} else if (bind_data.options.auto_detect) {
+		auto options = bind_data.options;
+		options.file_path = bind_data.files[0];
+		BufferedCSVReader reader(context, options, bind_data.sql_types);
+		result->options = reader.options;
+	} else {
+		result->options = bind_data.options;
+	}
+	result->options.auto_detect = false;
+	result->file_index = 0;
+	result->next_range = 0;
+	result->file_ranges.resize(bind_data.files.size());
+	return move(result);
+}
+
+//! Reads all the records of the byte range of a reader. If the start of the first record was searched for, a parse
+//! error only means that the search was wrong: the range is then marked as failed, so that it is read again.
+static void ReadCSVReadRange(ReadCSVData &bind_data, BufferedCSVReader &reader, const vector<LogicalType> &types,
+                             bool verified_start, ReadCSVRange &range) {
+	range.finished = true;
+	range.chunks.clear();
+	try {
+		while (true) {
+			auto chunk = make_unique<DataChunk>();
+			chunk->Initialize(types);
+			reader.ParseCSV(*chunk);
+			if (chunk->size() == 0) {
+				break;
+			}
+			ReadCSVSetFileName(bind_data, reader.options.file_path, *chunk);
+			range.chunks.push_back(move(chunk));
+		}
+	} catch (const InvalidInputException &e) {
+		if (verified_start) {
+			throw;
+		}
+		range.chunks.clear();
+		range.record_start = INVALID_INDEX;
+		return;
+	}
+	range.record_start = reader.range_start;
+	range.record_end = reader.FilePosition();
+}
+
+//! Stores the records read from a byte range, and verifies the finished byte ranges in order: the records of a byte
+//! range have to start exactly where the records of the previous one ended. This is not the case if the start of the
+//! first record was guessed wrongly (e.g. because quoted values contain newlines and look like rows), in which case
+//! the byte range is read again from the verified position. The chunks of the verified byte ranges are handed to the
+//! calling thread to emit.
+static void ReadCSVFinishRange(ClientContext &context, ReadCSVData &bind_data, ReadCSVParallelState &parallel_state,
+                               ReadCSVOperatorData &data, const vector<LogicalType> &types, ReadCSVRange range) {
+	unique_lock<mutex> parallel_lock(parallel_state.lock);
+	const auto file_index = data.file_index - 1;
+	auto &ranges = parallel_state.file_ranges[file_index];
+	ranges.ranges[data.range_index] = move(range);
+	if (ranges.verifying) {
+		// another thread is verifying the byte ranges and will pick this one up
+		return;
+	}
+	ranges.verifying = true;
+	while (ranges.verified_ranges < ranges.ranges.size() && ranges.ranges[ranges.verified_ranges].finished) {
+		auto &next = ranges.ranges[ranges.verified_ranges];
+		if (ranges.verified_end >= next.range_end) {
+			// a record of the previous byte ranges extends past this byte range: no records start in it
+			next.chunks.clear();
+		} else if (next.record_start != ranges.verified_end) {
+			// read the byte range again from the end of the records of the previous byte range
+			auto range_begin = ranges.verified_end;
+			ReadCSVRange reread(next.range_end);
+			parallel_lock.unlock();
+			auto options = parallel_state.options;
+			options.file_path = bind_data.files[file_index];
+			BufferedCSVReader reader(context, options, bind_data.sql_types, range_begin, reread.range_end, true);
+			ReadCSVReadRange(bind_data, reader, types, true, reread);
+			parallel_lock.lock();
+			ranges.ranges[ranges.verified_ranges] = move(reread);
+			continue;
+		} else {
+			ranges.verified_end = next.record_end;
+		}
+		for (auto &chunk : next.chunks) {
+			data.verified_chunks.push_back(move(chunk));
+		}
+		next.chunks.clear();
+		ranges.verified_ranges++;
+	}
+	ranges.verifying = false;
+}
+
+static bool ReadCSVParallelStateNext(ClientContext &context, const FunctionData *bind_data_p,
+                                     FunctionOperatorData *state_p, ParallelState *parallel_state_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	auto &parallel_state = (ReadCSVParallelState &)*parallel_state_p;
+	auto &data = (ReadCSVOperatorData &)*state_p;
+
+	idx_t range_begin;
+	{
+		lock_guard<mutex> parallel_lock(parallel_state.lock);
+		while (true) {
+			if (parallel_state.file_index >= bind_data.files.size()) {
+				// exhausted all the files: done
+				return false;
+			}
+			auto &ranges = parallel_state.file_ranges[parallel_state.file_index];
+			auto options = parallel_state.options;
+			options.file_path = bind_data.files[parallel_state.file_index];
+			data.file_index = parallel_state.file_index + 1;
+			data.range_index = ranges.ranges.size();
+			if (ranges.ranges.empty()) {
+				// the first byte range of a file, which also tells us whether the file can be split up at all
+				data.csv_reader =
+				    make_unique<BufferedCSVReader>(context, options, bind_data.sql_types, 0, options.range_size);
+				ranges.split = data.csv_reader->plain_file_source;
+				ranges.file_size = data.csv_reader->file_size;
+				parallel_state.next_range = ranges.split ? options.range_size : ranges.file_size;
+				ranges.ranges.emplace_back(ranges.split ? options.range_size : NumericLimits<idx_t>::Maximum());
+				bind_data.file_size = ranges.file_size;
+				bind_data.bytes_read = 0;
+				return true;
+			}
+			if (parallel_state.next_range < ranges.file_size) {
+				// hand out the next byte range of the file
+				range_begin = parallel_state.next_range;
+				parallel_state.next_range += options.range_size;
+				ranges.ranges.emplace_back(range_begin + options.range_size);
+				bind_data.bytes_read = range_begin;
+				break;
+			}
+			// all byte ranges of this file have been handed out: move to the next file
+			parallel_state.file_index++;
+			parallel_state.next_range = 0;
+		}
 	}
+	// finding the first record of the byte range parses speculatively, so we do that without holding the lock
+	auto options = parallel_state.options;
+	options.file_path = bind_data.files[data.file_index - 1];
+	data.csv_reader = make_unique<BufferedCSVReader>(context, options, bind_data.sql_types, range_begin,
+	                                                 range_begin + options.range_size);
+	return true;
+}
+
+static unique_ptr<FunctionOperatorData> ReadCSVParallelInit(ClientContext &context, const FunctionData *bind_data_p,
+                                                            ParallelState *parallel_state_p,
+                                                            const vector<column_t> &column_ids,
+                                                            TableFilterCollection *filters) {
+	auto result = make_unique<ReadCSVOperatorData>();
+	if (!ReadCSVParallelStateNext(context, bind_data_p, result.get(), parallel_state_p)) {
+		return nullptr;
+	}
+	return move(result);
+}
+
+static void ReadCSVFunctionParallel(ClientContext &context, const FunctionData *bind_data_p,
+                                    FunctionOperatorData *operator_state, DataChunk *input, DataChunk &output,
+                                    ParallelState *parallel_state_p) {
+	auto &bind_data = (ReadCSVData &)*bind_data_p;
+	auto &parallel_state = (ReadCSVParallelState &)*parallel_state_p;
+	auto &data = (ReadCSVOperatorData &)*operator_state;
+	while (true) {
+		if (data.verified_index < data.verified_chunks.size()) {
+			output.Reference(*data.verified_chunks[data.verified_index++]);
+			return;
+		}
+		data.verified_chunks.clear();
+		data.verified_index = 0;
+		if (!data.csv_reader) {
+			// the byte range has been read and all the verified records have been emitted
+			return;
+		}
+		// the records of the byte range are only emitted once the start of the first record has been verified
+		auto &reader = *data.csv_reader;
+		ReadCSVRange range(reader.range_end);
+		ReadCSVReadRange(bind_data, reader, output.GetTypes(), reader.range_start == 0, range);
+		data.csv_reader.reset();
+		ReadCSVFinishRange(context, bind_data, parallel_state, data, output.GetTypes(), move(range));
+	}
+}
+
+static void ReadCSVAddParallelFunctions(TableFunction &table_function) {
+	table_function.max_threads = ReadCSVMaxThreads;
+	table_function.init_parallel_state = ReadCSVInitParallelState;
+	table_function.parallel_function = ReadCSVFunctionParallel;
+	table_function.parallel_init = ReadCSVParallelInit;
+	table_function.parallel_state_next = ReadCSVParallelStateNext;
 }
 
 static void ReadCSVAddNamedParameters(TableFunction &table_function) {
@@ -222,6 +493,7 @@ static void ReadCSVAddNamedParameters(TableFunction &table_function) {
 	table_function.named_parameters["compression"] = LogicalType::VARCHAR;
 	table_function.named_parameters["filename"] = LogicalType::BOOLEAN;
 	table_function.named_parameters["skip"] = LogicalType::BIGINT;
+	table_function.named_parameters["range_size"] = LogicalType::BIGINT;
 }
 
 int CSVReaderProgress(ClientContext &context, const FunctionData *bind_data_p) {
@@ -237,6 +509,7 @@ TableFunction ReadCSVTableFunction::GetFunction() {
 	TableFunction read_csv("read_csv", {LogicalType::VARCHAR}, ReadCSVFunction, ReadCSVBind, ReadCSVInit);
 	read_csv.table_scan_progress = CSVReaderProgress;
 	ReadCSVAddNamedParameters(read_csv);
+	ReadCSVAddParallelFunctions(read_csv);
 	return read_csv;
 }
 
@@ -246,6 +519,7 @@ void ReadCSVTableFunction::RegisterFunction(BuiltinFunctions &set) {
 	TableFunction read_csv_auto("read_csv_auto", {LogicalType::VARCHAR}, ReadCSVFunction, ReadCSVAutoBind, ReadCSVInit);
 	read_csv_auto.table_scan_progress = CSVReaderProgress;
 	ReadCSVAddNamedParameters(read_csv_auto);
+	ReadCSVAddParallelFunctions(read_csv_auto);
 	set.AddFunction(read_csv_auto);
 }
 
@@ -0,0 +1,173 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/connection_manager.hpp"
+
+namespace duckdb {
+
+struct BufferStatsEntry {
+	BufferStatsEntry(string scope_p, Value current_p, MemoryTracker &tracker)
+	    : scope(move(scope_p)), current(move(current_p)), memory_usage(tracker.GetMemoryUsage()),
+	      peak_memory_usage(tracker.GetPeakMemoryUsage()), memory_limit(LimitToValue(tracker.GetLimit())),
+	      bytes_spilled(tracker.GetBytesSpilled()), bytes_read(tracker.GetBytesRead()) {
+	}
+
+	static Value LimitToValue(idx_t limit) {
+		return limit == INVALID_INDEX ? Value() : Value::BIGINT(limit);
+	}
+
+	string scope;
+	Value current;
+	idx_t memory_usage;
+	idx_t peak_memory_usage;
+	Value memory_limit;
+	Value query_memory_usage;
+	Value query_peak_memory_usage;
+	Value query_memory_limit;
+	idx_t bytes_spilled;
+	idx_t bytes_read;
+};
+
+struct PragmaBufferStatsData : public FunctionOperatorData {
+	PragmaBufferStatsData() : offset(0) {
+	}
+
+	vector<BufferStatsEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> PragmaBufferStatsBind(ClientContext &context, vector<Value> &inputs,
+                                                      unordered_map<string, Value> &named_parameters,
+                                                      vector<LogicalType> &input_table_types,
+                                                      vector<string> &input_table_names,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("scope");
+	return_types.push_back(LogicalType::VARCHAR);
+
+	names.emplace_back("current");
+	return_types.push_back(LogicalType::BOOLEAN);
+
+	names.emplace_back("memory_usage");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("peak_memory_usage");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("query_memory_usage");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("query_peak_memory_usage");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("query_memory_limit");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("bytes_spilled");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("bytes_read");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_limit");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("eviction_policy");
+	return_types.push_back(LogicalType::VARCHAR);
+
+	names.emplace_back("block_hits");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("block_misses");
+	return_types.push_back(LogicalType::BIGINT);
+
+	names.emplace_back("evictions");
+	return_types.push_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<FunctionOperatorData> PragmaBufferStatsInit(ClientContext &context, const FunctionData *bind_data,
+                                                       const vector<column_t> &column_ids,
+                                                       TableFilterCollection *filters) {
+	auto result = make_unique<PragmaBufferStatsData>();
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	result->entries.emplace_back("database", Value(), *buffer_manager.GetMemoryTracker());
+	// the memory usage of the database includes memory that is not accounted to any tracker (e.g. reserved memory)
+	result->entries.back().memory_usage = buffer_manager.GetUsedMemory();
+	result->entries.back().memory_limit = BufferStatsEntry::LimitToValue(buffer_manager.GetMaxMemory());
+
+	auto &connection_manager = ConnectionManager::Get(context);
+	lock_guard<mutex> connection_lock(connection_manager.connections_lock);
+	for (auto &connection : connection_manager.GetConnectionList()) {
+		auto &query_tracker = *connection->query_memory_tracker;
+		BufferStatsEntry entry("connection", Value::BOOLEAN(connection.get() == &context),
+		                       *connection->memory_tracker);
+		entry.query_memory_usage = Value::BIGINT(query_tracker.GetMemoryUsage());
+		entry.query_peak_memory_usage = Value::BIGINT(query_tracker.GetPeakMemoryUsage());
+		entry.query_memory_limit = BufferStatsEntry::LimitToValue(query_tracker.GetLimit());
+		result->entries.push_back(move(entry));
+	}
+	return move(result);
+}
+
+void PragmaBufferStatsFunction(ClientContext &context, const FunctionData *bind_data,
+                               FunctionOperatorData *operator_state, DataChunk *input, DataChunk &output) {
+	auto &data = (PragmaBufferStatsData &)*operator_state;
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	auto &config = DBConfig::GetConfig(context);
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+
+		// scope, VARCHAR
+		output.SetValue(0, count, Value(entry.scope));
+		// current, BOOLEAN
+		output.SetValue(1, count, entry.current);
+		// memory_usage, BIGINT
+		output.SetValue(2, count, Value::BIGINT(entry.memory_usage));
+		// peak_memory_usage, BIGINT
+		output.SetValue(3, count, Value::BIGINT(entry.peak_memory_usage));
+		// query_memory_usage, BIGINT
+		output.SetValue(4, count, entry.query_memory_usage);
+		// query_peak_memory_usage, BIGINT
+		output.SetValue(5, count, entry.query_peak_memory_usage);
+		// query_memory_limit, BIGINT
+		output.SetValue(6, count, entry.query_memory_limit);
+		// bytes_spilled, BIGINT
+		output.SetValue(7, count, Value::BIGINT(entry.bytes_spilled));
+		// bytes_read, BIGINT
+		output.SetValue(8, count, Value::BIGINT(entry.bytes_read));
+		// memory_limit, BIGINT
+		output.SetValue(9, count, entry.memory_limit);
+		if (entry.scope == "database") {
+			// eviction_policy, VARCHAR
+			output.SetValue(10, count, Value(DBConfig::EvictionPolicyToString(config.eviction_policy)));
+			// block_hits, BIGINT
+			output.SetValue(11, count, Value::BIGINT(buffer_manager.GetBlockHits()));
+			// block_misses, BIGINT
+			output.SetValue(12, count, Value::BIGINT(buffer_manager.GetBlockMisses()));
+			// evictions, BIGINT
+			output.SetValue(13, count, Value::BIGINT(buffer_manager.GetEvictions()));
+		} else {
+			for (idx_t col_idx = 10; col_idx < output.ColumnCount(); col_idx++) {
+				output.SetValue(col_idx, count, Value());
+			}
+		}
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void PragmaBufferStats::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_buffer_stats", {}, PragmaBufferStatsFunction, PragmaBufferStatsBind,
+	                              PragmaBufferStatsInit));
+}
+
+} // namespace duckdb
@@ -74,6 +74,9 @@ static unique_ptr<FunctionData> PragmaStorageInfoBind(ClientContext &context, ve
 	names.emplace_back("block_offset");
 	return_types.push_back(LogicalType::BIGINT);
 
+	names.emplace_back("compression");
+	return_types.push_back(LogicalType::VARCHAR);
+
 	auto qname = QualifiedName::Parse(inputs[0].GetValue<string>());
 
 	// look up the table name in the catalog
@@ -0,0 +1,29 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/compression_type.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Segment Compression Types
+//===--------------------------------------------------------------------===//
+enum class CompressionType : uint8_t {
+	COMPRESSION_UNCOMPRESSED = 0, // the segment is stored uncompressed
+	COMPRESSION_CONSTANT = 1,     // every value in the segment is identical; the value is stored in the statistics
+	COMPRESSION_RLE = 2,          // run-length encoding: (value, run end) pairs
+	COMPRESSION_BITPACKING = 3,   // frame-of-reference: offsets from the segment minimum, bitpacked to a fixed width
+	COMPRESSION_DICTIONARY = 4    // strings are stored once in a dictionary, rows store bitpacked dictionary codes
+};
+
+//! Convert a compression type to a string
+string CompressionTypeToString(CompressionType type);
+
+} // namespace duckdb
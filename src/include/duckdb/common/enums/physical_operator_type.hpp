@@ -52,6 +52,8 @@ enum class PhysicalOperatorType : uint8_t {
 	HASH_JOIN,
 	CROSS_PRODUCT,
 	PIECEWISE_MERGE_JOIN,
+	IE_JOIN,
+	ASOF_JOIN,
 	DELIM_JOIN,
 	INDEX_JOIN,
 	// -----------------------------
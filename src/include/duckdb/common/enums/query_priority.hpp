@@ -0,0 +1,19 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/query_priority.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The scheduling priority of the queries of a connection. Busy connections share the threads of the task scheduler
+//! in proportion to the weight of their priority.
+enum class QueryPriority : uint8_t { LOW = 0, NORMAL = 1, HIGH = 2 };
+
+} // namespace duckdb
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/numa.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <thread>
+
+namespace duckdb {
+
+//! NumaTopology describes the NUMA nodes of the machine and the CPUs that belong to each node. On platforms where the
+//! topology cannot be detected the machine is treated as a single node, and pinning and memory placement are no-ops.
+class NumaTopology {
+public:
+	NumaTopology();
+
+	//! Returns the (lazily detected) topology of the machine
+	static const NumaTopology &Get();
+
+	//! The amount of NUMA nodes
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+	//! The CPUs that belong to the given node
+	const vector<idx_t> &GetCpus(idx_t node) const {
+		return node_cpus[node];
+	}
+	//! Returns the node of the CPU the calling thread is currently running on
+	idx_t GetCurrentNode() const;
+
+	//! Restricts the given thread to run on the given CPU, returns false if this is not supported
+	static bool PinThread(std::thread &thread, idx_t cpu);
+	//! Allows the given thread to run on the CPUs the process was allowed to run on when the topology was detected
+	static void UnpinThread(std::thread &thread);
+	//! Places the pages of the given memory region on the given node. Pages that are already in use are migrated.
+	static void PlaceMemory(data_ptr_t pointer, idx_t size, idx_t node);
+
+private:
+	//! The CPUs of every node
+	vector<vector<idx_t>> node_cpus;
+	//! The node of every CPU
+	vector<idx_t> cpu_node;
+	//! The id the operating system uses for every node
+	vector<idx_t> node_ids;
+	//! The CPUs the process was allowed to run on before any thread was pinned (e.g. restricted by taskset or cgroups)
+	vector<idx_t> process_cpus;
+};
+
+} // namespace duckdb
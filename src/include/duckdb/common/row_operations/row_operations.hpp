@@ -14,6 +14,7 @@
 namespace duckdb {
 
 struct AggregateObject;
+class BufferManager;
 class DataChunk;
 class RowLayout;
 class RowDataCollection;
@@ -61,6 +62,14 @@ struct RowOperations {
 	static idx_t Match(DataChunk &columns, VectorData col_data[], const RowLayout &layout, Vector &rows,
 	                   const Predicates &predicates, SelectionVector &sel, idx_t count, SelectionVector *no_match,
 	                   idx_t &no_match_count);
+
+	//===--------------------------------------------------------------------===//
+	// Sort Operators
+	//===--------------------------------------------------------------------===//
+	//! Radix sort count rows of entry_size bytes on the sorting_size bytes that start at col_offset.
+	//! The keys have to be serialized with RowDataCollection::SerializeVectorSortable.
+	static void RadixSort(BufferManager &buffer_manager, data_ptr_t dataptr, const idx_t &count, const idx_t &col_offset,
+	                      const idx_t &sorting_size, const idx_t &entry_size);
 };
 
 } // namespace duckdb
@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/types/buffered_chunk_collection.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+
+namespace duckdb {
+class BlockHandle;
+class BufferHandle;
+class BufferManager;
+
+struct BufferedChunkScanState {
+	BufferedChunkScanState();
+	~BufferedChunkScanState();
+
+	//! The block that is currently scanned
+	idx_t block_idx;
+	//! The offset of the next chunk within the block
+	idx_t position;
+	//! The pinned handle of the block that is currently scanned
+	unique_ptr<BufferHandle> handle;
+};
+
+//! A BufferedChunkCollection stores DataChunks in serialized form in blocks of the buffer manager. The blocks are only
+//! pinned while a chunk is appended or scanned, so the buffer manager can evict them to the temporary directory when
+//! memory runs out. This is used to hold intermediates of operators that (partially) run out-of-core.
+class BufferedChunkCollection {
+public:
+	explicit BufferedChunkCollection(BufferManager &buffer_manager);
+	~BufferedChunkCollection();
+
+	//! Append a copy of the chunk to the collection, this can be called from multiple threads
+	void Append(DataChunk &chunk);
+	//! Scan the next chunk of the collection into the result chunk (which is re-initialized), returns false if all
+	//! chunks have been scanned. Appending to the collection while it is scanned is not allowed.
+	bool Scan(BufferedChunkScanState &state, DataChunk &result);
+	//! Move the chunks of another collection to the end of this collection
+	void Merge(BufferedChunkCollection &other);
+	//! Remove all chunks from the collection, releasing their blocks
+	void Clear();
+
+	//! The amount of rows in the collection
+	idx_t Count() const {
+		return count;
+	}
+	//! The size of the serialized chunks in bytes
+	idx_t SizeInBytes() const {
+		return size_in_bytes;
+	}
+
+private:
+	struct BufferedChunkBlock {
+		shared_ptr<BlockHandle> block;
+		//! The amount of bytes that can be written to the block
+		idx_t capacity;
+		//! The amount of bytes that have been written to the block
+		idx_t size;
+	};
+
+	BufferManager &buffer_manager;
+	mutex lock;
+	vector<BufferedChunkBlock> blocks;
+	idx_t count;
+	idx_t size_in_bytes;
+};
+
+} // namespace duckdb
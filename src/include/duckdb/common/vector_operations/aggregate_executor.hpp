@@ -335,14 +335,58 @@ public:
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
 	static void UnaryWindow(Vector &input, FunctionData *bind_data, data_ptr_t state, const FrameBounds &frame,
-	                        const FrameBounds &prev, Vector &result) {
+	                        const FrameBounds &prev, Vector &result, idx_t count) {
 
-		auto idata = FlatVector::GetData<const INPUT_TYPE>(input) - MinValue(frame.first, prev.first);
+		auto idata = FlatVector::GetData<const INPUT_TYPE>(input);
 		const auto &ivalid = FlatVector::Validity(input);
 		auto rdata = ConstantVector::GetData<RESULT_TYPE>(result);
 		auto &rvalid = ConstantVector::Validity(result);
 		OP::template Window<STATE, INPUT_TYPE, RESULT_TYPE>(idata, ivalid, bind_data, (STATE *)state, frame, prev,
-		                                                    rdata, rvalid);
+		                                                    rdata, rvalid, count);
+	}
+
+	//! Computes the window of an aggregate that can remove values from its state again (OP::Inverse): only the rows
+	//! that left or entered the frame since the previous row are touched
+	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
+	static void UnaryInvertibleWindow(Vector &input, FunctionData *bind_data, data_ptr_t state_p,
+	                                  const FrameBounds &frame, const FrameBounds &prev, Vector &result) {
+		auto idata = FlatVector::GetData<INPUT_TYPE>(input);
+		auto &ivalid = FlatVector::Validity(input);
+		auto state = (STATE *)state_p;
+		if (frame.first >= prev.second || frame.second <= prev.first) {
+			// the frames do not overlap: start over
+			OP::template Initialize<STATE>(state);
+			for (auto f = frame.first; f < frame.second; ++f) {
+				if (ivalid.RowIsValid(f)) {
+					OP::template Operation<INPUT_TYPE, STATE, OP>(state, bind_data, idata, ivalid, f);
+				}
+			}
+		} else {
+			// for p in P \ F: remove
+			for (auto p = prev.first; p < frame.first; ++p) {
+				if (ivalid.RowIsValid(p)) {
+					OP::template Inverse<INPUT_TYPE, STATE, OP>(state, bind_data, idata, ivalid, p);
+				}
+			}
+			for (auto p = frame.second; p < prev.second; ++p) {
+				if (ivalid.RowIsValid(p)) {
+					OP::template Inverse<INPUT_TYPE, STATE, OP>(state, bind_data, idata, ivalid, p);
+				}
+			}
+			// for f in F \ P: add
+			for (auto f = frame.first; f < prev.first; ++f) {
+				if (ivalid.RowIsValid(f)) {
+					OP::template Operation<INPUT_TYPE, STATE, OP>(state, bind_data, idata, ivalid, f);
+				}
+			}
+			for (auto f = prev.second; f < frame.second; ++f) {
+				if (ivalid.RowIsValid(f)) {
+					OP::template Operation<INPUT_TYPE, STATE, OP>(state, bind_data, idata, ivalid, f);
+				}
+			}
+		}
+		auto rdata = ConstantVector::GetData<RESULT_TYPE>(result);
+		OP::template Finalize<RESULT_TYPE, STATE>(result, bind_data, state, rdata, ConstantVector::Validity(result), 0);
 	}
 
 	template <class STATE_TYPE, class OP>
@@ -13,6 +13,7 @@
 namespace duckdb {
 class BlockHandle;
 class BufferHandle;
+class BufferedChunkCollection;
 class RowDataCollection;
 
 //! GroupedAggregateHashTable is a linear probing HT that is used for computing
@@ -98,6 +99,15 @@ public:
 
 	void Partition(vector<GroupedAggregateHashTable *> &partition_hts, hash_t mask, idx_t shift);
 
+	//! Append the groups and the aggregate states of the HT to the collection, so the HT can be released. This
+	//! requires that the aggregate states do not own any memory (i.e. the aggregates have no destructor).
+	void SerializeStates(BufferedChunkCollection &target);
+	//! Combine the groups and aggregate states that were written to the collection by SerializeStates into the HT
+	void CombineSerialized(BufferedChunkCollection &source);
+
+	//! The amount of memory used by the HT (in bytes)
+	idx_t SizeInBytes();
+
 	void Finalize();
 
 	//! The stringheap of the AggregateHashTable
@@ -160,6 +170,7 @@ private:
 	void Verify();
 
 	void FlushMove(Vector &source_addresses, Vector &source_hashes, idx_t count);
+	void FlushSerialize(Vector &source_addresses, idx_t count, DataChunk &chunk, BufferedChunkCollection &target);
 	void NewBlock();
 
 	template <class ENTRY>
@@ -9,10 +9,12 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/types/buffered_chunk_collection.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/row_layout.hpp"
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/operator/logical_comparison_join.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
@@ -42,6 +44,13 @@ struct JoinHTScanState {
    [POINTER]
    [POINTER]
    The pointers are either NULL
+
+   When the build side grows beyond the memory budget of the HT, the HT switches to a partitioned (hybrid hash join)
+   mode: the rest of the build side is radix partitioned on the hash of the keys and the partitions are stored in
+   BufferedChunkCollections, which the BufferManager can evict to the temporary directory. Finalize moves the rows that
+   were already in the HT into the partitions as well, and then builds the HT out of as many partitions as fit within
+   the budget. Probe rows that belong to the other partitions are partitioned and spilled in the same way, and once the
+   probe side has been consumed the spilled partitions are joined one group at a time.
 */
 class JoinHashTable {
 public:
@@ -129,17 +138,50 @@ public:
 
 	//! Add the given data to the HT
 	void Build(DataChunk &keys, DataChunk &input);
+	//! Set the amount of memory the HT can use, the HT is partitioned when its build side grows beyond this size
+	void SetMemoryBudget(idx_t budget) {
+		memory_budget = budget;
+	}
 	//! Finalize the build of the HT, constructing the actual hash table and making the HT ready for probing. Finalize
 	//! must be called before any call to Probe, and after Finalize is called Build should no longer be ever called.
 	void Finalize();
+	//! Move the rows of another (thread-local) HT into this HT
+	void Merge(JoinHashTable &other);
+
+	//! Finalize in parallel: InitializeHashMap allocates the hash map, after which disjoint ranges of blocks can be
+	//! inserted by different threads. The HT is finalized once all blocks have been inserted.
+	void InitializeHashMap();
+	void InsertBlocks(idx_t block_start, idx_t block_end, bool parallel);
+	idx_t BlockCount() {
+		return blocks.size();
+	}
 	//! Probe the HT with the given input chunk, resulting in the given result
 	unique_ptr<ScanStructure> Probe(DataChunk &keys);
 	//! Scan the HT to construct the final full outer join result after
 	void ScanFullOuter(DataChunk &result, JoinHTScanState &state);
 
+	//! Partitioned HT only: spill the probe rows that belong to partitions that are not in the HT; the keys and payload
+	//! are sliced to the rows that can be probed right away
+	void SpillProbe(DataChunk &keys, DataChunk &payload);
+	//! Partitioned HT only: replace the contents of the HT by the next group of spilled partitions, returns false if
+	//! all partitions have been joined
+	bool PrepareNextPartitions();
+	//! Partitioned HT only: scan the next chunk of the spilled probe rows of the partitions in the HT, returns false
+	//! if all of them have been scanned
+	bool ScanSpilledProbe(DataChunk &keys, DataChunk &payload);
+
+	//! The amount of build rows in the HT
 	idx_t size() {
 		return count;
 	}
+	//! The amount of build rows in the HT and in its spilled partitions
+	idx_t TotalCount() {
+		return external ? total_count : count;
+	}
+	//! Whether or not the build side was partitioned because it did not fit within the memory budget
+	bool IsExternal() {
+		return external;
+	}
 
 	//! The stringheap of the JoinHashTable
 	unique_ptr<RowDataCollection> string_heap;
@@ -175,6 +217,11 @@ public:
 	uint64_t bitmask;
 	//! The amount of entries stored per block
 	idx_t block_capacity;
+	//! Whether or not a Bloom filter over the keys is built when the hash map is constructed (only possible with a
+	//! single equality condition)
+	bool build_bloom_filter;
+	//! The Bloom filter over the hashes of the keys in the hash map, used as a runtime filter for the probe side
+	shared_ptr<BloomFilterData> bloom_filter;
 
 	struct {
 		mutex mj_lock;
@@ -194,12 +241,37 @@ public:
 	} correlated_mark_join_info;
 
 private:
+	//! The amount of bits of the hash used to partition the build and probe side of a partitioned HT
+	static constexpr const idx_t PARTITION_RADIX_BITS = 6;
+	static constexpr const idx_t PARTITION_COUNT = idx_t(1) << PARTITION_RADIX_BITS;
+	//! The maximum amount of keys for which a Bloom filter is built
+	static constexpr const idx_t BLOOM_FILTER_MAX_COUNT = 1 << 22;
+
+	//! Append the given data to the rows of the HT
+	void Insert(DataChunk &keys, DataChunk &payload);
+	//! Construct the hash map over the rows of the HT
+	void ConstructHashMap();
+	//! Create the partitions of the build and probe side and mark the HT as partitioned
+	void InitializePartitions();
+	//! Pin the blocks of the string heap that were added since the last call, the rows point into these blocks
+	void PinHeapBlocks();
+	//! The amount of memory that the HT requires to be finalized
+	idx_t SizeInBytes();
+	//! Release the rows and the hash map of the HT
+	void ClearRows();
+	//! Move the rows of the HT into the build partitions
+	void PartitionRows();
+	//! Radix partition the input rows on the given hashes and append them to the given partitions. The rows of
+	//! partitions that are in the HT are not appended, they are added to resident_sel instead (if it is set). Returns
+	//! the amount of such rows.
+	idx_t PartitionChunk(DataChunk &input, Vector &hashes, vector<unique_ptr<BufferedChunkCollection>> &partitions,
+	                     SelectionVector *resident_sel);
 	//! Apply a bitmask to the hashes
 	void ApplyBitmask(Vector &hashes, idx_t count);
 	void ApplyBitmask(Vector &hashes, const SelectionVector &sel, idx_t count, Vector &pointers);
 	//! Insert the given set of locations into the HT with the given set of
-	//! hashes. Caller should hold lock in parallel HT.
-	void InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[]);
+	//! hashes. If parallel is set, other threads can insert into the HT at the same time.
+	void InsertHashes(Vector &hashes, idx_t count, data_ptr_t key_locations[], bool parallel);
 
 	idx_t PrepareKeys(DataChunk &keys, unique_ptr<VectorData[]> &key_data, const SelectionVector *&current_sel,
 	                  SelectionVector &sel, bool build_side);
@@ -208,12 +280,36 @@ private:
 	idx_t count;
 	//! The blocks holding the main data of the hash table
 	vector<HTDataBlock> blocks;
-	//! Pinned handles, these are pinned during finalization only
+	//! Pinned handles of the blocks (by block index), these are pinned during finalization only
 	vector<unique_ptr<BufferHandle>> pinned_handles;
 	//! The hash map of the HT, created after finalization
 	unique_ptr<BufferHandle> hash_map;
 	//! Whether or not NULL values are considered equal in each of the comparisons
 	vector<bool> null_values_are_equal;
+	//! Pinned handles of the blocks of the string heap
+	vector<unique_ptr<BufferHandle>> heap_handles;
+	//! The size of the blocks of the string heap
+	idx_t heap_size;
+
+	//! The amount of memory the HT can use before it is partitioned
+	idx_t memory_budget;
+	//! Whether or not the HT is partitioned
+	atomic<bool> external;
+	//! The amount of build rows of a partitioned HT
+	idx_t total_count;
+	//! The partitions of the build side (keys + payload) and of the probe side (payload + keys) of a partitioned HT
+	vector<unique_ptr<BufferedChunkCollection>> build_partitions;
+	vector<unique_ptr<BufferedChunkCollection>> probe_partitions;
+	//! Whether or not the build rows of each partition are in the HT
+	vector<bool> partition_resident;
+	//! The range of partitions that is in the HT (after the probe side has been consumed)
+	idx_t partition_start;
+	idx_t partition_end;
+	//! The spilled probe partition that is currently scanned
+	idx_t probe_partition;
+	BufferedChunkScanState probe_scan_state;
+	//! The most recently scanned chunk of spilled probe rows
+	DataChunk probe_chunk;
 
 	//! Copying not allowed
 	JoinHashTable(const JoinHashTable &) = delete;
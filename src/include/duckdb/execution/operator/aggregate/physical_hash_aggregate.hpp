@@ -34,6 +34,8 @@ public:
 	bool is_implicit_aggr;
 	//! Whether or not all aggregates are combinable
 	bool all_combinable;
+	//! Whether or not the states of all aggregates can be spilled to disk (i.e. they do not own any memory)
+	bool all_serializable;
 
 	//! Whether or not any aggregation is DISTINCT
 	bool any_distinct;
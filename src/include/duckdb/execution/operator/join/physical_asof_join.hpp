@@ -0,0 +1,48 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_asof_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalAsOfJoin joins every row of the LHS with the closest row of the RHS that has the same equality keys and
+//! satisfies the inequality condition, which is the last condition. The RHS is partitioned on the hash of the
+//! equality keys and sorted on the inequality key within every partition. Every chunk of the LHS is sorted in the
+//! same way and merged with the RHS in a single pass.
+class PhysicalAsOfJoin : public PhysicalComparisonJoin {
+public:
+	PhysicalAsOfJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	                 vector<JoinCondition> cond, JoinType join_type, idx_t estimated_cardinality);
+
+	vector<LogicalType> join_key_types;
+
+public:
+	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
+	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+	          DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) override;
+	bool Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) override;
+
+	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) const override;
+	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+	void FinalizeOperatorState(PhysicalOperatorState &state, ExecutionContext &context) override;
+
+	//! Whether or not the key of the inequality condition of an AsOf join can have the given type
+	static bool IsSupportedInequalityType(const LogicalType &type);
+
+private:
+	//! The size of the sortable hash of the equality keys (if there are any) and the key of the inequality condition
+	idx_t hash_size;
+	idx_t key_size;
+};
+
+} // namespace duckdb
@@ -34,6 +34,10 @@ public:
 	vector<LogicalType> build_types;
 	//! Duplicate eliminated types; only used for delim_joins (i.e. correlated subqueries)
 	vector<LogicalType> delim_types;
+	//! The minimum amount of build rows for which the hash map is constructed in parallel
+	static constexpr const idx_t PARALLEL_FINALIZE_THRESHOLD = 1000000;
+	//! For every condition, whether or not a runtime filter on its probe keys is pushed into a table scan
+	vector<bool> runtime_filter_conditions;
 
 public:
 	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
@@ -48,7 +52,18 @@ public:
 
 	void FinalizeOperatorState(PhysicalOperatorState &state, ExecutionContext &context) override;
 
+	//! Whether or not the hash table was partitioned because the build side did not fit in memory. The spilled
+	//! partitions are joined after the probe side has been consumed, so the probe cannot be executed in parallel.
+	bool IsExternal();
+	//! Create the runtime filter on the probe keys of the given condition from the keys of the build side: the range
+	//! of the keys and a Bloom filter. Returns nullptr if there is no filter. Only valid once the build has finished.
+	unique_ptr<TableFilter> GetRuntimeFilter(idx_t condition_idx) const;
+
 private:
+	//! Whether or not this is a correlated MARK join that keeps track of the counts per correlated group
+	bool IsCorrelatedMarkJoin() const;
+	//! Push runtime filters into the table scans that produce the probe keys
+	void RegisterRuntimeFilters();
 	void ProbeHashTable(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state_p) const;
 };
 
@@ -0,0 +1,42 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_iejoin.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/operator/join/physical_comparison_join.hpp"
+
+namespace duckdb {
+
+//! PhysicalIEJoin represents an inner join on two inequality conditions (e.g. a band join). Both sides are sorted on
+//! the first condition and split into blocks. Every pair of blocks that can contain matches is joined with the IEJoin
+//! algorithm, which finds the matches of both conditions with a bit array over the order of the first condition.
+class PhysicalIEJoin : public PhysicalComparisonJoin {
+public:
+	PhysicalIEJoin(LogicalOperator &op, unique_ptr<PhysicalOperator> left, unique_ptr<PhysicalOperator> right,
+	               vector<JoinCondition> cond, JoinType join_type, idx_t estimated_cardinality);
+
+	vector<LogicalType> join_key_types;
+
+public:
+	unique_ptr<GlobalOperatorState> GetGlobalState(ClientContext &context) override;
+
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) override;
+	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
+	          DataChunk &input) const override;
+	void Combine(ExecutionContext &context, GlobalOperatorState &gstate, LocalSinkState &lstate) override;
+	bool Finalize(Pipeline &pipeline, ClientContext &context, unique_ptr<GlobalOperatorState> state) override;
+
+	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) const override;
+	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+	void FinalizeOperatorState(PhysicalOperatorState &state, ExecutionContext &context) override;
+
+	//! Whether or not a join with the given type and conditions can be executed as an IEJoin
+	static bool CanJoin(JoinType join_type, const vector<JoinCondition> &conditions);
+};
+
+} // namespace duckdb
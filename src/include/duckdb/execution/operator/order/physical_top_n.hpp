@@ -11,6 +11,7 @@
 #include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/execution/physical_sink.hpp"
 #include "duckdb/planner/bound_query_node.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 
 namespace duckdb {
 
@@ -27,6 +28,9 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The filter on the first order key that is pushed into the scan of the input, tightened whenever the boundary of
+	//! the top-n changes (nullptr if the filter can not be pushed into a scan)
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	void Sink(ExecutionContext &context, GlobalOperatorState &state, LocalSinkState &lstate,
@@ -41,7 +45,13 @@ public:
 
 	string ParamsToString() const override;
 
+	//! Returns the runtime filter that is pushed into the scan of the input
+	unique_ptr<TableFilter> GetRuntimeFilter() const;
+
 private:
+	//! Create the dynamic filter and push it into the scan of the input (if possible)
+	void RegisterRuntimeFilter();
+
 	unique_ptr<idx_t[]> ComputeTopN(ChunkCollection &big_data, idx_t &heap_size);
 };
 
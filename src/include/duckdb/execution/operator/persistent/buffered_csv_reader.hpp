@@ -13,6 +13,7 @@
 #include "duckdb/function/scalar/strftime.hpp"
 #include "duckdb/common/types/chunk_collection.hpp"
 #include "duckdb/common/enums/file_compression_type.hpp"
+#include "duckdb/common/limits.hpp"
 
 #include <map>
 #include <sstream>
@@ -51,6 +52,63 @@ struct TextSearchShiftArray {
 	unique_ptr<uint8_t[]> shifts;
 };
 
+//! The special character search finds the characters that the simple CSV parser has to look at (the delimiter, quote,
+//! escape and newlines) in a buffer. It marks them in a bitmask for 64 bytes at a time (using SSE2 where it is
+//! available), so that the parser can jump to the next special character instead of looking at every byte.
+struct SpecialCharacterSearch {
+	static constexpr idx_t BLOCK_SIZE = 64;
+
+	SpecialCharacterSearch();
+	SpecialCharacterSearch(char delimiter, char quote, char escape);
+
+	//! Returns the position of the first special character in buffer[position, end), or end if there is none
+	inline idx_t Next(const char *buffer, idx_t position, idx_t end) {
+		while (position < end) {
+			if (buffer != block_buffer || position < block_begin || position >= block_begin + block_length) {
+				ComputeBlock(buffer, position, end);
+			}
+			uint64_t mask = block_mask >> (position - block_begin);
+			if (mask != 0) {
+				return position + CountTrailingZeros(mask);
+			}
+			position = block_begin + block_length;
+		}
+		return end;
+	}
+	//! Invalidates the block bitmask, which has to happen whenever the contents of the buffer change
+	void Reset() {
+		block_buffer = nullptr;
+	}
+
+private:
+	//! Computes the bitmask of the (at most) BLOCK_SIZE bytes that start at buffer[position]
+	void ComputeBlock(const char *buffer, idx_t position, idx_t end);
+
+	static inline idx_t CountTrailingZeros(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+		return __builtin_ctzll(value);
+#else
+		idx_t count = 0;
+		while (!(value & 1)) {
+			value >>= 1;
+			count++;
+		}
+		return count;
+#endif
+	}
+
+	//! The special characters
+	char characters[5];
+	//! Whether or not a byte value is a special character
+	bool is_special[256];
+	//! The buffer, offset and length of the block of which the bitmask has been computed
+	const char *block_buffer;
+	idx_t block_begin;
+	idx_t block_length;
+	//! The bitmask of the special characters in the block
+	uint64_t block_mask;
+};
+
 struct BufferedCSVReaderOptions {
 	//! The file path of the CSV file to read
 	string file_path;
@@ -91,6 +149,8 @@ struct BufferedCSVReaderOptions {
 	idx_t sample_chunks = 10;
 	//! Number of samples to buffer
 	idx_t buffer_size = STANDARD_VECTOR_SIZE * 100;
+	//! Size of the byte ranges into which a file is split when it is read in parallel
+	idx_t range_size = 8 * 1024 * 1024;
 	//! Consider all columns to be of type varchar
 	bool all_varchar = false;
 	//! The date format to use (if any is specified)
@@ -135,6 +195,12 @@ class BufferedCSVReader {
 public:
 	BufferedCSVReader(ClientContext &context, BufferedCSVReaderOptions options,
 	                  const vector<LogicalType> &requested_types = vector<LogicalType>());
+	//! Creates a reader for the records that start in the byte range [range_begin, range_end) of the file. The first
+	//! record is searched for, unless range_begin is known to be the start of a record. Files that do not support
+	//! seeking are read as a whole.
+	BufferedCSVReader(ClientContext &context, BufferedCSVReaderOptions options,
+	                  const vector<LogicalType> &requested_types, idx_t range_begin, idx_t range_end,
+	                  bool range_begin_is_record_start = false);
 
 	FileSystem &fs;
 	BufferedCSVReaderOptions options;
@@ -149,6 +215,13 @@ public:
 	idx_t buffer_size;
 	idx_t position;
 	idx_t start = 0;
+	//! The offset of the buffer in the file (only maintained for plain files)
+	idx_t buffer_offset = 0;
+
+	//! The position in the file of the first record of the byte range that is read
+	idx_t range_start = 0;
+	//! Records that start at or after this position in the file are left to the next byte range
+	idx_t range_end = NumericLimits<idx_t>::Maximum();
 
 	idx_t linenr = 0;
 	bool linenr_estimated = false;
@@ -166,6 +239,7 @@ public:
 	vector<unique_ptr<char[]>> cached_buffers;
 
 	TextSearchShiftArray delimiter_search, escape_search, quote_search;
+	SpecialCharacterSearch special_search;
 
 	DataChunk parse_chunk;
 
@@ -174,14 +248,19 @@ public:
 public:
 	//! Extract a single DataChunk from the CSV file and stores it in insert_chunk
 	void ParseCSV(DataChunk &insert_chunk);
+	//! The position in the file up to which the records have been read
+	idx_t FilePosition() const {
+		return buffer_offset + position;
+	}
 
 private:
 	//! Initialize Parser
 	void Initialize(const vector<LogicalType> &requested_types);
 	//! Initializes the parse_chunk with varchar columns and aligns info with new number of cols
 	void InitParseChunk(idx_t num_cols);
-	//! Initializes the TextSearchShiftArrays for complex parser
-	void PrepareComplexParser();
+	//! Initializes the TextSearchShiftArrays for the complex parser and the SpecialCharacterSearch for the simple
+	//! parser
+	void PrepareParser();
 	//! Extract a single DataChunk from the CSV file and stores it in insert_chunk
 	void ParseCSV(ParserMode mode, DataChunk &insert_chunk = DUMMY_CHUNK);
 	//! Sniffs CSV dialect and determines skip rows, header row, column types and column names
@@ -204,6 +283,18 @@ private:
 	void ResetStream();
 	//! Prepare candidate sets for auto detection based on user input
 	void PrepareCandidateSets();
+	//! Resets the buffer and moves the stream to the given position in the file
+	void SeekToPosition(idx_t file_position);
+	//! Moves to the first record that starts at or after range_begin; the search stops at range_limit
+	void SkipToRecordStart(idx_t range_begin, idx_t range_limit);
+	//! Starts reading the records at the given position in the file
+	void StartAtRecord(idx_t record_start);
+	//! Whether or not a record starts at the given position, determined by parsing the rows that follow speculatively
+	bool IsRecordStart(idx_t file_position);
+	//! Whether or not the reader has reached the records of the next byte range
+	bool ReachedRangeEnd() const {
+		return FilePosition() >= range_end;
+	}
 
 	//! Parses a CSV file with a one-byte delimiter, escape and quote character
 	void ParseSimpleCSV(DataChunk &insert_chunk);
@@ -15,6 +15,17 @@
 
 namespace duckdb {
 
+//! A runtime filter that an operator creates while the query runs and pushes into the scan of its input: a hash join
+//! creates it from its build side, a top-n from its current boundary
+struct RuntimeFilterSource {
+	//! The operator that creates the filter
+	PhysicalOperator *op;
+	//! The filter of the operator (the condition of a hash join the filter is created for)
+	idx_t filter_idx;
+	//! The (projected) column of the scan the filter applies to
+	idx_t column_index;
+};
+
 //! Represents a scan of a base table
 class PhysicalTableScan : public PhysicalOperator {
 public:
@@ -32,6 +43,8 @@ public:
 	vector<string> names;
 	//! The table filters
 	unique_ptr<TableFilterSet> table_filters;
+	//! The runtime filters that are pushed into the scan by hash joins and top-n operators on the scanned rows
+	vector<RuntimeFilterSource> runtime_filters;
 
 public:
 	string GetName() const override;
@@ -39,6 +52,21 @@ public:
 
 	void GetChunkInternal(ExecutionContext &context, DataChunk &chunk, PhysicalOperatorState *state) const override;
 	unique_ptr<PhysicalOperatorState> GetOperatorState() override;
+
+	//! Whether or not runtime filters can be pushed into the scan on the given column
+	bool SupportsRuntimeFilters(idx_t column_index) const;
+	//! Add a runtime filter to the scan (if it was not added before)
+	void AddRuntimeFilter(PhysicalOperator *op, idx_t filter_idx, idx_t column_index);
+
+	//! Find the table scan that produces the given column of the operator in the same pipeline, returns nullptr if the
+	//! column is not a column of a table scan (that supports runtime filters). Every row of the operator that does not
+	//! pass a filter on the column has to come from a scanned row that does not pass it either.
+	static PhysicalTableScan *FindRuntimeFilterScan(PhysicalOperator *op, idx_t &column_index);
+
+private:
+	//! Create the set of table filters together with the runtime filters of the operators, returns nullptr if the
+	//! operators have not created any filters. Hash joins have to be finalized before the scan starts.
+	unique_ptr<TableFilterSet> CreateRuntimeFilterSet() const;
 };
 
 } // namespace duckdb
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/types/buffered_chunk_collection.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
 
 namespace duckdb {
@@ -35,6 +36,15 @@ public:
 	HashTableList GetPartition(idx_t partition);
 	HashTableList GetUnpartitioned();
 
+	//! The amount of memory used by the in-memory HTs (in bytes)
+	idx_t SizeInBytes();
+	//! Move the groups and aggregate states of all partitions to spillable storage, releasing the in-memory HTs
+	void SpillPartitions();
+	//! Whether or not SpillPartitions has been called
+	bool IsSpilled();
+	//! Returns the spilled groups and states of the partition (if any)
+	unique_ptr<BufferedChunkCollection> GetSpilledPartition(idx_t partition);
+
 	void Finalize();
 
 private:
@@ -52,6 +62,8 @@ private:
 
 	HashTableList unpartitioned_hts;
 	unordered_map<hash_t, HashTableList> radix_partitioned_hts;
+	//! The partitions that were spilled, these are combined into the final HTs one partition at a time
+	vector<unique_ptr<BufferedChunkCollection>> spilled_partitions;
 
 private:
 	idx_t ListAddChunk(HashTableList &list, DataChunk &groups, Vector &group_hashes, DataChunk &payload);
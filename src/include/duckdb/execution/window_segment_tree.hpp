@@ -26,6 +26,7 @@ public:
 
 private:
 	void ConstructTree();
+	void MaterializeInputs();
 	void ExtractFrame(idx_t begin, idx_t end);
 	void WindowSegmentValue(idx_t l_idx, idx_t begin, idx_t end);
 	void AggregateInit();
@@ -46,6 +47,8 @@ private:
 	Vector statep;
 	//! The frame boundaries, used for the window functions
 	FrameBounds frame;
+	//! The full input materialized into one vector per column, used for the window functions
+	vector<Vector> window_inputs;
 	//! Reused result value container for the window functions (20% of runtime)
 	Vector result;
 
@@ -59,6 +62,8 @@ private:
 
 	//! The (sorted) input chunk collection on which the tree is built
 	ChunkCollection *input_ref;
+	//! Whether the frames are computed with the window method of the aggregate (instead of the segment tree)
+	bool use_window_callback;
 
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 64;
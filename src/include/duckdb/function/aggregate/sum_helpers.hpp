@@ -20,6 +20,11 @@ struct RegularAdd {
 		state.value += input;
 	}
 
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= input;
+	}
+
 	template <class STATE, class T>
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		state.value += input * count;
@@ -50,6 +55,11 @@ struct HugeintAdd {
 		AddValue(state.value, uint64_t(input), input >= 0);
 	}
 
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= hugeint_t(input);
+	}
+
 	template <class STATE, class T>
 	static void AddConstant(STATE &state, T input, idx_t count) {
 		// add a constant X number of times
@@ -105,6 +115,12 @@ struct BaseSumOperation {
 		ADDOP::template AddConstant<STATE, INPUT_TYPE>(*state, *input, count);
 	}
 
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Inverse(STATE *state, FunctionData *bind_data, INPUT_TYPE *input, ValidityMask &mask, idx_t idx) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		ADDOP::template SubtractNumber<STATE, INPUT_TYPE>(*state, input[idx]);
+	}
+
 	static bool IgnoreNull() {
 		return true;
 	}
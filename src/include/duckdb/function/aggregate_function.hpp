@@ -45,9 +45,10 @@ typedef void (*aggregate_simple_update_t)(Vector inputs[], FunctionData *bind_da
                                           idx_t count);
 
 //! The type used for updating complex windowed aggregate functions (optional)
+//! The inputs hold all count rows the window is computed over, the frame bounds index into them directly
 typedef std::pair<idx_t, idx_t> FrameBounds;
 typedef void (*aggregate_window_t)(Vector inputs[], FunctionData *bind_data, idx_t input_count, data_ptr_t state,
-                                   const FrameBounds &frame, const FrameBounds &prev, Vector &result);
+                                   const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t count);
 
 class AggregateFunction : public BaseScalarFunction {
 public:
@@ -183,10 +184,18 @@ public:
 
 	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
 	static void UnaryWindow(Vector inputs[], FunctionData *bind_data, idx_t input_count, data_ptr_t state,
-	                        const FrameBounds &frame, const FrameBounds &prev, Vector &result) {
+	                        const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t count) {
 		D_ASSERT(input_count == 1);
 		AggregateExecutor::UnaryWindow<STATE, INPUT_TYPE, RESULT_TYPE, OP>(inputs[0], bind_data, state, frame, prev,
-		                                                                   result);
+		                                                                   result, count);
+	}
+
+	template <class STATE, class INPUT_TYPE, class RESULT_TYPE, class OP>
+	static void UnaryInvertibleWindow(Vector inputs[], FunctionData *bind_data, idx_t input_count, data_ptr_t state,
+	                                  const FrameBounds &frame, const FrameBounds &prev, Vector &result, idx_t count) {
+		D_ASSERT(input_count == 1);
+		AggregateExecutor::UnaryInvertibleWindow<STATE, INPUT_TYPE, RESULT_TYPE, OP>(inputs[0], bind_data, state,
+		                                                                             frame, prev, result);
 	}
 
 	template <class STATE, class A_TYPE, class B_TYPE, class OP>
@@ -43,7 +43,8 @@ class CopyFunction : public Function {
 public:
 	explicit CopyFunction(string name)
 	    : Function(name), copy_to_bind(nullptr), copy_to_initialize_local(nullptr), copy_to_initialize_global(nullptr),
-	      copy_to_sink(nullptr), copy_to_combine(nullptr), copy_to_finalize(nullptr), copy_from_bind(nullptr) {
+	      copy_to_sink(nullptr), copy_to_combine(nullptr), copy_to_finalize(nullptr), copy_to_parallel(false),
+	      copy_from_bind(nullptr) {
 	}
 
 	copy_to_bind_t copy_to_bind;
@@ -52,6 +53,9 @@ public:
 	copy_to_sink_t copy_to_sink;
 	copy_to_combine_t copy_to_combine;
 	copy_to_finalize_t copy_to_finalize;
+	//! Whether or not copy_to_sink and copy_to_combine can be called from multiple threads at the same time (this
+	//! does not preserve the order of the rows)
+	bool copy_to_parallel;
 
 	copy_from_bind_t copy_from_bind;
 	TableFunction copy_from_function;
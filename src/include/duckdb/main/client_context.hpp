@@ -12,6 +12,7 @@
 #include "duckdb/catalog/catalog_set.hpp"
 #include "duckdb/common/deque.hpp"
 #include "duckdb/common/enums/output_type.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/pair.hpp"
 #include "duckdb/common/progress_bar.hpp"
 #include "duckdb/common/unordered_set.hpp"
@@ -35,6 +36,8 @@ class BufferedFileWriter;
 class QueryProfiler;
 class QueryProfilerHistory;
 class ClientContextLock;
+class MemoryTracker;
+struct SchedulingGroup;
 struct CreateScalarFunctionInfo;
 class ScalarFunctionCatalogEntry;
 
@@ -61,6 +64,14 @@ public:
 
 	//! The query executor
 	Executor executor;
+	//! The buffer manager memory used by this client
+	shared_ptr<MemoryTracker> memory_tracker;
+	//! The buffer manager memory used by the queries of this client, the statistics are reset when a query starts
+	shared_ptr<MemoryTracker> query_memory_tracker;
+	//! The scheduling group of the queries of this client, which determines their share of the background threads
+	shared_ptr<SchedulingGroup> scheduling_group;
+	//! The priority of the queries of this client (default: the query_priority of the database)
+	QueryPriority query_priority;
 
 	//! The Progress Bar
 	unique_ptr<ProgressBar> progress_bar;
@@ -147,6 +158,10 @@ public:
 	//! Register function in the temporary schema
 	DUCKDB_API void RegisterFunction(CreateFunctionInfo *info);
 
+	//! Fetch the value of a setting, the settings of this connection take precedence over the SET variables of the
+	//! database. Returns false if the setting does not exist.
+	DUCKDB_API bool TryGetCurrentSetting(const string &key, Value &result);
+
 	//! Parse statements from a query
 	DUCKDB_API vector<unique_ptr<SQLStatement>> ParseStatements(const string &query);
 	//! Extract the logical plan of a query
@@ -11,6 +11,7 @@
 #include "duckdb/common/allocator.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/order_type.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/common/types/value.hpp"
@@ -23,6 +24,11 @@ class TableFunctionRef;
 
 enum class AccessMode : uint8_t { UNDEFINED = 0, AUTOMATIC = 1, READ_ONLY = 2, READ_WRITE = 3 };
 enum class CheckpointAbort : uint8_t { NO_ABORT = 0, DEBUG_ABORT_BEFORE_TRUNCATE = 1, DEBUG_ABORT_BEFORE_HEADER = 2 };
+//! The replacement policy used to select blocks to evict from the buffer pool
+//! LRU: evict the least recently unpinned block
+//! TWO_QUEUE: evict blocks that were only pinned once since being loaded (e.g. by a single large scan) before blocks
+//! that are pinned repeatedly (e.g. by many queries), and use LRU within both groups
+enum class EvictionPolicy : uint8_t { LRU = 0, TWO_QUEUE = 1 };
 
 enum class ConfigurationOptionType : uint32_t {
 	INVALID = 0,
@@ -32,7 +38,12 @@ enum class ConfigurationOptionType : uint32_t {
 	ENABLE_EXTERNAL_ACCESS,
 	ENABLE_OBJECT_CACHE,
 	MAXIMUM_MEMORY,
-	THREADS
+	THREADS,
+	EVICTION_POLICY,
+	CONNECTION_MEMORY_LIMIT,
+	QUERY_MEMORY_LIMIT,
+	NUMA_MODE,
+	QUERY_PRIORITY
 };
 
 struct ConfigurationOption {
@@ -58,13 +69,26 @@ public:
 	idx_t checkpoint_wal_size = 1 << 24;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
+	//! The amount of I/O threads used to read blocks ahead of table scans (0 disables prefetching)
+	idx_t prefetch_threads = 4;
+	//! The replacement policy of the buffer pool
+	EvictionPolicy eviction_policy = EvictionPolicy::LRU;
 	//! The FileSystem to use, can be overwritten to allow for injecting custom file systems for testing purposes (e.g.
 	//! RamFS or something similar)
 	unique_ptr<FileSystem> file_system;
 	//! The maximum memory used by the database system (in bytes). Default: 80% of System available memory
 	idx_t maximum_memory = (idx_t)-1;
+	//! The default maximum memory used by a single connection (in bytes). Default: no limit
+	idx_t connection_memory_limit = (idx_t)-1;
+	//! The default maximum memory used by a single query (in bytes). Default: no limit
+	idx_t query_memory_limit = (idx_t)-1;
 	//! The maximum amount of CPU threads used by the database system. Default: all available.
 	idx_t maximum_threads = (idx_t)-1;
+	//! Whether or not to pin the threads to the CPUs of the NUMA nodes and to allocate buffers on the node of the thread
+	//! that allocates them
+	bool numa_mode = false;
+	//! The default scheduling priority of the queries of a new connection
+	QueryPriority query_priority = QueryPriority::NORMAL;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
@@ -101,6 +125,10 @@ public:
 	DUCKDB_API void SetOption(const ConfigurationOption &option, const Value &value);
 
 	DUCKDB_API static idx_t ParseMemoryLimit(const string &arg);
+	DUCKDB_API static EvictionPolicy ParseEvictionPolicy(const string &arg);
+	DUCKDB_API static string EvictionPolicyToString(EvictionPolicy policy);
+	DUCKDB_API static QueryPriority ParseQueryPriority(const string &arg);
+	DUCKDB_API static string QueryPriorityToString(QueryPriority priority);
 };
 
 } // namespace duckdb
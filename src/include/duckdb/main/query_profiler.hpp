@@ -25,6 +25,7 @@ namespace duckdb {
 class ExpressionExecutor;
 class PhysicalOperator;
 class SQLStatement;
+class MemoryTracker;
 
 //! The ExpressionInfo keeps information related to an expression
 struct ExpressionInfo {
@@ -166,7 +167,7 @@ public:
 		return detailed_enabled;
 	}
 
-	DUCKDB_API void StartQuery(string query);
+	DUCKDB_API void StartQuery(string query, shared_ptr<MemoryTracker> memory_tracker = nullptr);
 	DUCKDB_API void EndQuery();
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
@@ -210,6 +211,14 @@ private:
 	string query;
 	//! The timer used to time the execution time of the entire query
 	Profiler<system_clock> main_query;
+	//! The memory tracker of the query (if any)
+	shared_ptr<MemoryTracker> memory_tracker;
+	//! The peak buffer manager memory used by the query (in bytes)
+	idx_t peak_memory_usage = 0;
+	//! The amount of data the query spilled to the temporary directory (in bytes)
+	idx_t bytes_spilled = 0;
+	//! The amount of data the query read back from the temporary directory (in bytes)
+	idx_t bytes_read = 0;
 	//! A map of a Physical Operator pointer to a tree node
 	TreeMap tree_map;
 
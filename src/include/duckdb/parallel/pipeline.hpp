@@ -19,6 +19,12 @@ namespace duckdb {
 class Executor;
 class TaskContext;
 
+//! The state of a task of a pipeline, which is kept when the task yields to the tasks of other queries
+struct PipelineTaskState {
+	unique_ptr<PhysicalOperatorState> state;
+	unique_ptr<LocalSinkState> lstate;
+};
+
 //! The Pipeline class represents an execution pipeline
 class Pipeline : public std::enable_shared_from_this<Pipeline> {
 	friend class Executor;
@@ -30,8 +36,8 @@ public:
 	ProducerToken &token;
 
 public:
-	//! Execute a task within the pipeline on a single thread
-	void Execute(TaskContext &task);
+	//! Execute a task within the pipeline on a single thread, returns false if the task yielded before it was finished
+	bool Execute(TaskContext &task, PipelineTaskState &task_state);
 
 	void AddDependency(shared_ptr<Pipeline> &pipeline);
 	void CompleteDependency();
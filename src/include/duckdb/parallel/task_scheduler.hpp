@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/query_priority.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/parallel/task.hpp"
@@ -16,36 +17,68 @@
 
 namespace duckdb {
 
-struct ConcurrentQueue;
-struct QueueProducerToken;
+struct ScheduledTask;
+struct TaskQueue;
+struct TaskSignal;
 class ClientContext;
 class TaskScheduler;
 
 struct SchedulerThread;
 
+//! A SchedulingGroup is the unit of fair sharing of the task scheduler (e.g. all queries of a connection). Groups that
+//! have tasks waiting get a share of the started tasks that is proportional to their weight.
+struct SchedulingGroup {
+	explicit SchedulingGroup(QueryPriority priority = QueryPriority::NORMAL);
+
+	//! Sets the weight of the group based on the given priority
+	void SetPriority(QueryPriority priority);
+
+	//! The weight of the group
+	atomic<idx_t> weight;
+	//! The virtual time at which the next task of the group is started: the amount of scheduled tasks of the group
+	//! divided by its weight
+	atomic<idx_t> pass;
+	//! The amount of tasks of this group that are waiting to be executed
+	atomic<idx_t> pending_tasks;
+};
+
+//! A ProducerToken identifies the tasks scheduled by a single producer (e.g. the executor of a query). The token must
+//! remain valid until all tasks scheduled with it have been executed.
 struct ProducerToken {
-	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
+	ProducerToken(TaskScheduler &scheduler, shared_ptr<SchedulingGroup> group);
 	~ProducerToken();
 
 	TaskScheduler &scheduler;
-	unique_ptr<QueueProducerToken> token;
-	mutex producer_lock;
+	//! The scheduling group the producer belongs to
+	shared_ptr<SchedulingGroup> group;
+	//! The amount of tasks of this producer that are waiting to be executed
+	atomic<idx_t> pending_tasks;
 };
 
-//! The TaskScheduler is responsible for managing tasks and threads
+//! The TaskScheduler is responsible for managing tasks and threads. Every background thread has its own task queue:
+//! tasks scheduled by a background thread are pushed to the local queue of the thread and popped back in LIFO order,
+//! tasks scheduled by other threads are pushed to a global queue. Idle threads take tasks from the global queue or
+//! steal the oldest task from the queue of a randomly selected thread, and sleep until a new task is scheduled if there
+//! are no tasks at all. In NUMA mode the background threads are pinned to the CPUs of the NUMA nodes, and threads steal
+//! from threads on their own node before stealing from threads on other nodes.
+//! Tasks of different scheduling groups are interleaved using weighted fair sharing (stride scheduling): every task is
+//! assigned a virtual time when it is scheduled, the producers in a queue are ordered by the virtual time of their next
+//! task (the LIFO order only applies within a producer), and long-running tasks yield after a time slice when tasks of
+//! other groups are waiting.
 class TaskScheduler {
-	// timeout for semaphore wait, default 50ms
-	constexpr static int64_t TASK_TIMEOUT_USECS = 50000;
-
 public:
 	TaskScheduler();
 	~TaskScheduler();
 
 	static TaskScheduler &GetScheduler(ClientContext &context);
 
-	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer that belongs to the given scheduling group, or to a new group with normal priority
+	unique_ptr<ProducerToken> CreateProducer(shared_ptr<SchedulingGroup> group = nullptr);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, unique_ptr<Task> task);
+	//! Returns true if the background thread running a task of the given producer should reschedule the rest of its
+	//! work, because the task has used up its time slice while tasks of other groups are waiting
+	bool ShouldYield(ProducerToken &producer);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
@@ -56,16 +89,46 @@ public:
 	void SetThreads(int32_t n);
 	//! Returns the number of threads
 	int32_t NumberOfThreads();
+	//! Enables or disables pinning the background threads to the CPUs of the NUMA nodes
+	void SetNumaMode(bool numa_mode);
+	//! The amount of tasks that were stolen from the local queue of another background thread
+	idx_t GetStolenTaskCount() {
+		return stolen_tasks;
+	}
 
 private:
 	void SetThreadsInternal(int32_t n);
+	//! Pins the background thread with the given index to a CPU (NUMA mode) or allows it to run anywhere
+	void PlaceThread(SchedulerThread &scheduler_thread, idx_t thread_idx);
+
+	//! Fetches a task for a background thread: the next task of either its local queue or the global queue, or a task
+	//! from the queue of another thread if both are empty
+	bool GetTask(SchedulerThread *current_thread, unique_ptr<Task> &task);
+	//! Takes the task out of a scheduled task that is about to be executed and charges it to its producer
+	void StartTask(ScheduledTask &entry, unique_ptr<Task> &task);
+	//! Wakes up a sleeping background thread (if any)
+	void SignalTask();
 
-	//! The task queue
-	unique_ptr<ConcurrentQueue> queue;
+	//! The queue of tasks scheduled from outside of the background threads
+	unique_ptr<TaskQueue> global_queue;
+	//! The total amount of tasks that are waiting to be executed
+	atomic<idx_t> pending_tasks;
+	//! The virtual time of the scheduler (the latest virtual time of a started task), idle groups start from this time
+	atomic<idx_t> virtual_time;
+	//! The amount of tasks that were stolen from the local queue of another background thread
+	atomic<idx_t> stolen_tasks;
+	//! The amount of background threads that are sleeping (or about to sleep)
+	atomic<idx_t> sleeping_threads;
+	//! The signal used to wake up sleeping background threads
+	unique_ptr<TaskSignal> signal;
+	//! The lock protecting the set of background threads (it is held while stealing tasks from their queues)
+	mutex thread_lock;
 	//! The active background threads of the task scheduler
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! Whether or not the background threads are pinned to the NUMA nodes
+	bool numa_mode;
 };
 
 } // namespace duckdb
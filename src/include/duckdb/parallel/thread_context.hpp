@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/storage/buffer/memory_tracker.hpp"
 
 namespace duckdb {
 class ClientContext;
@@ -20,6 +21,8 @@ public:
 
 	//! The operator profiler for the individual thread context
 	OperatorProfiler profiler;
+	//! Accounts the buffers allocated by the thread to the memory tracker of the current query
+	MemoryTrackerScope memory_scope;
 };
 
 } // namespace duckdb
@@ -18,7 +18,7 @@ namespace duckdb {
 //! Represents a JOIN between two expressions
 class JoinRef : public TableRef {
 public:
-	JoinRef() : TableRef(TableReferenceType::JOIN), is_natural(false) {
+	JoinRef() : TableRef(TableReferenceType::JOIN), is_natural(false), is_asof(false) {
 	}
 
 	//! The left hand side of the join
@@ -31,6 +31,8 @@ public:
 	JoinType type;
 	//! Natural join
 	bool is_natural;
+	//! AsOf join: every row of the LHS is joined with the closest row of the RHS on the inequality condition
+	bool is_asof;
 	//! The set of USING columns (if any)
 	vector<string> using_columns;
 
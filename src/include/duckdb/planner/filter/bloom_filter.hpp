@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! The bits of a blocked Bloom filter over a set of hashes. Every hash sets BITS_PER_HASH bits within a single 64-bit
+//! word, so a lookup only touches one word.
+class BloomFilterData {
+public:
+	//! Create an empty Bloom filter sized for the given amount of hashes
+	explicit BloomFilterData(idx_t count);
+
+	static constexpr const idx_t BITS_PER_HASH = 4;
+
+	//! Insert the hashes into the filter. If parallel is set, other threads can insert into the filter at the same time.
+	void Insert(hash_t hashes[], idx_t count, bool parallel);
+	//! Returns false if the hash was definitely not inserted into the filter
+	bool Lookup(hash_t hash) const {
+		auto pattern = GetPattern(hash);
+		return (words[GetWord(hash)] & pattern) == pattern;
+	}
+
+	//! The size of the filter in bytes
+	idx_t SizeInBytes() const {
+		return (word_mask + 1) * sizeof(uint64_t);
+	}
+
+private:
+	//! The upper bits of the hash select the word (the lower bits select the bucket in the hash table)
+	idx_t GetWord(hash_t hash) const {
+		return (hash >> 32) & word_mask;
+	}
+	static uint64_t GetPattern(hash_t hash) {
+		uint64_t pattern = 0;
+		for (idx_t i = 0; i < BITS_PER_HASH; i++) {
+			pattern |= uint64_t(1) << ((hash >> (i * 6)) & 63);
+		}
+		return pattern;
+	}
+
+	unique_ptr<uint64_t[]> words;
+	idx_t word_mask;
+};
+
+//! A BloomFilter only lets through the rows of which the hash is in the Bloom filter of the build side of a join.
+//! NULL values never pass the filter.
+class BloomFilter : public TableFilter {
+public:
+	explicit BloomFilter(shared_ptr<BloomFilterData> data);
+
+	//! The Bloom filter, shared between all copies of the filter
+	shared_ptr<BloomFilterData> data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() override;
+
+	//! Remove the rows that do not pass the filter from the selection vector
+	void Select(Vector &vector, SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) const;
+};
+
+} // namespace duckdb
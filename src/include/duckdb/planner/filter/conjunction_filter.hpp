@@ -23,6 +23,7 @@ public:
 public:
 	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
 	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() override;
 };
 
 class ConjunctionAndFilter : public TableFilter {
@@ -35,6 +36,7 @@ public:
 public:
 	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
 	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() override;
 };
 
 } // namespace duckdb
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/enums/expression_type.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/validity_mask.hpp"
+#include "duckdb/common/types/value.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! The constant of a DynamicFilter, which the operator that created the filter keeps tightening while the scan runs
+class DynamicFilterData {
+public:
+	DynamicFilterData(ExpressionType comparison_type, bool null_passes);
+
+	//! The comparison of the values with the constant (e.g. <=C)
+	const ExpressionType comparison_type;
+	//! Whether or not NULL values pass the filter
+	const bool null_passes;
+
+public:
+	//! Replace the constant of the filter
+	void SetConstant(Value constant);
+	//! Returns the current constant, or a NULL value if none has been set yet
+	Value GetConstant();
+
+private:
+	mutex lock;
+	Value constant;
+};
+
+//! A DynamicFilter compares the values with a constant that can change while the scan is running (e.g. the boundary of
+//! a top-n). All rows pass the filter until the constant is set.
+class DynamicFilter : public TableFilter {
+public:
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> data);
+
+	//! The constant of the filter, shared between all copies of the filter
+	shared_ptr<DynamicFilterData> data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	unique_ptr<TableFilter> Copy() override;
+
+	//! Remove the rows that do not pass the filter from the selection vector
+	void Select(Vector &vector, SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) const;
+};
+
+} // namespace duckdb
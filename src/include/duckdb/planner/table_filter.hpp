@@ -21,7 +21,9 @@ enum class TableFilterType : uint8_t {
 	IS_NULL = 1,
 	IS_NOT_NULL = 2,
 	CONJUNCTION_OR = 3,
-	CONJUNCTION_AND = 4
+	CONJUNCTION_AND = 4,
+	BLOOM_FILTER = 5,  // membership in the build side of a hash join (runtime filter)
+	DYNAMIC_FILTER = 6 // constant comparison with a constant that changes during the scan (runtime filter)
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -38,6 +40,7 @@ public:
 	//! Returns true if the statistics indicate that the segment can contain values that satisfy that filter
 	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) = 0;
 	virtual string ToString(const string &column_name) = 0;
+	virtual unique_ptr<TableFilter> Copy() = 0;
 };
 
 class TableFilterSet {
@@ -46,6 +49,7 @@ public:
 
 public:
 	void PushFilter(idx_t table_index, unique_ptr<TableFilter> filter);
+	unique_ptr<TableFilterSet> Copy();
 };
 
 } // namespace duckdb
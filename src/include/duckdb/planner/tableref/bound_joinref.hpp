@@ -18,7 +18,7 @@ namespace duckdb {
 //! Represents a join
 class BoundJoinRef : public BoundTableRef {
 public:
-	BoundJoinRef() : BoundTableRef(TableReferenceType::JOIN) {
+	BoundJoinRef() : BoundTableRef(TableReferenceType::JOIN), is_asof(false) {
 	}
 
 	//! The binder used to bind the LHS of the join
@@ -33,5 +33,7 @@ public:
 	unique_ptr<Expression> condition;
 	//! The join type
 	JoinType type;
+	//! Whether or not this is an AsOf join
+	bool is_asof;
 };
 } // namespace duckdb
@@ -35,6 +35,10 @@ public:
 	//! assumed to be rewritten)
 	virtual void MarkBlockAsModified(block_id_t block_id) {
 	}
+	//! Increase the reference count of a block that is shared by multiple (compressed) segments. Shared blocks are only
+	//! added to the free list once every segment that references the block has been marked as modified.
+	virtual void IncreaseBlockReferenceCount(block_id_t block_id) {
+	}
 	//! Get the first meta block id
 	virtual block_id_t GetMetaBlock() = 0;
 	//! Read the content of the block from disk
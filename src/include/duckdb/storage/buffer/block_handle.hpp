@@ -18,6 +18,7 @@ class BufferHandle;
 class BufferManager;
 class DatabaseInstance;
 class FileBuffer;
+class MemoryTracker;
 
 enum class BlockState : uint8_t { BLOCK_UNLOADED = 0, BLOCK_LOADED = 1 };
 
@@ -60,10 +61,15 @@ private:
 	unique_ptr<FileBuffer> buffer;
 	//! Internal eviction timestamp
 	atomic<idx_t> eviction_timestamp;
+	//! The amount of times the block was pinned since it was loaded (concurrent pins only count once)
+	idx_t references;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	const bool can_destroy;
 	//! The memory usage of the block
 	idx_t memory_usage;
+	//! The memory tracker that the memory of the block is accounted to. Temporary blocks are accounted to the tracker
+	//! that was active when they were registered, blocks of the base file to the tracker that loaded them.
+	shared_ptr<MemoryTracker> tracker;
 };
 
 } // namespace duckdb
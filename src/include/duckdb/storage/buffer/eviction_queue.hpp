@@ -0,0 +1,46 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/eviction_queue.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/parallel/concurrentqueue.hpp"
+#include "duckdb/storage/buffer/block_handle.hpp"
+
+namespace duckdb {
+
+struct BufferEvictionNode {
+	BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t timestamp_p)
+	    : handle(move(handle_p)), timestamp(timestamp_p) {
+		D_ASSERT(!handle.expired());
+	}
+
+	weak_ptr<BlockHandle> handle;
+	idx_t timestamp;
+
+	bool CanUnload(BlockHandle &handle) {
+		if (timestamp != handle.eviction_timestamp) {
+			// handle was used in between
+			return false;
+		}
+		return handle.CanUnload();
+	}
+};
+
+typedef duckdb_moodycamel::ConcurrentQueue<unique_ptr<BufferEvictionNode>> eviction_queue_t;
+
+struct EvictionQueue {
+	//! The queue of unpinned blocks, in LRU order
+	eviction_queue_t q;
+	//! With the 2Q policy: the queue of unpinned blocks that have been pinned more than once since being loaded. These
+	//! blocks are only evicted if there are no other blocks left to evict.
+	eviction_queue_t frequent_q;
+};
+
+} // namespace duckdb
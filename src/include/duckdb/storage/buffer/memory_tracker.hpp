@@ -0,0 +1,103 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/buffer/memory_tracker.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/atomic.hpp"
+
+namespace duckdb {
+struct EvictionQueue;
+
+//! The MemoryTracker keeps track of the buffer manager memory that is used by a query, a client context or the
+//! database as a whole, together with the amount of data that was spilled to (and read back from) the temporary
+//! directory. Trackers form a hierarchy: everything accounted to a tracker is also accounted to its parent.
+class MemoryTracker : public std::enable_shared_from_this<MemoryTracker> {
+public:
+	explicit MemoryTracker(shared_ptr<MemoryTracker> parent = nullptr);
+	~MemoryTracker();
+
+	//! Account for a buffer of the given size that was loaded into memory
+	void Allocate(idx_t size);
+	//! Account for a buffer of the given size that was released from memory
+	void Free(idx_t size);
+	//! Account for a buffer of the given size that was written to the temporary directory
+	void AddBytesSpilled(idx_t size);
+	//! Account for a buffer of the given size that was read back from the temporary directory
+	void AddBytesRead(idx_t size);
+	//! Reset the peak memory usage to the current memory usage and the spill statistics to zero
+	void ResetStatistics();
+
+	//! Set the maximum amount of memory that can be accounted to this tracker (INVALID_INDEX = unlimited). The buffer
+	//! manager evicts blocks accounted to this tracker (spilling them to the temporary directory) to stay within the
+	//! limit.
+	void SetLimit(idx_t limit);
+	idx_t GetLimit() const {
+		return limit;
+	}
+	//! Returns the tracker (this tracker or one of its ancestors) whose limit is exceeded when the given amount of
+	//! memory is allocated, or nullptr if no limit is exceeded
+	MemoryTracker *GetExceededTracker(idx_t extra_memory);
+	//! Whether or not the memory of this tracker is accounted to the given tracker
+	bool IsAccountedTo(const MemoryTracker &tracker) const;
+
+	idx_t GetMemoryUsage() const {
+		return memory_usage;
+	}
+	idx_t GetPeakMemoryUsage() const {
+		return peak_memory_usage;
+	}
+	idx_t GetBytesSpilled() const {
+		return bytes_spilled;
+	}
+	idx_t GetBytesRead() const {
+		return bytes_read;
+	}
+
+	MemoryTracker *GetParent() const {
+		return parent.get();
+	}
+	//! The unpinned blocks that are accounted to this tracker while it has a limit, in the order they were unpinned
+	EvictionQueue &GetEvictionQueue() {
+		return *eviction_queue;
+	}
+
+	//! Returns the memory tracker that buffers allocated by the current thread are accounted to (if any)
+	static MemoryTracker *GetActiveTracker();
+
+private:
+	//! The parent tracker (if any)
+	shared_ptr<MemoryTracker> parent;
+	//! The maximum amount of memory that can be accounted to this tracker (in bytes)
+	atomic<idx_t> limit;
+	//! The amount of memory that is currently in use (in bytes)
+	atomic<idx_t> memory_usage;
+	//! The highest amount of memory that was in use at any point (in bytes)
+	atomic<idx_t> peak_memory_usage;
+	//! The amount of data written to the temporary directory (in bytes)
+	atomic<idx_t> bytes_spilled;
+	//! The amount of data read back from the temporary directory (in bytes)
+	atomic<idx_t> bytes_read;
+	//! The queue of unpinned blocks that the buffer manager evicts from when the limit of this tracker is exceeded
+	unique_ptr<EvictionQueue> eviction_queue;
+};
+
+//! Makes a memory tracker the active tracker of the current thread for the lifetime of the object
+class MemoryTrackerScope {
+public:
+	explicit MemoryTrackerScope(shared_ptr<MemoryTracker> tracker);
+	~MemoryTrackerScope();
+
+private:
+	//! The tracker that is active within the scope
+	shared_ptr<MemoryTracker> tracker;
+	//! The tracker that was active before the scope was entered
+	MemoryTracker *previous;
+};
+
+} // namespace duckdb
@@ -15,6 +15,7 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
+#include "duckdb/storage/buffer/memory_tracker.hpp"
 
 #include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
@@ -23,6 +24,7 @@ namespace duckdb {
 class DatabaseInstance;
 class TemporaryDirectoryHandle;
 struct EvictionQueue;
+struct PrefetchQueue;
 
 //! The buffer manager is in charge of handling memory management for the database. It hands out memory buffers that can
 //! be used by the database internally.
@@ -49,6 +51,11 @@ public:
 	unique_ptr<BufferHandle> Pin(shared_ptr<BlockHandle> &handle);
 	void Unpin(shared_ptr<BlockHandle> &handle);
 
+	//! Asynchronously read the given blocks into memory ahead of their use (e.g. the blocks of a row group that is
+	//! about to be scanned). Prefetching is best-effort: blocks that are already loaded, or that cannot be loaded, are
+	//! skipped. The reads are issued by a bounded pool of I/O threads.
+	void Prefetch(const vector<shared_ptr<BlockHandle>> &handles);
+
 	void UnregisterBlock(block_id_t block_id, bool can_destroy);
 
 	//! Set a new memory limit to the buffer manager, throws an exception if the new limit is too low and not enough
@@ -71,10 +78,47 @@ public:
 
 	void SetTemporaryDirectory(string new_dir);
 
+	//! The amount of times a pin found a block of the base file already in memory
+	idx_t GetBlockHits() {
+		return block_hits;
+	}
+	//! The amount of times a pin had to read a block of the base file from disk
+	idx_t GetBlockMisses() {
+		return block_misses;
+	}
+	//! The amount of blocks that were evicted from memory
+	idx_t GetEvictions() {
+		return evictions;
+	}
+	//! The memory tracker of the database, all other memory trackers are (indirect) children of this tracker
+	const shared_ptr<MemoryTracker> &GetMemoryTracker() {
+		return memory_tracker;
+	}
+
 private:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
 	bool EvictBlocks(idx_t extra_memory, idx_t memory_limit);
+	//! Evict blocks accounted to the given memory tracker until extra_memory fits within the limit of the tracker,
+	//! returns false if this was not possible (i.e. not enough blocks of the tracker could be evicted)
+	bool EvictTrackerBlocks(MemoryTracker &tracker, idx_t extra_memory);
+	//! Evict blocks accounted to the given memory tracker that are only in the global queue (because they were unpinned
+	//! before the limit of the tracker was set), returns false if not enough blocks could be evicted
+	bool EvictTrackerBlocksFromGlobalQueue(MemoryTracker &tracker, idx_t extra_memory);
+	//! Make room for extra_memory within the memory limits of the given tracker and its ancestors, throws an exception
+	//! if this is not possible
+	void EnforceMemoryLimits(MemoryTracker &tracker, idx_t extra_memory);
+
+	//! Pin a block; pins issued by the prefetcher are not counted as a use of the block
+	unique_ptr<BufferHandle> PinInternal(shared_ptr<BlockHandle> &handle, bool prefetch);
+	//! Add an unpinned block to the given eviction queue
+	void Enqueue(EvictionQueue &target, shared_ptr<BlockHandle> &handle);
+	//! Record a pin of the block in its reference count and in the hit/miss counters (requires the block lock)
+	void AddReference(BlockHandle &handle, bool loaded, bool prefetch);
+	//! Returns the memory tracker that new allocations of the current thread are accounted to
+	shared_ptr<MemoryTracker> GetActiveMemoryTracker();
+	//! In NUMA mode, places a newly allocated buffer on the NUMA node of the current thread (before it is first used)
+	void PlaceBuffer(FileBuffer &buffer);
 
 	//! Write a temporary buffer to disk
 	void WriteTemporaryBuffer(ManagedBuffer &buffer);
@@ -87,7 +131,13 @@ private:
 
 	void RequireTemporaryDirectory();
 
+	//! The main loop of the I/O threads used for prefetching
+	void PrefetchBlocks();
+
 private:
+	//! The maximum amount of blocks that can be queued for prefetching
+	static constexpr const idx_t MAXIMUM_PREFETCH_QUEUE_SIZE = 1024;
+
 	//! The database instance
 	DatabaseInstance &db;
 	//! The current amount of memory that is occupied by the buffer manager (in bytes)
@@ -104,9 +154,19 @@ private:
 	mutex manager_lock;
 	//! A mapping of block id -> BlockHandle
 	unordered_map<block_id_t, weak_ptr<BlockHandle>> blocks;
-	//! Eviction queue
+	//! Eviction queue of all unpinned blocks (the memory trackers keep their own queues of their blocks)
 	unique_ptr<EvictionQueue> queue;
+	//! The queue of blocks to prefetch, together with the I/O threads that read them
+	unique_ptr<PrefetchQueue> prefetch_queue;
 	//! The temporary id used for managed buffers
 	atomic<block_id_t> temporary_id;
+	//! The amount of pins of base file blocks that were already loaded
+	atomic<idx_t> block_hits;
+	//! The amount of pins of base file blocks that had to be read from disk
+	atomic<idx_t> block_misses;
+	//! The amount of evicted blocks
+	atomic<idx_t> evictions;
+	//! The memory tracker of the database
+	shared_ptr<MemoryTracker> memory_tracker;
 };
 } // namespace duckdb
@@ -16,6 +16,7 @@ class UncompressedSegment;
 class RowGroup;
 class BaseStatistics;
 class SegmentStatistics;
+class BufferHandle;
 
 //! The table data writer is responsible for writing the data of a table to the block manager
 class TableDataWriter {
@@ -31,10 +32,24 @@ public:
 		return meta_writer;
 	}
 
+	//! Allocate space for a compressed segment of the given size. Compressed segments are packed together into shared
+	//! blocks; the block id and the offset within the block are written to "block_id" and "offset_in_block".
+	data_ptr_t AllocateCompressedSegment(idx_t size, block_id_t &block_id, uint32_t &offset_in_block);
+
+private:
+	//! Write the partially filled block holding compressed segments (if any) to disk
+	void FlushPartialBlock();
+
 private:
 	DatabaseInstance &db;
 	TableCatalogEntry &table;
 	MetaBlockWriter &meta_writer;
+	//! The block that compressed segments are currently written to
+	unique_ptr<BufferHandle> partial_block;
+	//! The block id of the partial block
+	block_id_t partial_block_id;
+	//! The amount of bytes used in the partial block
+	idx_t partial_block_offset;
 };
 
 } // namespace duckdb
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/bitpacking_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/compressed_segment.hpp"
+
+namespace duckdb {
+
+//! Helper functions to read and write values packed at a fixed bit width
+struct BitpackingPrimitives {
+	//! The maximum supported bit width: unpacking reads a single (unaligned) 64-bit word per value
+	static constexpr idx_t MAXIMUM_BIT_WIDTH = 56;
+
+	//! Returns the number of bits required to represent the value
+	static inline idx_t RequiredBitWidth(uint64_t value) {
+		idx_t width = 0;
+		while (value > 0) {
+			width++;
+			value >>= 1;
+		}
+		return width;
+	}
+	//! Returns the number of bytes required to store "count" values of the given width, including the padding that
+	//! is required to safely unpack the final value
+	static inline idx_t PackedSize(idx_t count, idx_t width) {
+		return (count * width + 7) / 8 + sizeof(uint64_t);
+	}
+	//! Write a value at the given index; the target must be zero-initialized
+	static inline void PackValue(data_ptr_t target, idx_t index, idx_t width, uint64_t value) {
+		if (width == 0) {
+			return;
+		}
+		idx_t bit_pos = index * width;
+		auto ptr = target + bit_pos / 8;
+		Store<uint64_t>(Load<uint64_t>(ptr) | (value << (bit_pos % 8)), ptr);
+	}
+	//! Read the value at the given index
+	static inline uint64_t UnpackValue(data_ptr_t source, idx_t index, idx_t width) {
+		if (width == 0) {
+			return 0;
+		}
+		idx_t bit_pos = index * width;
+		auto word = Load<uint64_t>(source + bit_pos / 8);
+		return (word >> (bit_pos % 8)) & ((uint64_t(1) << width) - 1);
+	}
+};
+
+//! A bitpacking segment stores a segment using frame-of-reference compression: every value is stored as its offset
+//! from the segment minimum, bitpacked to the smallest width that fits the range of the segment.
+class BitpackingSegment : public CompressedSegment {
+public:
+	BitpackingSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, block_id_t block_id, idx_t offset);
+
+	//! Size of the header: the bit width followed by the reference value (padded to the size of the largest type)
+	static constexpr idx_t HEADER_SIZE = sizeof(uint64_t) + sizeof(uint64_t);
+
+public:
+	void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) override;
+	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) override;
+
+	//! Returns the size in bytes of the bitpacked representation of the data, or INVALID_INDEX if the type or the
+	//! range of the data is not supported
+	static idx_t AnalyzeSize(PhysicalType type, idx_t count, BaseStatistics &stats);
+	//! Write the bitpacked representation of the data to the target
+	static void Compress(PhysicalType type, data_ptr_t data, idx_t count, BaseStatistics &stats, data_ptr_t target);
+
+public:
+	typedef void (*unpack_function_t)(data_ptr_t base, idx_t start, idx_t count, Vector &result, idx_t result_offset);
+
+private:
+	unpack_function_t unpack_function;
+};
+
+} // namespace duckdb
@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/compressed_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/uncompressed_segment.hpp"
+#include "duckdb/common/enums/compression_type.hpp"
+
+namespace duckdb {
+class BaseStatistics;
+class TableFilter;
+
+//! A compressed segment is a read-only segment holding lightweight-compressed data of a persistent column segment. The
+//! compressed data is stored at an offset within a block that can be shared with other compressed segments. Scans
+//! decompress directly into the result vector.
+class CompressedSegment : public UncompressedSegment {
+public:
+	CompressedSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, CompressionType compression,
+	                  block_id_t block_id = INVALID_BLOCK, idx_t offset = 0);
+
+	//! The compression type of the segment
+	CompressionType compression;
+	//! The offset of the compressed data within the block
+	idx_t offset;
+
+public:
+	void InitializeScan(ColumnScanState &state) override;
+
+	//! Compressed segments are read-only: appends are not supported
+	idx_t Append(SegmentStatistics &stats, VectorData &data, idx_t offset, idx_t count) override;
+	void RevertAppend(idx_t start_row) override;
+
+	//! NULL values are stored as NullValue<T> in uncompressed segments. Since the segment statistics cover every valid
+	//! value, a value outside of [min, max] must be a NULL: it is never read, and can be replaced by any other value.
+	template <class T>
+	static inline bool IsNullValue(T value, T min, T max) {
+		return value < min || max < value;
+	}
+	//! Align an offset within the compressed data to 8 bytes
+	static inline idx_t AlignOffset(idx_t offset) {
+		return (offset + 7) / 8 * 8;
+	}
+
+	//! Whether or not the filter can be evaluated on the distinct values of a compressed segment (i.e. the filter is
+	//! a constant comparison, or a conjunction of constant comparisons)
+	static bool CanFilterValues(const TableFilter &filter);
+	//! Evaluate the filter on "count" (at most STANDARD_VECTOR_SIZE) distinct values of a compressed segment. For
+	//! every value, "matches" is set to whether or not the value satisfies the filter.
+	static void FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool matches[]);
+
+protected:
+	//! Returns a pointer to the start of the compressed data in the pinned block
+	data_ptr_t GetCompressedData(BufferHandle &handle) {
+		return handle.node->buffer + offset;
+	}
+};
+
+//! SegmentCompression selects and applies the lightweight compression used for persistent column segments
+class SegmentCompression {
+public:
+	//! Analyze the data of a (full) uncompressed segment and pick the compression type with the smallest footprint,
+	//! based on the segment statistics. The size of the compressed data in bytes is written to "compressed_size".
+	//! Returns COMPRESSION_UNCOMPRESSED if no compression method can beat storing the segment in its own block.
+	static CompressionType Analyze(UncompressedSegment &segment, BaseStatistics &stats, idx_t &compressed_size);
+	//! Compress the data of the uncompressed segment into "target" using the specified compression type
+	static void Compress(CompressionType compression, UncompressedSegment &segment, BaseStatistics &stats,
+	                     data_ptr_t target);
+	//! Create a segment that reads compressed data from the specified block and offset
+	static unique_ptr<UncompressedSegment> CreateSegment(DatabaseInstance &db, CompressionType compression,
+	                                                     PhysicalType type, idx_t row_start, block_id_t block_id,
+	                                                     idx_t offset, BaseStatistics &stats);
+};
+
+} // namespace duckdb
@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/constant_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/compressed_segment.hpp"
+
+namespace duckdb {
+
+//! A constant segment holds a segment in which every (non-null) value is identical. The value is taken from the
+//! segment statistics, so no data is written to disk at all. For validity segments, a constant segment represents a
+//! segment without any NULL values.
+class ConstantSegment : public CompressedSegment {
+public:
+	ConstantSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, BaseStatistics &stats);
+
+	//! The constant value of the segment, in its physical representation
+	data_t constant[sizeof(hugeint_t)];
+
+public:
+	void InitializeScan(ColumnScanState &state) override;
+	void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) override;
+	//! Emits a constant vector
+	void ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) override;
+	bool FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, const TableFilter &filter,
+	                SelectionVector &sel, idx_t &approved_tuple_count) override;
+	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) override;
+
+	//! Whether or not a segment with the given statistics can be stored as a constant segment
+	static bool CanCompress(PhysicalType type, BaseStatistics &stats);
+
+public:
+	typedef void (*fill_function_t)(data_ptr_t constant, Vector &result, idx_t result_offset, idx_t count);
+
+private:
+	fill_function_t fill_function;
+};
+
+} // namespace duckdb
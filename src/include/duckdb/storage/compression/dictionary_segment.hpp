@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/dictionary_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/compressed_segment.hpp"
+
+namespace duckdb {
+
+struct DictionaryScanState : public SegmentScanState {
+	//! The filter that was evaluated on the dictionary (if any)
+	const TableFilter *filter = nullptr;
+	//! For every dictionary entry, whether or not the entry satisfies the filter
+	unique_ptr<bool[]> matches;
+	//! The strings of the dictionary, used to emit dictionary vectors (if any)
+	unique_ptr<Vector> dictionary;
+};
+
+//! A dictionary segment stores every distinct string of a segment once, and stores a bitpacked dictionary code for
+//! every row. The layout is [header][string offsets...][string data...][codes...].
+class DictionarySegment : public CompressedSegment {
+public:
+	DictionarySegment(DatabaseInstance &db, idx_t row_start, block_id_t block_id, idx_t offset);
+
+	struct DictionaryHeader {
+		//! The amount of distinct strings in the dictionary
+		uint32_t dictionary_size;
+		//! The bit width of the dictionary codes
+		uint32_t code_width;
+		//! The offset of the codes (relative to the start of the segment data)
+		uint32_t codes_offset;
+		uint32_t padding;
+	};
+
+public:
+	void InitializeScan(ColumnScanState &state) override;
+	void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) override;
+	//! Emits a dictionary vector that references the strings of the dictionary
+	void ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) override;
+	//! Evaluates the filter once for every dictionary entry, and filters the rows based on their dictionary codes
+	bool FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, const TableFilter &filter,
+	                SelectionVector &sel, idx_t &approved_tuple_count) override;
+	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) override;
+
+	//! Whether or not a string segment with the given statistics can be dictionary compressed. Segments that contain
+	//! overflow strings are not supported.
+	static bool CanCompress(BaseStatistics &stats);
+	//! Returns the size in bytes of the dictionary representation of the strings
+	static idx_t AnalyzeSize(string_t *strings, idx_t count);
+	//! Write the dictionary representation of the strings to the target
+	static void Compress(string_t *strings, idx_t count, data_ptr_t target);
+
+private:
+	data_ptr_t PinData(ColumnFetchState &state);
+};
+
+} // namespace duckdb
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/rle_segment.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/storage/compression/compressed_segment.hpp"
+
+namespace duckdb {
+
+struct RLEScanState : public SegmentScanState {
+	//! The run that contains the next row to scan
+	idx_t entry_pos = 0;
+	//! The next row that will be scanned (relative to the start of the segment)
+	idx_t row_pos = 0;
+};
+
+//! An RLE segment stores a segment as a list of runs. The layout is [run_count][values...][run_ends...], where
+//! run_ends holds the (exclusive) end row of each run. Storing the run ends instead of the run lengths allows
+//! fetching individual rows using a binary search.
+class RLESegment : public CompressedSegment {
+public:
+	RLESegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, block_id_t block_id, idx_t offset);
+
+	typedef uint32_t rle_run_end_t;
+
+public:
+	void InitializeScan(ColumnScanState &state) override;
+	void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) override;
+	//! Emits a constant vector if the entire vector is part of a single run
+	void ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) override;
+	//! Evaluates the filter once for every run, and filters the rows based on the run they belong to
+	bool FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, const TableFilter &filter,
+	                SelectionVector &sel, idx_t &approved_tuple_count) override;
+	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) override;
+
+	//! Returns the size in bytes of the RLE representation of the data, or INVALID_INDEX if the type is unsupported
+	static idx_t AnalyzeSize(PhysicalType type, data_ptr_t data, idx_t count, BaseStatistics &stats);
+	//! Write the RLE representation of the data to the target
+	static void Compress(PhysicalType type, data_ptr_t data, idx_t count, BaseStatistics &stats, data_ptr_t target);
+
+public:
+	typedef void (*rle_scan_function_t)(data_ptr_t base, RLEScanState &state, idx_t start, idx_t scan_count,
+	                                    Vector &result, idx_t result_offset);
+	typedef void (*rle_fetch_function_t)(data_ptr_t base, idx_t row, Vector &result, idx_t result_idx);
+
+private:
+	rle_scan_function_t scan_function;
+	rle_fetch_function_t fetch_function;
+};
+
+} // namespace duckdb
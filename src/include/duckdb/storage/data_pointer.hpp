@@ -13,6 +13,7 @@
 #include "duckdb/storage/storage_info.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/common/enums/compression_type.hpp"
 
 namespace duckdb {
 
@@ -20,6 +21,8 @@ struct DataPointer {
 	uint64_t row_start;
 	uint64_t tuple_count;
 	BlockPointer block_pointer;
+	//! The compression type of the segment
+	CompressionType compression_type = CompressionType::COMPRESSION_UNCOMPRESSED;
 	//! Type-specific statistics of the segment
 	unique_ptr<BaseStatistics> statistics;
 };
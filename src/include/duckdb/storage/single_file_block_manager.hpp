@@ -13,6 +13,7 @@
 #include "duckdb/storage/block.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/unordered_set.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/set.hpp"
 #include "duckdb/common/vector.hpp"
 
@@ -36,6 +37,8 @@ public:
 	bool IsRootBlock(block_id_t root) override;
 	//! Register a new block to be used as a meta block
 	void MarkBlockAsModified(block_id_t block_id) override;
+	//! Increase the reference count of a shared block
+	void IncreaseBlockReferenceCount(block_id_t block_id) override;
 	//! Return the meta block id
 	block_id_t GetMetaBlock() override;
 	//! Read the content of the block from disk
@@ -73,6 +76,8 @@ private:
 	set<block_id_t> free_list;
 	//! The list of blocks that will be added to the free list
 	unordered_set<block_id_t> modified_blocks;
+	//! The reference counts of blocks that are shared by multiple segments
+	unordered_map<block_id_t, idx_t> block_reference_counts;
 	//! The current meta block id
 	block_id_t meta_block;
 	//! The current maximum block id, this id will be given away first after the free_list runs out
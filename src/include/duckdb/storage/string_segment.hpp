@@ -93,10 +93,12 @@ private:
 	void SetDictionaryOffset(BufferHandle &handle, idx_t offset);
 	idx_t GetDictionaryOffset(BufferHandle &handle);
 
-private:
+public:
 	//! The max string size that is allowed within a block. Strings bigger than this will be labeled as a BIG STRING and
 	//! offloaded to the overflow blocks.
 	static constexpr uint16_t STRING_BLOCK_LIMIT = 4096;
+
+private:
 	//! Marker used in length field to indicate the presence of a big string
 	static constexpr uint16_t BIG_STRING_MARKER = (uint16_t)-1;
 	//! Base size of big string marker (block id + offset)
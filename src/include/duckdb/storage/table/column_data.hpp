@@ -27,6 +27,8 @@ class TableDataWriter;
 class PersistentSegment;
 class PersistentColumnData;
 class Transaction;
+class TableFilter;
+class BlockHandle;
 
 struct DataTableInfo;
 
@@ -60,11 +62,19 @@ public:
 	virtual void InitializeScan(ColumnScanState &state);
 	//! Initialize a scan starting at the specified offset
 	virtual void InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx);
+	//! Gather the blocks that hold the persistent data of the column from the specified row onwards, so that they can
+	//! be prefetched ahead of a scan
+	virtual void CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks);
 	//! Scan the next vector from the column
 	virtual void Scan(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
 	virtual void ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates);
 	virtual void ScanCommittedRange(idx_t row_group_start, idx_t offset_in_row_group, idx_t count, Vector &result);
 	virtual void ScanCount(ColumnScanState &state, Vector &result, idx_t count);
+	//! Scan the next vector from the column and apply the filter to it, narrowing down the selection vector
+	virtual void Select(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+	                    SelectionVector &sel, idx_t &approved_tuple_count, TableFilter &filter);
+	virtual void SelectCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                             idx_t &approved_tuple_count, TableFilter &filter, bool allow_updates);
 
 	//! Skip the scan forward by "count" rows
 	virtual void Skip(ColumnScanState &state, idx_t count = STANDARD_VECTOR_SIZE);
@@ -117,10 +127,17 @@ protected:
 
 	//! Scans a base vector from the column
 	idx_t ScanVector(ColumnScanState &state, Vector &result, idx_t remaining);
+	//! Scans a base vector from the column. If the vector lies within a single segment the segment can emit a constant
+	//! or dictionary vector, instead of a flat vector.
+	idx_t ScanCompressedVector(ColumnScanState &state, Vector &result);
 	//! Scans a vector from the column merged with any potential updates
 	//! If ALLOW_UPDATES is set to false, the function will instead throw an exception if any updates are found
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	void ScanVector(Transaction *transaction, idx_t vector_index, ColumnScanState &state, Vector &result);
+	//! Scans a vector from the column, evaluating the filter directly on the (compressed) data of the segment. Returns
+	//! false if this is not possible for the vector, in which case nothing is scanned.
+	bool FilterScanVector(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                      idx_t &approved_tuple_count, TableFilter &filter);
 
 protected:
 	//! The segments holding the data of this column segment
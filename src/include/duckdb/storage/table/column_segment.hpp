@@ -58,6 +58,11 @@ public:
 	void InitializeScan(ColumnScanState &state);
 	//! Scan one vector from this segment
 	void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset);
+	//! Scan one entire vector from this segment, potentially emitting a constant or dictionary vector
+	void ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result);
+	//! Scan one vector from this segment, applying the filter directly on the segment data (if supported)
+	bool FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, const TableFilter &filter,
+	                SelectionVector &sel, idx_t &approved_tuple_count);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
 };
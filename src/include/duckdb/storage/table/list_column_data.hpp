@@ -29,6 +29,7 @@ public:
 
 	void InitializeScan(ColumnScanState &state) override;
 	void InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) override;
+	void CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks) override;
 
 	void Scan(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result) override;
 	void ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates) override;
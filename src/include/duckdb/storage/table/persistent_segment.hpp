@@ -10,6 +10,7 @@
 
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/block.hpp"
+#include "duckdb/common/enums/compression_type.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -17,12 +18,15 @@ class DatabaseInstance;
 class PersistentSegment : public ColumnSegment {
 public:
 	PersistentSegment(DatabaseInstance &db, block_id_t id, idx_t offset, const LogicalType &type, idx_t start,
-	                  idx_t count, unique_ptr<BaseStatistics> statistics);
+	                  idx_t count, unique_ptr<BaseStatistics> statistics,
+	                  CompressionType compression = CompressionType::COMPRESSION_UNCOMPRESSED);
 
 	//! The block id that this segment relates to
 	block_id_t block_id;
 	//! The offset into the block
 	idx_t offset;
+	//! The compression type of the segment
+	CompressionType compression;
 };
 
 } // namespace duckdb
@@ -138,6 +138,10 @@ public:
 private:
 	ChunkInfo *GetChunkInfo(idx_t vector_idx);
 
+	//! Prefetch the blocks of the columns that are scanned, from the specified row onwards
+	void PrefetchBlocks(RowGroupScanState &state, idx_t row_idx);
+	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
+	void ScanColumn(Transaction *transaction, RowGroupScanState &state, idx_t i, Vector &result, idx_t current_row);
 	template <bool SCAN_DELETES, bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	void TemplatedScan(Transaction *transaction, RowGroupScanState &state, DataChunk &result);
 
@@ -33,6 +33,12 @@ struct IndexScanState {
 
 typedef unordered_map<block_id_t, unique_ptr<BufferHandle>> buffer_handle_set_t;
 
+//! Segment-specific scan state, used by compressed segments to keep track of their position in the compressed data
+struct SegmentScanState {
+	virtual ~SegmentScanState() {
+	}
+};
+
 struct ColumnScanState {
 	//! The column segment that is currently being scanned
 	ColumnSegment *current;
@@ -40,6 +46,8 @@ struct ColumnScanState {
 	idx_t row_index;
 	//! The primary buffer handle
 	unique_ptr<BufferHandle> primary_handle;
+	//! The segment-specific scan state (if any)
+	unique_ptr<SegmentScanState> scan_state;
 	//! Child states of the vector
 	vector<ColumnScanState> child_states;
 	//! Whether or not InitializeState has been called for this segment
@@ -27,10 +27,15 @@ public:
 
 	void InitializeScan(ColumnScanState &state) override;
 	void InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) override;
+	void CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks) override;
 
 	void Scan(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result) override;
 	void ScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, bool allow_updates) override;
 	void ScanCount(ColumnScanState &state, Vector &result, idx_t count) override;
+	void Select(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+	            SelectionVector &sel, idx_t &approved_tuple_count, TableFilter &filter) override;
+	void SelectCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+	                     idx_t &approved_tuple_count, TableFilter &filter, bool allow_updates) override;
 
 	void InitializeAppend(ColumnAppendState &state) override;
 	void AppendData(BaseStatistics &stats, ColumnAppendState &state, VectorData &vdata, idx_t count) override;
@@ -32,6 +32,7 @@ public:
 public:
 	void InitializeScan(ColumnScanState &state) override;
 	void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) override;
+	void ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) override;
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) override;
 	idx_t Append(SegmentStatistics &stats, VectorData &data, idx_t offset, idx_t count) override;
 	void RevertAppend(idx_t start_row) override;
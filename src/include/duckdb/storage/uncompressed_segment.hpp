@@ -47,9 +47,19 @@ public:
 	//! Scans a vector of "scan_count" entries starting at position "start"
 	//! Store it in result with offset "result_offset"
 	virtual void Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) = 0;
+	//! Scans an entire vector of "scan_count" entries starting at position "start" into the result. Unlike Scan, the
+	//! result is not necessarily a flat vector: segments can emit a constant or dictionary vector instead.
+	virtual void ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result);
 
 	static void FilterSelection(SelectionVector &sel, Vector &result, const TableFilter &filter,
 	                            idx_t &approved_tuple_count, ValidityMask &mask);
+	//! Scans a vector of "scan_count" entries starting at position "start", and applies the filter to the entries in
+	//! the selection vector. Only the entries that pass the filter are written to the result. Returns false if the
+	//! segment cannot evaluate the filter directly, in which case nothing is scanned.
+	virtual bool FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+	                        const TableFilter &filter, SelectionVector &sel, idx_t &approved_tuple_count) {
+		return false;
+	}
 
 	//! Fetch a single value and append it to the vector
 	virtual void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) = 0;
@@ -23,6 +23,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/main/appender.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/parser/statement/relation_statement.hpp"
@@ -30,6 +31,7 @@
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/planner/pragma_handler.hpp"
 #include "duckdb/common/to_string.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 
@@ -54,6 +56,17 @@ ClientContext::ClientContext(shared_ptr<DatabaseInstance> database)
 	std::random_device rd;
 	random_engine.seed(rd());
 
+	// the connection that initializes the catalog is created before the buffer manager
+	auto &storage = StorageManager::GetStorageManager(*db);
+	memory_tracker =
+	    make_shared<MemoryTracker>(storage.buffer_manager ? storage.buffer_manager->GetMemoryTracker() : nullptr);
+	query_memory_tracker = make_shared<MemoryTracker>(memory_tracker);
+	auto &config = DBConfig::GetConfig(*db);
+	memory_tracker->SetLimit(config.connection_memory_limit);
+	query_memory_tracker->SetLimit(config.query_memory_limit);
+	query_priority = config.query_priority;
+	scheduling_group = make_shared<SchedulingGroup>(query_priority);
+
 	progress_bar = make_unique<ProgressBar>(&executor, wait_time);
 }
 
@@ -419,7 +432,8 @@ unique_ptr<QueryResult> ClientContext::RunStatementOrPreparedStatement(ClientCon
 		statement = move(copied_statement);
 	}
 	// start the profiler
-	profiler->StartQuery(query);
+	query_memory_tracker->ResetStatistics();
+	profiler->StartQuery(query, query_memory_tracker);
 	try {
 		if (statement) {
 			result = RunStatementInternal(lock, query, move(statement), allow_stream_result);
@@ -742,6 +756,20 @@ bool ClientContext::UpdateFunctionInfoFromEntry(ScalarFunctionCatalogEntry *exis
 	return need_rewrite_entry;
 }
 
+bool ClientContext::TryGetCurrentSetting(const string &key, Value &result) {
+	if (StringUtil::Lower(key) == "query_priority") {
+		result = Value(DBConfig::QueryPriorityToString(query_priority));
+		return true;
+	}
+	auto &set_variables = db->config.set_variables;
+	auto entry = set_variables.find(key);
+	if (entry == set_variables.end()) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
 void ClientContext::RegisterFunction(CreateFunctionInfo *info) {
 	RunFunctionInTransaction([&]() {
 		auto &catalog = Catalog::GetCatalog(*this);
@@ -21,6 +21,17 @@ static ConfigurationOption internal_options[] = {
      LogicalTypeId::VARCHAR},
     {ConfigurationOptionType::THREADS, "threads", "The number of total threads used by the system",
      LogicalTypeId::BIGINT},
+    {ConfigurationOptionType::EVICTION_POLICY, "eviction_policy",
+     "The replacement policy of the buffer pool ([LRU] or 2Q)", LogicalTypeId::VARCHAR},
+    {ConfigurationOptionType::CONNECTION_MEMORY_LIMIT, "connection_memory_limit",
+     "The maximum memory of a single connection (e.g. 1GB)", LogicalTypeId::VARCHAR},
+    {ConfigurationOptionType::QUERY_MEMORY_LIMIT, "query_memory_limit",
+     "The maximum memory of a single query (e.g. 1GB)", LogicalTypeId::VARCHAR},
+    {ConfigurationOptionType::NUMA_MODE, "numa_mode",
+     "Pin the threads to NUMA nodes and allocate buffers on the node of the thread that uses them",
+     LogicalTypeId::BOOLEAN},
+    {ConfigurationOptionType::QUERY_PRIORITY, "query_priority",
+     "The default scheduling priority of the queries of a connection (LOW, NORMAL or HIGH)", LogicalTypeId::VARCHAR},
     {ConfigurationOptionType::INVALID, nullptr, nullptr, LogicalTypeId::INVALID}};
 
 vector<ConfigurationOption> DBConfig::GetOptions() {
@@ -96,11 +107,79 @@ void DBConfig::SetOption(const ConfigurationOption &option, const Value &value)
 		maximum_threads = value.GetValue<int64_t>();
 		break;
 	}
+	case ConfigurationOptionType::EVICTION_POLICY: {
+		eviction_policy = ParseEvictionPolicy(value.ToString());
+		break;
+	}
+	case ConfigurationOptionType::CONNECTION_MEMORY_LIMIT: {
+		connection_memory_limit = ParseMemoryLimit(value.ToString());
+		break;
+	}
+	case ConfigurationOptionType::QUERY_MEMORY_LIMIT: {
+		query_memory_limit = ParseMemoryLimit(value.ToString());
+		break;
+	}
+	case ConfigurationOptionType::NUMA_MODE: {
+		numa_mode = value.CastAs(LogicalType::BOOLEAN).GetValueUnsafe<int8_t>();
+		break;
+	}
+	case ConfigurationOptionType::QUERY_PRIORITY: {
+		query_priority = ParseQueryPriority(value.ToString());
+		break;
+	}
 	default:
 		break;
 	}
 }
 
+EvictionPolicy DBConfig::ParseEvictionPolicy(const string &arg) {
+	auto parameter = StringUtil::Lower(arg);
+	if (parameter == "lru") {
+		return EvictionPolicy::LRU;
+	} else if (parameter == "2q") {
+		return EvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized eviction policy \"%s\". Expected LRU or 2Q.", arg);
+	}
+}
+
+string DBConfig::EvictionPolicyToString(EvictionPolicy policy) {
+	switch (policy) {
+	case EvictionPolicy::LRU:
+		return "LRU";
+	case EvictionPolicy::TWO_QUEUE:
+		return "2Q";
+	default:
+		throw InternalException("Unrecognized eviction policy");
+	}
+}
+
+QueryPriority DBConfig::ParseQueryPriority(const string &arg) {
+	auto parameter = StringUtil::Lower(arg);
+	if (parameter == "low") {
+		return QueryPriority::LOW;
+	} else if (parameter == "normal") {
+		return QueryPriority::NORMAL;
+	} else if (parameter == "high") {
+		return QueryPriority::HIGH;
+	} else {
+		throw InvalidInputException("Unrecognized query priority \"%s\". Expected LOW, NORMAL or HIGH.", arg);
+	}
+}
+
+string DBConfig::QueryPriorityToString(QueryPriority priority) {
+	switch (priority) {
+	case QueryPriority::LOW:
+		return "low";
+	case QueryPriority::NORMAL:
+		return "normal";
+	case QueryPriority::HIGH:
+		return "high";
+	default:
+		throw InternalException("Unrecognized query priority");
+	}
+}
+
 idx_t DBConfig::ParseMemoryLimit(const string &arg) {
 	if (arg[0] == '-' || arg == "null" || arg == "none") {
 		return INVALID_INDEX;
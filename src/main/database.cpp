@@ -119,6 +119,7 @@ void DatabaseInstance::Initialize(const char *path, DBConfig *new_config) {
 	storage->Initialize();
 
 	// only increase thread count after storage init because we get races on catalog otherwise
+	scheduler->SetNumaMode(config.numa_mode);
 	scheduler->SetThreads(config.maximum_threads);
 }
 
@@ -202,6 +203,12 @@ void DatabaseInstance::Configure(DBConfig &new_config) {
 	config.allocator = move(new_config.allocator);
 	config.checkpoint_wal_size = new_config.checkpoint_wal_size;
 	config.use_direct_io = new_config.use_direct_io;
+	config.prefetch_threads = new_config.prefetch_threads;
+	config.eviction_policy = new_config.eviction_policy;
+	config.connection_memory_limit = new_config.connection_memory_limit;
+	config.query_memory_limit = new_config.query_memory_limit;
+	config.numa_mode = new_config.numa_mode;
+	config.query_priority = new_config.query_priority;
 	config.temporary_directory = new_config.temporary_directory;
 	config.collation = new_config.collation;
 	config.default_order_type = new_config.default_order_type;
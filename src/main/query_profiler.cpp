@@ -11,17 +11,22 @@
 #include "duckdb/common/limits.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/storage/buffer/memory_tracker.hpp"
 #include <utility>
 #include <algorithm>
 
 namespace duckdb {
 
-void QueryProfiler::StartQuery(string query) {
+void QueryProfiler::StartQuery(string query, shared_ptr<MemoryTracker> memory_tracker) {
 	if (!enabled) {
 		return;
 	}
 	this->running = true;
 	this->query = move(query);
+	this->memory_tracker = move(memory_tracker);
+	peak_memory_usage = 0;
+	bytes_spilled = 0;
+	bytes_read = 0;
 	tree_map.clear();
 	root = nullptr;
 	phase_timings.clear();
@@ -57,6 +62,8 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::HASH_JOIN:
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
+	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::ASOF_JOIN:
 	case PhysicalOperatorType::DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -74,6 +81,12 @@ void QueryProfiler::EndQuery() {
 
 	main_query.End();
 	this->running = false;
+	if (memory_tracker) {
+		peak_memory_usage = memory_tracker->GetPeakMemoryUsage();
+		bytes_spilled = memory_tracker->GetBytesSpilled();
+		bytes_read = memory_tracker->GetBytesRead();
+		memory_tracker.reset();
+	}
 	// print or output the query profiling after termination, if this is enabled
 	if (automatic_print_format != ProfilerPrintFormat::NONE) {
 		// check if this query should be output based on the operator types
@@ -317,6 +330,14 @@ void QueryProfiler::ToStream(std::ostream &ss, bool print_optimizer_output) cons
 	ss << "│┌───────────────────────────────────┐│\n";
 	string total_time = "Total Time: " + RenderTiming(main_query.Elapsed());
 	ss << "││" + DrawPadded(total_time, TOTAL_BOX_WIDTH - 4) + "││\n";
+	string peak_memory = "Peak Memory: " + StringUtil::FormatSize(peak_memory_usage);
+	ss << "││" + DrawPadded(peak_memory, TOTAL_BOX_WIDTH - 4) + "││\n";
+	if (bytes_spilled > 0 || bytes_read > 0) {
+		string spilled = "Spilled: " + StringUtil::FormatSize(bytes_spilled);
+		ss << "││" + DrawPadded(spilled, TOTAL_BOX_WIDTH - 4) + "││\n";
+		string read = "Re-read: " + StringUtil::FormatSize(bytes_read);
+		ss << "││" + DrawPadded(read, TOTAL_BOX_WIDTH - 4) + "││\n";
+	}
 	ss << "│└───────────────────────────────────┘│\n";
 	ss << "└─────────────────────────────────────┘\n";
 	// print phase timings
@@ -451,6 +472,9 @@ string QueryProfiler::ToJSON() const {
 	ss << "   \"result\": " + to_string(main_query.Elapsed()) + ",\n";
 	ss << "   \"timing\": " + to_string(main_query.Elapsed()) + ",\n";
 	ss << "   \"cardinality\": " + to_string(root->info.elements) + ",\n";
+	ss << "   \"peak_memory\": " + to_string(peak_memory_usage) + ",\n";
+	ss << "   \"bytes_spilled\": " + to_string(bytes_spilled) + ",\n";
+	ss << "   \"bytes_read\": " + to_string(bytes_read) + ",\n";
 	// JSON cannot have literal control characters in string literals
 	string extra_info = StringUtil::Replace(query, "\t", "\\t");
 	extra_info = StringUtil::Replace(extra_info, "\n", "\\n");
@@ -36,6 +36,7 @@ unique_ptr<NodeStatistics> StatisticsPropagator::PropagateStatistics(LogicalOper
 		return PropagateStatistics((LogicalProjection &)node, node_ptr);
 	case LogicalOperatorType::LOGICAL_ANY_JOIN:
 	case LogicalOperatorType::LOGICAL_COMPARISON_JOIN:
+	case LogicalOperatorType::LOGICAL_ASOF_JOIN:
 	case LogicalOperatorType::LOGICAL_JOIN:
 		return PropagateStatistics((LogicalJoin &)node, node_ptr);
 	case LogicalOperatorType::LOGICAL_UNION:
@@ -31,7 +31,7 @@ void Executor::Initialize(PhysicalOperator *plan) {
 		physical_state = physical_plan->GetOperatorState();
 
 		context.profiler->Initialize(physical_plan);
-		this->producer = scheduler.CreateProducer();
+		this->producer = scheduler.CreateProducer(context.scheduling_group);
 
 		BuildPipelines(physical_plan, nullptr);
 
@@ -128,6 +128,8 @@ void Executor::BuildPipelines(PhysicalOperator *op, Pipeline *parent) {
 		case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
 		case PhysicalOperatorType::HASH_JOIN:
 		case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
+		case PhysicalOperatorType::IE_JOIN:
+		case PhysicalOperatorType::ASOF_JOIN:
 		case PhysicalOperatorType::CROSS_PRODUCT:
 			// regular join, create a pipeline with RHS source that sinks into this pipeline
 			pipeline->child = op->children[1].get();
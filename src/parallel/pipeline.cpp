@@ -14,6 +14,7 @@
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
+#include "duckdb/execution/operator/persistent/physical_copy_to_file.hpp"
 
 namespace duckdb {
 
@@ -23,11 +24,20 @@ public:
 	}
 
 	TaskContext task;
+	PipelineTaskState task_state;
 	shared_ptr<Pipeline> pipeline;
 
 public:
 	void Execute() override {
-		pipeline->Execute(task);
+		if (!pipeline->Execute(task, task_state)) {
+			// the task yielded to the tasks of other queries: schedule the rest of the work as a new task
+			auto &token = pipeline->token;
+			auto continuation = make_unique<PipelineTask>(pipeline);
+			continuation->task = move(task);
+			continuation->task_state = move(task_state);
+			token.scheduler.ScheduleTask(token, move(continuation));
+			return;
+		}
 		pipeline->FinishTask();
 	}
 };
@@ -77,10 +87,10 @@ bool Pipeline::GetProgress(int &current_percentage) {
 	return GetProgress(client, child, current_percentage);
 }
 
-void Pipeline::Execute(TaskContext &task) {
+bool Pipeline::Execute(TaskContext &task, PipelineTaskState &task_state) {
 	auto &client = executor.context;
 	if (client.interrupted) {
-		return;
+		return true;
 	}
 	if (parallel_state) {
 		task.task_info[parallel_node] = parallel_state.get();
@@ -89,28 +99,38 @@ void Pipeline::Execute(TaskContext &task) {
 	ThreadContext thread(client);
 	ExecutionContext context(client, thread, task);
 	try {
-		auto state = child->GetOperatorState();
-		auto lstate = sink->GetLocalSinkState(context);
+		if (!task_state.state) {
+			task_state.state = child->GetOperatorState();
+			task_state.lstate = sink->GetLocalSinkState(context);
+		}
+		auto &state = *task_state.state;
+		auto &lstate = *task_state.lstate;
 		// incrementally process the pipeline
 		DataChunk intermediate;
 		child->InitializeChunk(intermediate);
 		while (true) {
-			child->GetChunk(context, intermediate, state.get());
+			child->GetChunk(context, intermediate, &state);
 			thread.profiler.StartOperator(sink);
 			if (intermediate.size() == 0) {
-				sink->Combine(context, *sink_state, *lstate);
+				sink->Combine(context, *sink_state, lstate);
 				break;
 			}
-			sink->Sink(context, *sink_state, *lstate, intermediate);
+			sink->Sink(context, *sink_state, lstate, intermediate);
 			thread.profiler.EndOperator(nullptr);
+			if (token.scheduler.ShouldYield(token)) {
+				// keep the state of the task, so it can continue where it left off
+				executor.Flush(thread);
+				return false;
+			}
 		}
-		child->FinalizeOperatorState(*state, context);
+		child->FinalizeOperatorState(state, context);
 	} catch (std::exception &ex) {
 		executor.PushError(ex.what());
 	} catch (...) {
 		executor.PushError("Unknown exception in pipeline!");
 	}
 	executor.Flush(thread);
+	return true;
 }
 
 void Pipeline::FinishTask() {
@@ -170,14 +190,16 @@ bool Pipeline::ScheduleOperator(PhysicalOperator *op) {
 	case PhysicalOperatorType::FILTER:
 	case PhysicalOperatorType::PROJECTION:
 	case PhysicalOperatorType::CROSS_PRODUCT:
+	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::ASOF_JOIN:
 	case PhysicalOperatorType::STREAMING_SAMPLE:
 	case PhysicalOperatorType::INOUT_FUNCTION:
-		// filter, projection or hash probe: continue in children
+		// filter, projection or join probe: continue in children
 		return ScheduleOperator(op->children[0].get());
 	case PhysicalOperatorType::HASH_JOIN: {
-		// hash join; for now we can't safely parallelize right or full outer join probes
+		// hash join; for now we can't safely parallelize right or full outer join probes, or probes of joins that spilled
 		auto &join = (PhysicalHashJoin &)*op;
-		if (IsRightOuterJoin(join.join_type)) {
+		if (IsRightOuterJoin(join.join_type) || join.IsExternal()) {
 			return false;
 		}
 		return ScheduleOperator(op->children[0].get());
@@ -266,6 +288,18 @@ void Pipeline::Schedule() {
 		}
 		break;
 	}
+	case PhysicalOperatorType::COPY_TO_FILE: {
+		auto &copy = (PhysicalCopyToFile &)*sink;
+		if (!copy.function.copy_to_parallel) {
+			// the copy function can only be called from a single thread: switch to sequential mode
+			break;
+		}
+		if (ScheduleOperator(sink->children[0].get())) {
+			// all parallel tasks have been scheduled: return
+			return;
+		}
+		break;
+	}
 	case PhysicalOperatorType::HASH_GROUP_BY: {
 		auto &hash_aggr = (PhysicalHashAggregate &)*sink;
 		if (!hash_aggr.all_combinable) {
@@ -279,6 +313,8 @@ void Pipeline::Schedule() {
 		break;
 	}
 	case PhysicalOperatorType::CROSS_PRODUCT:
+	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::ASOF_JOIN:
 	case PhysicalOperatorType::HASH_JOIN: {
 		// schedule build side of the join
 		if (ScheduleOperator(sink->children[1].get())) {
@@ -1,99 +1,220 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numa.hpp"
+#include "duckdb/common/random_engine.hpp"
+#include "duckdb/common/set.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
+#include <algorithm>
+
 #ifndef DUCKDB_NO_THREADS
-#include "concurrentqueue.h"
-#include "lightweightsemaphore.h"
 #include "duckdb/common/thread.hpp"
-#else
-#include <queue>
+#include <condition_variable>
 #endif
 
 namespace duckdb {
 
-struct SchedulerThread {
-#ifndef DUCKDB_NO_THREADS
-	explicit SchedulerThread(unique_ptr<thread> thread_p) : internal_thread(move(thread_p)) {
+struct ScheduledTask {
+	ScheduledTask() : producer(nullptr), virtual_time(0) {
 	}
 
-	unique_ptr<thread> internal_thread;
-#endif
+	ProducerToken *producer;
+	unique_ptr<Task> task;
+	//! The virtual time at which the task should be started to give every group its fair share
+	idx_t virtual_time;
 };
 
-#ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<unique_ptr<Task>> concurrent_queue_t;
-typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
+//! The tasks of a single producer within a TaskQueue
+struct ProducerTasks {
+	//! The tasks in the order in which they were scheduled
+	deque<unique_ptr<Task>> tasks;
+	//! The virtual times of the tasks in ascending order: whichever task of the producer is started next is started at
+	//! the earliest time, so the order in which the tasks of a producer run does not change the share of its group
+	deque<idx_t> times;
+};
 
-struct ConcurrentQueue {
-	concurrent_queue_t q;
-	lightweight_semaphore_t semaphore;
+//! A TaskQueue holds the tasks of a background thread (or the global tasks). Producers are ordered by the virtual time
+//! of their next task, so the producer whose group is furthest behind its fair share runs first. Within a producer the
+//! owning thread pops the newest task (LIFO), so follow-up work runs while its inputs are still in cache, while other
+//! threads take the oldest task.
+struct TaskQueue {
+	TaskQueue() : next_time(NumericLimits<idx_t>::Maximum()) {
+	}
 
-	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
-};
+	mutex lock;
+	//! The tasks of every producer that has tasks in this queue
+	unordered_map<ProducerToken *, ProducerTasks> producers;
+	//! The producers ordered by the virtual time of their next task
+	set<pair<idx_t, ProducerToken *>> order;
+	//! The virtual time of the next task (or the maximum value if the queue is empty), this can be read without holding
+	//! the lock
+	atomic<idx_t> next_time;
+
+	void Push(ProducerToken &producer, unique_ptr<Task> task, idx_t virtual_time) {
+		lock_guard<mutex> guard(lock);
+		PushInternal(producer, move(task), virtual_time);
+		UpdateNextTime();
+	}
 
-struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	//! Takes a task of the producer with the lowest virtual time (its newest task if newest is set, else its oldest)
+	bool Pop(ScheduledTask &entry, bool newest) {
+		lock_guard<mutex> guard(lock);
+		if (order.empty()) {
+			return false;
+		}
+		PopInternal(*order.begin()->second, entry, newest);
+		return true;
 	}
 
-	duckdb_moodycamel::ProducerToken queue_token;
-};
+	//! Takes the oldest task that was scheduled by the given producer
+	bool PopFromProducer(ProducerToken &producer, ScheduledTask &entry) {
+		lock_guard<mutex> guard(lock);
+		if (producers.find(&producer) == producers.end()) {
+			return false;
+		}
+		PopInternal(producer, entry, false);
+		return true;
+	}
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, move(task))) {
-		semaphore.signal();
-	} else {
-		throw InternalException("Could not schedule task!");
+	//! Moves all tasks of this queue to the target queue
+	void MoveTo(TaskQueue &target) {
+		lock_guard<mutex> guard(lock);
+		lock_guard<mutex> target_guard(target.lock);
+		for (auto &entry : producers) {
+			auto &producer_tasks = entry.second;
+			for (idx_t i = 0; i < producer_tasks.tasks.size(); i++) {
+				target.PushInternal(*entry.first, move(producer_tasks.tasks[i]), producer_tasks.times[i]);
+			}
+		}
+		producers.clear();
+		order.clear();
+		UpdateNextTime();
+		target.UpdateNextTime();
 	}
-}
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
-	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
-}
+private:
+	//! The lock must be held
+	void PushInternal(ProducerToken &producer, unique_ptr<Task> task, idx_t virtual_time) {
+		auto &producer_tasks = producers[&producer];
+		if (!producer_tasks.times.empty()) {
+			order.erase(make_pair(producer_tasks.times.front(), &producer));
+		}
+		producer_tasks.tasks.push_back(move(task));
+		// the tasks of a producer are scheduled in ascending virtual time, except when the queues of stopped threads
+		// are merged
+		producer_tasks.times.insert(
+		    std::upper_bound(producer_tasks.times.begin(), producer_tasks.times.end(), virtual_time), virtual_time);
+		order.insert(make_pair(producer_tasks.times.front(), &producer));
+	}
+
+	//! The lock must be held and the producer must have tasks in this queue
+	void PopInternal(ProducerToken &producer, ScheduledTask &entry, bool newest) {
+		auto producer_entry = producers.find(&producer);
+		D_ASSERT(producer_entry != producers.end());
+		auto &producer_tasks = producer_entry->second;
+		order.erase(make_pair(producer_tasks.times.front(), &producer));
+		entry.producer = &producer;
+		entry.virtual_time = producer_tasks.times.front();
+		producer_tasks.times.pop_front();
+		if (newest) {
+			entry.task = move(producer_tasks.tasks.back());
+			producer_tasks.tasks.pop_back();
+		} else {
+			entry.task = move(producer_tasks.tasks.front());
+			producer_tasks.tasks.pop_front();
+		}
+		if (producer_tasks.tasks.empty()) {
+			producers.erase(producer_entry);
+		} else {
+			order.insert(make_pair(producer_tasks.times.front(), &producer));
+		}
+		UpdateNextTime();
+	}
 
+	//! The lock must be held
+	void UpdateNextTime() {
+		next_time = order.empty() ? NumericLimits<idx_t>::Maximum() : order.begin()->first;
+	}
+};
+
+#ifndef DUCKDB_NO_THREADS
+struct TaskSignal {
+	mutex lock;
+	std::condition_variable cv;
+};
 #else
-struct ConcurrentQueue {
-	std::queue<std::unique_ptr<Task>> q;
-	mutex qlock;
+struct TaskSignal {};
+#endif
 
-	void Enqueue(ProducerToken &token, unique_ptr<Task> task);
-	bool DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task);
+struct SchedulerThread {
+	SchedulerThread(TaskScheduler &scheduler, idx_t seed) : scheduler(scheduler), random(seed), node(0) {
+	}
+
+	TaskScheduler &scheduler;
+	//! The local task queue of the thread
+	TaskQueue queue;
+	//! Used to select the threads to steal tasks from
+	RandomEngine random;
+	//! The NUMA node the thread is pinned to (always 0 if the threads are not pinned), protected by the thread lock
+	idx_t node;
+	//! The time at which the task that is currently executed by the thread was started
+	time_point<steady_clock> task_start;
+#ifndef DUCKDB_NO_THREADS
+	unique_ptr<thread> internal_thread;
+#endif
 };
 
-void ConcurrentQueue::Enqueue(ProducerToken &token, unique_ptr<Task> task) {
-	lock_guard<mutex> lock(qlock);
-	q.push(move(task));
-}
+#ifndef DUCKDB_NO_THREADS
+//! The background thread of a task scheduler that is running on this thread (if any)
+static thread_local SchedulerThread *current_scheduler_thread = nullptr;
+#endif
 
-bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
-	lock_guard<mutex> lock(qlock);
-	if (q.empty()) {
-		return false;
+//! The virtual time a group advances by when one of its tasks is started is this stride divided by its weight
+static constexpr idx_t SCHEDULING_STRIDE = 1 << 16;
+//! The time a task of a background thread runs before it yields to the tasks of groups that are further behind
+static constexpr int64_t TASK_TIME_SLICE_MS = 10;
+
+//! Advances the virtual time of the scheduler to the given time, it never moves backwards
+static void CatchUp(atomic<idx_t> &time, idx_t new_time) {
+	idx_t current = time;
+	while (current < new_time && !time.compare_exchange_weak(current, new_time)) {
 	}
-	task = move(q.front());
-	q.pop();
-	return true;
 }
 
-struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+SchedulingGroup::SchedulingGroup(QueryPriority priority) : pass(0), pending_tasks(0) {
+	SetPriority(priority);
+}
+
+void SchedulingGroup::SetPriority(QueryPriority priority) {
+	switch (priority) {
+	case QueryPriority::LOW:
+		weight = 1;
+		break;
+	case QueryPriority::HIGH:
+		weight = 16;
+		break;
+	default:
+		weight = 4;
+		break;
 	}
-};
-#endif
+}
 
-ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
-    : scheduler(scheduler), token(move(token)) {
+ProducerToken::ProducerToken(TaskScheduler &scheduler, shared_ptr<SchedulingGroup> group_p)
+    : scheduler(scheduler), group(move(group_p)), pending_tasks(0) {
 }
 
 ProducerToken::~ProducerToken() {
 }
 
-TaskScheduler::TaskScheduler() : queue(make_unique<ConcurrentQueue>()) {
+TaskScheduler::TaskScheduler()
+    : global_queue(make_unique<TaskQueue>()), pending_tasks(0), virtual_time(0), stolen_tasks(0),
+      sleeping_threads(0), signal(make_unique<TaskSignal>()), numa_mode(false) {
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -106,31 +227,168 @@ TaskScheduler &TaskScheduler::GetScheduler(ClientContext &context) {
 	return context.db->GetScheduler();
 }
 
-unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_unique<QueueProducerToken>(*queue);
-	return make_unique<ProducerToken>(*this, move(token));
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(shared_ptr<SchedulingGroup> group) {
+	if (!group) {
+		group = make_shared<SchedulingGroup>();
+	}
+	return make_unique<ProducerToken>(*this, move(group));
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, unique_ptr<Task> task) {
-	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, move(task));
+	// tasks scheduled by one of our own background threads go to the local queue of that thread
+	// this keeps the data the task works on in the caches of the thread that produced it
+	TaskQueue *queue = global_queue.get();
+#ifndef DUCKDB_NO_THREADS
+	if (current_scheduler_thread && &current_scheduler_thread->scheduler == this) {
+		queue = &current_scheduler_thread->queue;
+	}
+#endif
+	// the task of a group is started one stride (divided by the weight of the group) after its previous task
+	// a group that was idle starts from the virtual time of the scheduler, so it cannot claim the share it did not use
+	auto &group = *token.group;
+	idx_t stride = SCHEDULING_STRIDE / group.weight;
+	idx_t pass = group.pass;
+	idx_t task_time;
+	do {
+		task_time = MaxValue<idx_t>(pass, virtual_time);
+	} while (!group.pass.compare_exchange_weak(pass, task_time + stride));
+	// the counters are incremented before the task is pushed so they can never drop below zero
+	group.pending_tasks++;
+	token.pending_tasks++;
+	pending_tasks++;
+	queue->Push(token, move(task), task_time);
+	SignalTask();
+}
+
+void TaskScheduler::SignalTask() {
+#ifndef DUCKDB_NO_THREADS
+	if (sleeping_threads == 0) {
+		return;
+	}
+	// a thread registers itself as sleeping while holding the lock and before checking for pending tasks
+	// grabbing the lock here ensures that the thread is either waiting already or will see the new task
+	lock_guard<mutex> guard(signal->lock);
+	signal->cv.notify_one();
+#endif
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, unique_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (token.pending_tasks == 0) {
+		return false;
+	}
+	ScheduledTask entry;
+	bool found = global_queue->PopFromProducer(token, entry);
+	if (!found) {
+		// the tasks might have been scheduled by (or moved to) one of the background threads
+		lock_guard<mutex> guard(thread_lock);
+		for (auto &worker : threads) {
+			if (worker->queue.PopFromProducer(token, entry)) {
+				found = true;
+				break;
+			}
+		}
+	}
+	if (found) {
+		StartTask(entry, task);
+	}
+	return found;
+}
+
+void TaskScheduler::StartTask(ScheduledTask &entry, unique_ptr<Task> &task) {
+	auto &producer = *entry.producer;
+	task = move(entry.task);
+	// tasks are not necessarily started in the order of their virtual time (e.g. stolen tasks)
+	// the virtual time of the scheduler is the latest virtual time of a started task, so it only moves forwards
+	CatchUp(virtual_time, entry.virtual_time);
+	producer.pending_tasks--;
+	producer.group->pending_tasks--;
+	pending_tasks--;
+}
+
+bool TaskScheduler::ShouldYield(ProducerToken &producer) {
+#ifndef DUCKDB_NO_THREADS
+	// the thread of a client only executes the tasks of its own query, it never yields
+	auto current_thread = current_scheduler_thread;
+	if (!current_thread || &current_thread->scheduler != this) {
+		return false;
+	}
+	// only yield if tasks of other groups are waiting and no thread is idle to pick them up
+	if (pending_tasks <= producer.group->pending_tasks || sleeping_threads > 0) {
+		return false;
+	}
+	auto elapsed = duration_cast<std::chrono::milliseconds>(steady_clock::now() - current_thread->task_start);
+	return elapsed.count() >= TASK_TIME_SLICE_MS;
+#else
+	return false;
+#endif
+}
+
+bool TaskScheduler::GetTask(SchedulerThread *current_thread, unique_ptr<Task> &task) {
+	if (pending_tasks == 0) {
+		return false;
+	}
+	ScheduledTask entry;
+	bool found = false;
+	// take the newest task from the local queue, unless the global queue has a task with a lower virtual time
+	// the global lock is only taken if the local queue cannot provide the next task
+	if (current_thread && current_thread->queue.next_time <= global_queue->next_time) {
+		found = current_thread->queue.Pop(entry, true);
+	}
+	if (!found) {
+		found = global_queue->Pop(entry, false);
+	}
+	if (!found && current_thread) {
+		found = current_thread->queue.Pop(entry, true);
+	}
+	if (!found) {
+		// steal the next task of another thread, starting from a random thread
+		// threads on the same node are tried first, as their tasks are more likely to work on node-local memory
+		lock_guard<mutex> guard(thread_lock);
+		if (!threads.empty()) {
+			idx_t start = current_thread ? current_thread->random.NextRandomInteger() % threads.size() : 0;
+			idx_t node = current_thread ? current_thread->node : 0;
+			for (idx_t pass = 0; pass < 2 && !found; pass++) {
+				for (idx_t i = 0; i < threads.size(); i++) {
+					auto &victim = threads[(start + i) % threads.size()];
+					if (victim.get() == current_thread || (victim->node == node) != (pass == 0)) {
+						continue;
+					}
+					if (victim->queue.Pop(entry, false)) {
+						stolen_tasks++;
+						found = true;
+						break;
+					}
+				}
+			}
+		}
+	}
+	if (found) {
+		StartTask(entry, task);
+	}
+	return found;
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
+	auto current_thread = current_scheduler_thread && &current_scheduler_thread->scheduler == this
+	                          ? current_scheduler_thread
+	                          : nullptr;
 	unique_ptr<Task> task;
 	// loop until the marker is set to false
 	while (*marker) {
-		// wait for a signal with a timeout; the timeout allows us to periodically check
-		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (queue->q.try_dequeue(task)) {
+		if (GetTask(current_thread, task)) {
+			if (current_thread) {
+				current_thread->task_start = steady_clock::now();
+			}
 			task->Execute();
 			task.reset();
+			continue;
 		}
+		// no tasks available: sleep until a task is scheduled or the thread is stopped
+		unique_lock<mutex> guard(signal->lock);
+		sleeping_threads++;
+		signal->cv.wait(guard, [&] { return pending_tasks > 0 || !*marker; });
+		sleeping_threads--;
 	}
 #else
 	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
@@ -138,12 +396,44 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
+static void ThreadExecuteTasks(TaskScheduler *scheduler, SchedulerThread *scheduler_thread, atomic<bool> *marker) {
+	current_scheduler_thread = scheduler_thread;
 	scheduler->ExecuteForever(marker);
+	current_scheduler_thread = nullptr;
+}
+#endif
+
+void TaskScheduler::SetNumaMode(bool numa_mode_p) {
+#ifndef DUCKDB_NO_THREADS
+	lock_guard<mutex> guard(thread_lock);
+	if (numa_mode == numa_mode_p) {
+		return;
+	}
+	numa_mode = numa_mode_p;
+	for (idx_t i = 0; i < threads.size(); i++) {
+		PlaceThread(*threads[i], i);
+	}
+#endif
 }
+
+void TaskScheduler::PlaceThread(SchedulerThread &scheduler_thread, idx_t thread_idx) {
+#ifndef DUCKDB_NO_THREADS
+	auto &topology = NumaTopology::Get();
+	if (!numa_mode) {
+		NumaTopology::UnpinThread(*scheduler_thread.internal_thread);
+		scheduler_thread.node = 0;
+		return;
+	}
+	// spread the threads over the nodes, so all memory controllers are used
+	idx_t node = thread_idx % topology.NodeCount();
+	auto &cpus = topology.GetCpus(node);
+	auto cpu = cpus[(thread_idx / topology.NodeCount()) % cpus.size()];
+	scheduler_thread.node = NumaTopology::PinThread(*scheduler_thread.internal_thread, cpu) ? node : 0;
 #endif
+}
 
 int32_t TaskScheduler::NumberOfThreads() {
+	lock_guard<mutex> guard(thread_lock);
 	return threads.size() + 1;
 }
 
@@ -168,12 +458,17 @@ void TaskScheduler::SetThreadsInternal(int32_t n) {
 	idx_t new_thread_count = n - 1;
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
+		lock_guard<mutex> guard(thread_lock);
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
-			auto worker_thread = make_unique<thread>(ThreadExecuteTasks, this, marker.get());
-			auto thread_wrapper = make_unique<SchedulerThread>(move(worker_thread));
+			auto thread_wrapper = make_unique<SchedulerThread>(*this, threads.size());
+			thread_wrapper->internal_thread =
+			    make_unique<thread>(ThreadExecuteTasks, this, thread_wrapper.get(), marker.get());
+			if (numa_mode) {
+				PlaceThread(*thread_wrapper, threads.size());
+			}
 
 			threads.push_back(move(thread_wrapper));
 			markers.push_back(move(marker));
@@ -183,10 +478,21 @@ void TaskScheduler::SetThreadsInternal(int32_t n) {
 		for (idx_t i = new_thread_count; i < threads.size(); i++) {
 			*markers[i] = false;
 		}
+		{
+			// wake up the threads that are sleeping so they notice they have been cancelled
+			lock_guard<mutex> signal_guard(signal->lock);
+			signal->cv.notify_all();
+		}
 		// now join the threads to ensure they are fully stopped before erasing them
+		// the thread lock is not held here, as the threads might need it to steal tasks before they are stopped
 		for (idx_t i = new_thread_count; i < threads.size(); i++) {
 			threads[i]->internal_thread->join();
 		}
+		// hand any tasks left in the local queues of the stopped threads over to the remaining threads
+		lock_guard<mutex> guard(thread_lock);
+		for (idx_t i = new_thread_count; i < threads.size(); i++) {
+			threads[i]->queue.MoveTo(*global_queue);
+		}
 		// erase the threads/markers
 		threads.resize(new_thread_count);
 		markers.resize(new_thread_count);
@@ -19,7 +19,8 @@ bool JoinRef::Equals(const TableRef *other_p) const {
 		}
 	}
 	return left->Equals(other->left.get()) && right->Equals(other->right.get()) &&
-	       BaseExpression::Equals(condition.get(), other->condition.get()) && type == other->type;
+	       BaseExpression::Equals(condition.get(), other->condition.get()) && type == other->type &&
+	       is_asof == other->is_asof;
 }
 
 unique_ptr<TableRef> JoinRef::Copy() {
@@ -31,6 +32,7 @@ unique_ptr<TableRef> JoinRef::Copy() {
 	}
 	copy->type = type;
 	copy->is_natural = is_natural;
+	copy->is_asof = is_asof;
 	copy->alias = alias;
 	copy->using_columns = using_columns;
 	return move(copy);
@@ -44,6 +46,7 @@ void JoinRef::Serialize(Serializer &serializer) {
 	serializer.WriteOptional(condition);
 	serializer.Write<JoinType>(type);
 	serializer.Write<bool>(is_natural);
+	serializer.Write<bool>(is_asof);
 	D_ASSERT(using_columns.size() <= NumericLimits<uint32_t>::Maximum());
 	serializer.Write<uint32_t>((uint32_t)using_columns.size());
 	for (auto &using_column : using_columns) {
@@ -59,6 +62,7 @@ unique_ptr<TableRef> JoinRef::Deserialize(Deserializer &source) {
 	result->condition = source.ReadOptional<ParsedExpression>();
 	result->type = source.Read<JoinType>();
 	result->is_natural = source.Read<bool>();
+	result->is_asof = source.Read<bool>();
 	auto count = source.Read<uint32_t>();
 	for (idx_t i = 0; i < count; i++) {
 		result->using_columns.push_back(source.Read<string>());
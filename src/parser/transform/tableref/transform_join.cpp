@@ -38,6 +38,7 @@ unique_ptr<TableRef> Transformer::TransformJoin(duckdb_libpgquery::PGJoinExpr *r
 	result->left = TransformTableRefNode(root->larg);
 	result->right = TransformTableRefNode(root->rarg);
 	result->is_natural = root->isNatural;
+	result->is_asof = root->isAsof;
 	result->query_location = root->location;
 
 	if (root->usingClause && root->usingClause->length > 0) {
@@ -1,4 +1,6 @@
 #include "duckdb/parser/statement/set_statement.hpp"
+#include "duckdb/parser/statement/pragma_statement.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/operator/logical_set.hpp"
 #include <algorithm>
@@ -6,6 +8,16 @@
 namespace duckdb {
 
 BoundStatement Binder::Bind(SetStatement &stmt) {
+	if (StringUtil::Lower(stmt.name) == "query_priority") {
+		// the query priority is a setting of the client: "SET query_priority=value" is "PRAGMA query_priority=value"
+		PragmaStatement pragma;
+		pragma.stmt_location = stmt.stmt_location;
+		pragma.stmt_length = stmt.stmt_length;
+		pragma.info->name = stmt.name;
+		pragma.info->parameters.push_back(stmt.value);
+		return Bind(pragma);
+	}
+
 	BoundStatement result;
 	result.types = {LogicalType::BOOLEAN};
 	result.names = {"Success"};
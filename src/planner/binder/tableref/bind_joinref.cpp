@@ -20,11 +20,12 @@ static unique_ptr<ParsedExpression> BindColumn(Binder &binder, ClientContext &co
 
 static unique_ptr<ParsedExpression> AddCondition(ClientContext &context, Binder &left_binder, Binder &right_binder,
                                                  const string &left_alias, const string &right_alias,
-                                                 const string &column_name) {
+                                                 const string &column_name,
+                                                 ExpressionType type = ExpressionType::COMPARE_EQUAL) {
 	ExpressionBinder expr_binder(left_binder, context);
 	auto left = BindColumn(left_binder, context, left_alias, column_name);
 	auto right = BindColumn(right_binder, context, right_alias, column_name);
-	return make_unique<ComparisonExpression>(ExpressionType::COMPARE_EQUAL, move(left), move(right));
+	return make_unique<ComparisonExpression>(type, move(left), move(right));
 }
 
 bool Binder::TryFindBinding(const string &using_column, const string &join_side, string &result) {
@@ -98,6 +99,7 @@ unique_ptr<BoundTableRef> Binder::Bind(JoinRef &ref) {
 	auto &right_binder = *result->right_binder;
 
 	result->type = ref.type;
+	result->is_asof = ref.is_asof;
 	result->left = left_binder.Bind(*ref.left);
 	result->right = right_binder.Bind(*ref.right);
 
@@ -204,8 +206,12 @@ unique_ptr<BoundTableRef> Binder::Bind(JoinRef &ref) {
 			} else {
 				right_binding = right_using_binding->primary_binding;
 			}
-			extra_conditions.push_back(
-			    AddCondition(context, left_binder, right_binder, left_binding, right_binding, using_column));
+			// the last USING column of an ASOF JOIN is the inequality: the closest row of the RHS that is not later
+			auto comparison = ref.is_asof && i + 1 == ref.using_columns.size()
+			                      ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+			                      : ExpressionType::COMPARE_EQUAL;
+			extra_conditions.push_back(AddCondition(context, left_binder, right_binder, left_binding, right_binding,
+			                                        using_column, comparison));
 
 			UsingColumnSet set;
 			AddUsingBindings(set, left_using_binding, left_binding);
@@ -149,9 +149,85 @@ static bool HasCorrelatedColumns(Expression &expression) {
 	return has_correlated_columns;
 }
 
+static void PushFilter(unique_ptr<LogicalOperator> &child, unique_ptr<Expression> expr) {
+	if (child->type != LogicalOperatorType::LOGICAL_FILTER) {
+		// not a filter yet, push a new empty filter
+		auto filter = make_unique<LogicalFilter>();
+		filter->AddChild(move(child));
+		child = move(filter);
+	}
+	// push the expression into the filter
+	auto &filter = (LogicalFilter &)*child;
+	filter.expressions.push_back(move(expr));
+}
+
+//! Creates the join of an ASOF JOIN. Its condition consists of equality comparisons and a single inequality, which
+//! becomes the last join condition; every row of the LHS is matched with the closest row of the RHS on the inequality.
+static unique_ptr<LogicalOperator> CreateAsOfJoin(BoundJoinRef &ref, unique_ptr<LogicalOperator> left,
+                                                  unique_ptr<LogicalOperator> right) {
+	if (ref.type != JoinType::INNER && ref.type != JoinType::LEFT) {
+		throw BinderException("ASOF JOIN only supports INNER and LEFT joins");
+	}
+	if (ref.condition->HasSubquery() || HasCorrelatedColumns(*ref.condition)) {
+		throw BinderException("ASOF JOIN condition cannot contain subqueries");
+	}
+	vector<unique_ptr<Expression>> expressions;
+	expressions.push_back(move(ref.condition));
+	LogicalFilter::SplitPredicates(expressions);
+
+	unordered_set<idx_t> left_bindings, right_bindings;
+	LogicalJoin::GetTableReferences(*left, left_bindings);
+	LogicalJoin::GetTableReferences(*right, right_bindings);
+
+	vector<JoinCondition> conditions;
+	vector<JoinCondition> inequalities;
+	for (auto &expr : expressions) {
+		auto total_side = JoinSide::GetJoinSide(*expr, left_bindings, right_bindings);
+		if (total_side == JoinSide::NONE || total_side == JoinSide::RIGHT) {
+			// the expression restricts the rows of the RHS that can be matched: push it into the RHS
+			PushFilter(right, move(expr));
+			continue;
+		}
+		if (total_side == JoinSide::LEFT && ref.type == JoinType::INNER) {
+			// rows of the LHS that do not pass the expression are not part of the result
+			PushFilter(left, move(expr));
+			continue;
+		}
+		vector<JoinCondition> expr_conditions;
+		if (total_side == JoinSide::BOTH && expr->type >= ExpressionType::COMPARE_EQUAL &&
+		    expr->type <= ExpressionType::COMPARE_GREATERTHANOREQUALTO &&
+		    CreateJoinCondition(*expr, left_bindings, right_bindings, expr_conditions)) {
+			auto &condition = expr_conditions[0];
+			if (condition.comparison == ExpressionType::COMPARE_EQUAL) {
+				conditions.push_back(move(condition));
+				continue;
+			}
+			if (condition.comparison != ExpressionType::COMPARE_NOTEQUAL) {
+				inequalities.push_back(move(condition));
+				continue;
+			}
+		}
+		throw BinderException("ASOF JOIN condition can only consist of equality comparisons and a single inequality "
+		                      "between the two sides of the join");
+	}
+	if (inequalities.size() != 1) {
+		throw BinderException("ASOF JOIN requires exactly one inequality condition");
+	}
+	conditions.push_back(move(inequalities[0]));
+
+	auto asof_join = make_unique<LogicalComparisonJoin>(ref.type, LogicalOperatorType::LOGICAL_ASOF_JOIN);
+	asof_join->conditions = move(conditions);
+	asof_join->children.push_back(move(left));
+	asof_join->children.push_back(move(right));
+	return move(asof_join);
+}
+
 unique_ptr<LogicalOperator> Binder::CreatePlan(BoundJoinRef &ref) {
 	auto left = CreatePlan(*ref.left);
 	auto right = CreatePlan(*ref.right);
+	if (ref.is_asof) {
+		return CreateAsOfJoin(ref, move(left), move(right));
+	}
 	if (ref.type == JoinType::RIGHT && context.enable_optimizer) {
 		// we turn any right outer joins into left outer joins for optimization purposes
 		// they are the same but with sides flipped, so treating them the same simplifies life
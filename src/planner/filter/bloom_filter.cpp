@@ -0,0 +1,69 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+namespace duckdb {
+
+BloomFilterData::BloomFilterData(idx_t count) {
+	// at least 16 bits per hash
+	idx_t word_count = NextPowerOfTwo(MaxValue<idx_t>(count / 4, 1));
+	words = unique_ptr<uint64_t[]>(new uint64_t[word_count]);
+	memset(words.get(), 0, word_count * sizeof(uint64_t));
+	word_mask = word_count - 1;
+}
+
+void BloomFilterData::Insert(hash_t hashes[], idx_t count, bool parallel) {
+	if (parallel) {
+		auto atomic_words = (atomic<uint64_t> *)words.get();
+		for (idx_t i = 0; i < count; i++) {
+			atomic_words[GetWord(hashes[i])].fetch_or(GetPattern(hashes[i]));
+		}
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		words[GetWord(hashes[i])] |= GetPattern(hashes[i]);
+	}
+}
+
+BloomFilter::BloomFilter(shared_ptr<BloomFilterData> data_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), data(move(data_p)) {
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) {
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) {
+	return column_name + " IN BLOOM FILTER";
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() {
+	return make_unique<BloomFilter>(data);
+}
+
+void BloomFilter::Select(Vector &vector, SelectionVector &sel, idx_t &approved_tuple_count,
+                         ValidityMask &mask) const {
+	if (approved_tuple_count == 0) {
+		return;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+	// the hashes are written at the positions of the selected rows (or once for a constant vector)
+	auto hash_data = (hash_t *)hashes.GetData();
+	bool constant = hashes.GetVectorType() == VectorType::CONSTANT_VECTOR;
+
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (mask.RowIsValid(idx) && data->Lookup(hash_data[constant ? 0 : idx])) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+}
+
+} // namespace duckdb
@@ -30,6 +30,14 @@ string ConjunctionOrFilter::ToString(const string &column_name) {
 	return result;
 }
 
+unique_ptr<TableFilter> ConjunctionOrFilter::Copy() {
+	auto result = make_unique<ConjunctionOrFilter>();
+	for (auto &filter : child_filters) {
+		result->child_filters.push_back(filter->Copy());
+	}
+	return move(result);
+}
+
 ConjunctionAndFilter::ConjunctionAndFilter() : TableFilter(TableFilterType::CONJUNCTION_AND) {
 }
 
@@ -59,4 +67,12 @@ string ConjunctionAndFilter::ToString(const string &column_name) {
 	return result;
 }
 
+unique_ptr<TableFilter> ConjunctionAndFilter::Copy() {
+	auto result = make_unique<ConjunctionAndFilter>();
+	for (auto &filter : child_filters) {
+		result->child_filters.push_back(filter->Copy());
+	}
+	return move(result);
+}
+
 } // namespace duckdb
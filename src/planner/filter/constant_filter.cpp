@@ -35,4 +35,8 @@ string ConstantFilter::ToString(const string &column_name) {
 	return column_name + ExpressionTypeToOperator(comparison_type) + constant.ToString();
 }
 
+unique_ptr<TableFilter> ConstantFilter::Copy() {
+	return make_unique<ConstantFilter>(comparison_type, constant);
+}
+
 } // namespace duckdb
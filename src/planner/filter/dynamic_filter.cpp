@@ -0,0 +1,94 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+DynamicFilterData::DynamicFilterData(ExpressionType comparison_type, bool null_passes)
+    : comparison_type(comparison_type), null_passes(null_passes) {
+}
+
+void DynamicFilterData::SetConstant(Value constant_p) {
+	lock_guard<mutex> guard(lock);
+	constant = move(constant_p);
+}
+
+Value DynamicFilterData::GetConstant() {
+	lock_guard<mutex> guard(lock);
+	return constant;
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), data(move(data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	auto constant = data->GetConstant();
+	if (constant.is_null || (data->null_passes && stats.CanHaveNull())) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	ConstantFilter filter(data->comparison_type, move(constant));
+	return filter.CheckStatistics(stats);
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	auto constant = data->GetConstant();
+	if (constant.is_null) {
+		return column_name + " DYNAMIC FILTER";
+	}
+	return column_name + ExpressionTypeToOperator(data->comparison_type) + constant.ToString();
+}
+
+unique_ptr<TableFilter> DynamicFilter::Copy() {
+	return make_unique<DynamicFilter>(data);
+}
+
+static idx_t SelectComparison(ExpressionType comparison_type, Vector &left, Vector &right, const SelectionVector *sel,
+                              idx_t count, SelectionVector *true_sel, SelectionVector *false_sel) {
+	switch (comparison_type) {
+	case ExpressionType::COMPARE_EQUAL:
+		return VectorOperations::Equals(left, right, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_NOTEQUAL:
+		return VectorOperations::NotEquals(left, right, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_LESSTHAN:
+		return VectorOperations::LessThan(left, right, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return VectorOperations::GreaterThan(left, right, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return VectorOperations::LessThanEquals(left, right, sel, count, true_sel, false_sel);
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return VectorOperations::GreaterThanEquals(left, right, sel, count, true_sel, false_sel);
+	default:
+		throw InternalException("Unsupported comparison type for dynamic filter");
+	}
+}
+
+void DynamicFilter::Select(Vector &vector, SelectionVector &sel, idx_t &approved_tuple_count,
+                           ValidityMask &mask) const {
+	if (approved_tuple_count == 0) {
+		return;
+	}
+	auto constant = data->GetConstant();
+	if (constant.is_null) {
+		return;
+	}
+	Vector constant_vector(constant);
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count;
+	if (data->null_passes) {
+		// the rows that fail the negated comparison pass, which includes the NULL values
+		result_count = approved_tuple_count - SelectComparison(NegateComparisionExpression(data->comparison_type),
+		                                                       vector, constant_vector, &sel, approved_tuple_count,
+		                                                       nullptr, &result_sel);
+	} else {
+		result_count = SelectComparison(data->comparison_type, vector, constant_vector, &sel, approved_tuple_count,
+		                                &result_sel, nullptr);
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+}
+
+} // namespace duckdb
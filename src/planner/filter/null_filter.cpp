@@ -18,6 +18,10 @@ string IsNullFilter::ToString(const string &column_name) {
 	return column_name + "IS NULL";
 }
 
+unique_ptr<TableFilter> IsNullFilter::Copy() {
+	return make_unique<IsNullFilter>();
+}
+
 IsNotNullFilter::IsNotNullFilter() : TableFilter(TableFilterType::IS_NOT_NULL) {
 }
 
@@ -33,4 +37,8 @@ string IsNotNullFilter::ToString(const string &column_name) {
 	return column_name + " IS NOT NULL";
 }
 
+unique_ptr<TableFilter> IsNotNullFilter::Copy() {
+	return make_unique<IsNotNullFilter>();
+}
+
 } // namespace duckdb
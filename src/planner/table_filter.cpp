@@ -22,4 +22,12 @@ void TableFilterSet::PushFilter(idx_t column_index, unique_ptr<TableFilter> filt
 	}
 }
 
+unique_ptr<TableFilterSet> TableFilterSet::Copy() {
+	auto result = make_unique<TableFilterSet>();
+	for (auto &entry : filters) {
+		result->filters[entry.first] = entry.second->Copy();
+	}
+	return result;
+}
+
 } // namespace duckdb
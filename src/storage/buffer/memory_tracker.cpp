@@ -0,0 +1,99 @@
+#include "duckdb/storage/buffer/memory_tracker.hpp"
+
+#include "duckdb/common/assert.hpp"
+#include "duckdb/storage/buffer/eviction_queue.hpp"
+
+namespace duckdb {
+
+//! The memory tracker that is active in the current thread
+static thread_local MemoryTracker *active_tracker = nullptr;
+
+MemoryTracker::MemoryTracker(shared_ptr<MemoryTracker> parent_p)
+    : parent(move(parent_p)), limit(INVALID_INDEX), memory_usage(0), peak_memory_usage(0), bytes_spilled(0),
+      bytes_read(0), eviction_queue(make_unique<EvictionQueue>()) {
+}
+
+MemoryTracker::~MemoryTracker() {
+}
+
+void MemoryTracker::Allocate(idx_t size) {
+	idx_t new_usage = memory_usage += size;
+	idx_t peak = peak_memory_usage;
+	while (new_usage > peak && !peak_memory_usage.compare_exchange_weak(peak, new_usage)) {
+	}
+	if (parent) {
+		parent->Allocate(size);
+	}
+}
+
+void MemoryTracker::Free(idx_t size) {
+	D_ASSERT(memory_usage >= size);
+	memory_usage -= size;
+	if (parent) {
+		parent->Free(size);
+	}
+}
+
+void MemoryTracker::AddBytesSpilled(idx_t size) {
+	bytes_spilled += size;
+	if (parent) {
+		parent->AddBytesSpilled(size);
+	}
+}
+
+void MemoryTracker::AddBytesRead(idx_t size) {
+	bytes_read += size;
+	if (parent) {
+		parent->AddBytesRead(size);
+	}
+}
+
+void MemoryTracker::ResetStatistics() {
+	peak_memory_usage = memory_usage.load();
+	bytes_spilled = 0;
+	bytes_read = 0;
+}
+
+void MemoryTracker::SetLimit(idx_t new_limit) {
+	limit = new_limit;
+	if (new_limit == INVALID_INDEX) {
+		// without a limit nothing is evicted from the queue of this tracker: release the nodes that are in it
+		unique_ptr<BufferEvictionNode> node;
+		while (eviction_queue->q.try_dequeue(node) || eviction_queue->frequent_q.try_dequeue(node)) {
+		}
+	}
+}
+
+MemoryTracker *MemoryTracker::GetExceededTracker(idx_t extra_memory) {
+	for (auto tracker = this; tracker; tracker = tracker->parent.get()) {
+		idx_t tracker_limit = tracker->limit;
+		if (tracker_limit != INVALID_INDEX && tracker->memory_usage + extra_memory > tracker_limit) {
+			return tracker;
+		}
+	}
+	return nullptr;
+}
+
+bool MemoryTracker::IsAccountedTo(const MemoryTracker &tracker) const {
+	for (auto current = this; current; current = current->parent.get()) {
+		if (current == &tracker) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MemoryTracker *MemoryTracker::GetActiveTracker() {
+	return active_tracker;
+}
+
+MemoryTrackerScope::MemoryTrackerScope(shared_ptr<MemoryTracker> tracker_p)
+    : tracker(move(tracker_p)), previous(active_tracker) {
+	active_tracker = tracker.get();
+}
+
+MemoryTrackerScope::~MemoryTrackerScope() {
+	active_tracker = previous;
+}
+
+} // namespace duckdb
@@ -1,14 +1,24 @@
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/buffer/eviction_queue.hpp"
 
 #include "duckdb/common/exception.hpp"
-#include "duckdb/parallel/concurrentqueue.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/numa.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/main/config.hpp"
+
+#ifndef DUCKDB_NO_THREADS
+#include "duckdb/common/thread.hpp"
+#include <condition_variable>
+#endif
 
 namespace duckdb {
 
 BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p)
-    : db(db), readers(0), block_id(block_id_p), buffer(nullptr), eviction_timestamp(0), can_destroy(false) {
+    : db(db), readers(0), block_id(block_id_p), buffer(nullptr), eviction_timestamp(0), references(0),
+      can_destroy(false) {
 	eviction_timestamp = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = Storage::BLOCK_ALLOC_SIZE;
@@ -16,7 +26,7 @@ BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p)
 
 BlockHandle::BlockHandle(DatabaseInstance &db, block_id_t block_id_p, unique_ptr<FileBuffer> buffer_p,
                          bool can_destroy_p, idx_t alloc_size)
-    : db(db), readers(0), block_id(block_id_p), eviction_timestamp(0), can_destroy(can_destroy_p) {
+    : db(db), readers(0), block_id(block_id_p), eviction_timestamp(0), references(0), can_destroy(can_destroy_p) {
 	D_ASSERT(alloc_size >= Storage::BLOCK_SIZE);
 	buffer = move(buffer_p);
 	state = BlockState::BLOCK_LOADED;
@@ -30,6 +40,7 @@ BlockHandle::~BlockHandle() {
 		// the block is still loaded in memory: erase it
 		buffer.reset();
 		buffer_manager.current_memory -= memory_usage;
+		tracker->Free(memory_usage);
 	}
 	buffer_manager.UnregisterBlock(block_id, can_destroy);
 }
@@ -44,8 +55,13 @@ unique_ptr<BufferHandle> BlockHandle::Load(shared_ptr<BlockHandle> &handle) {
 
 	auto &buffer_manager = BufferManager::GetBufferManager(handle->db);
 	auto &block_manager = BlockManager::GetBlockManager(handle->db);
+	if (handle->block_id < MAXIMUM_BLOCK) {
+		handle->tracker = buffer_manager.GetActiveMemoryTracker();
+	}
+	handle->tracker->Allocate(handle->memory_usage);
 	if (handle->block_id < MAXIMUM_BLOCK) {
 		auto block = make_unique<Block>(Allocator::Get(handle->db), handle->block_id);
+		buffer_manager.PlaceBuffer(*block);
 		block_manager.Read(*block);
 		handle->buffer = move(block);
 	} else {
@@ -53,6 +69,7 @@ unique_ptr<BufferHandle> BlockHandle::Load(shared_ptr<BlockHandle> &handle) {
 			return nullptr;
 		} else {
 			handle->buffer = buffer_manager.ReadTemporaryBuffer(handle->block_id);
+			handle->tracker->AddBytesRead(handle->memory_usage);
 		}
 	}
 	return make_unique<BufferHandle>(handle, handle->buffer.get());
@@ -66,14 +83,20 @@ void BlockHandle::Unload() {
 	D_ASSERT(CanUnload());
 	D_ASSERT(memory_usage >= Storage::BLOCK_SIZE);
 	state = BlockState::BLOCK_UNLOADED;
+	references = 0;
 
 	auto &buffer_manager = BufferManager::GetBufferManager(db);
 	if (block_id >= MAXIMUM_BLOCK && !can_destroy) {
 		// temporary block that cannot be destroyed: write to temporary file
 		buffer_manager.WriteTemporaryBuffer((ManagedBuffer &)*buffer);
+		tracker->AddBytesSpilled(memory_usage);
 	}
 	buffer.reset();
 	buffer_manager.current_memory -= memory_usage;
+	tracker->Free(memory_usage);
+	if (block_id < MAXIMUM_BLOCK) {
+		tracker.reset();
+	}
 }
 
 bool BlockHandle::CanUnload() {
@@ -95,28 +118,19 @@ bool BlockHandle::CanUnload() {
 	return true;
 }
 
-struct BufferEvictionNode {
-	BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t timestamp_p)
-	    : handle(move(handle_p)), timestamp(timestamp_p) {
-		D_ASSERT(!handle.expired());
-	}
-
-	weak_ptr<BlockHandle> handle;
-	idx_t timestamp;
-
-	bool CanUnload(BlockHandle &handle) {
-		if (timestamp != handle.eviction_timestamp) {
-			// handle was used in between
-			return false;
-		}
-		return handle.CanUnload();
-	}
-};
-
-typedef duckdb_moodycamel::ConcurrentQueue<unique_ptr<BufferEvictionNode>> eviction_queue_t;
-
-struct EvictionQueue {
-	eviction_queue_t q;
+struct PrefetchQueue {
+	//! The lock protecting the queue
+	mutex lock;
+	//! The blocks that are waiting to be prefetched
+	deque<weak_ptr<BlockHandle>> blocks;
+	//! Whether or not the buffer manager is shutting down
+	bool shutdown = false;
+#ifndef DUCKDB_NO_THREADS
+	//! Signals the I/O threads that blocks have been enqueued (or that we are shutting down)
+	std::condition_variable cv;
+	//! The I/O threads
+	vector<unique_ptr<thread>> threads;
+#endif
 };
 
 class TemporaryDirectoryHandle {
@@ -148,10 +162,23 @@ void BufferManager::SetTemporaryDirectory(string new_dir) {
 
 BufferManager::BufferManager(DatabaseInstance &db, string tmp, idx_t maximum_memory)
     : db(db), current_memory(0), maximum_memory(maximum_memory), temp_directory(move(tmp)),
-      queue(make_unique<EvictionQueue>()), temporary_id(MAXIMUM_BLOCK) {
+      queue(make_unique<EvictionQueue>()), prefetch_queue(make_unique<PrefetchQueue>()),
+      temporary_id(MAXIMUM_BLOCK), block_hits(0), block_misses(0), evictions(0),
+      memory_tracker(make_shared<MemoryTracker>()) {
 }
 
 BufferManager::~BufferManager() {
+#ifndef DUCKDB_NO_THREADS
+	// stop the I/O threads
+	{
+		lock_guard<mutex> guard(prefetch_queue->lock);
+		prefetch_queue->shutdown = true;
+	}
+	prefetch_queue->cv.notify_all();
+	for (auto &io_thread : prefetch_queue->threads) {
+		io_thread->join();
+	}
+#endif
 }
 
 shared_ptr<BlockHandle> BufferManager::RegisterBlock(block_id_t block_id) {
@@ -174,7 +201,9 @@ shared_ptr<BlockHandle> BufferManager::RegisterBlock(block_id_t block_id) {
 }
 
 shared_ptr<BlockHandle> BufferManager::RegisterMemory(idx_t alloc_size, bool can_destroy) {
+	auto tracker = GetActiveMemoryTracker();
 	// first evict blocks until we have enough memory to store this buffer
+	EnforceMemoryLimits(*tracker, alloc_size);
 	if (!EvictBlocks(alloc_size, maximum_memory)) {
 		throw OutOfRangeException("Not enough memory to complete operation: could not allocate block of %lld bytes",
 		                          alloc_size);
@@ -183,9 +212,31 @@ shared_ptr<BlockHandle> BufferManager::RegisterMemory(idx_t alloc_size, bool can
 	// allocate the buffer
 	auto temp_id = ++temporary_id;
 	auto buffer = make_unique<ManagedBuffer>(db, alloc_size, can_destroy, temp_id);
+	PlaceBuffer(*buffer);
 
 	// create a new block pointer for this block
-	return make_shared<BlockHandle>(db, temp_id, move(buffer), can_destroy, alloc_size);
+	auto result = make_shared<BlockHandle>(db, temp_id, move(buffer), can_destroy, alloc_size);
+	result->tracker = move(tracker);
+	result->tracker->Allocate(alloc_size);
+	return result;
+}
+
+shared_ptr<MemoryTracker> BufferManager::GetActiveMemoryTracker() {
+	auto active_tracker = MemoryTracker::GetActiveTracker();
+	if (!active_tracker) {
+		// allocations outside of any query (e.g. by the prefetch threads) are accounted to the database
+		return memory_tracker;
+	}
+	return active_tracker->shared_from_this();
+}
+
+void BufferManager::PlaceBuffer(FileBuffer &buffer) {
+	if (!DBConfig::GetConfig(db).numa_mode) {
+		return;
+	}
+	// place the pages of the buffer on the node of the thread that is about to fill them
+	auto &topology = NumaTopology::Get();
+	NumaTopology::PlaceMemory(buffer.buffer, buffer.size, topology.GetCurrentNode());
 }
 
 unique_ptr<BufferHandle> BufferManager::Allocate(idx_t alloc_size) {
@@ -194,6 +245,27 @@ unique_ptr<BufferHandle> BufferManager::Allocate(idx_t alloc_size) {
 }
 
 unique_ptr<BufferHandle> BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
+	return PinInternal(handle, false);
+}
+
+void BufferManager::AddReference(BlockHandle &handle, bool loaded, bool prefetch) {
+	if (prefetch) {
+		// prefetching is not a use of the block
+		return;
+	}
+	if (handle.readers == 0) {
+		handle.references++;
+	}
+	if (handle.block_id < MAXIMUM_BLOCK) {
+		if (loaded) {
+			block_misses++;
+		} else {
+			block_hits++;
+		}
+	}
+}
+
+unique_ptr<BufferHandle> BufferManager::PinInternal(shared_ptr<BlockHandle> &handle, bool prefetch) {
 	idx_t required_memory;
 	{
 		// lock the block
@@ -201,12 +273,16 @@ unique_ptr<BufferHandle> BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		// check if the block is already loaded
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
+			AddReference(*handle, false, prefetch);
 			handle->readers++;
 			return handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
 	}
 	// evict blocks until we have space for the current block
+	// temporary blocks are accounted to the tracker that registered them, blocks of the base file to the loader
+	auto tracker = handle->block_id < MAXIMUM_BLOCK ? GetActiveMemoryTracker() : handle->tracker;
+	EnforceMemoryLimits(*tracker, required_memory);
 	if (!EvictBlocks(required_memory, maximum_memory)) {
 		throw OutOfRangeException("Not enough memory to complete operation: failed to pin block");
 	}
@@ -215,11 +291,15 @@ unique_ptr<BufferHandle> BufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 	// check if the block is already loaded
 	if (handle->state == BlockState::BLOCK_LOADED) {
 		// the block is loaded, increment the reader count and return a pointer to the handle
+		// the memory reserved by EvictBlocks is not needed anymore
+		current_memory -= required_memory;
+		AddReference(*handle, false, prefetch);
 		handle->readers++;
 		return handle->Load(handle);
 	}
 	// now we can actually load the current block
 	D_ASSERT(handle->readers == 0);
+	AddReference(*handle, true, prefetch);
 	handle->readers = 1;
 	return handle->Load(handle);
 }
@@ -230,17 +310,110 @@ void BufferManager::Unpin(shared_ptr<BlockHandle> &handle) {
 	handle->readers--;
 	if (handle->readers == 0) {
 		handle->eviction_timestamp++;
-		queue->q.enqueue(make_unique<BufferEvictionNode>(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp));
+		// the block is added to the global queue, and to the queues of the trackers with a limit it is accounted to,
+		// so that a tracker that exceeds its limit can find its own blocks without going through the blocks of
+		// everybody else. Trackers without a limit never evict, so their queues would only grow.
+		Enqueue(*queue, handle);
+		for (auto tracker = handle->tracker.get(); tracker; tracker = tracker->GetParent()) {
+			if (tracker != memory_tracker.get() && tracker->GetLimit() != INVALID_INDEX) {
+				Enqueue(tracker->GetEvictionQueue(), handle);
+			}
+		}
 		// FIXME: do some house-keeping to prevent the queue from being flooded with many old blocks
 	}
 }
 
+void BufferManager::Enqueue(EvictionQueue &target, shared_ptr<BlockHandle> &handle) {
+	auto node = make_unique<BufferEvictionNode>(weak_ptr<BlockHandle>(handle), handle->eviction_timestamp);
+	if (DBConfig::GetConfig(db).eviction_policy == EvictionPolicy::TWO_QUEUE && handle->references > 1) {
+		// the block was pinned repeatedly: only evict it once the blocks that were pinned once are gone
+		target.frequent_q.enqueue(move(node));
+	} else {
+		target.q.enqueue(move(node));
+	}
+}
+
+void BufferManager::Prefetch(const vector<shared_ptr<BlockHandle>> &handles) {
+#ifndef DUCKDB_NO_THREADS
+	idx_t prefetch_threads = DBConfig::GetConfig(db).prefetch_threads;
+	if (prefetch_threads == 0) {
+		return;
+	}
+	lock_guard<mutex> guard(prefetch_queue->lock);
+	if (prefetch_queue->shutdown) {
+		return;
+	}
+	unordered_set<BlockHandle *> enqueued_blocks;
+	for (auto &handle : handles) {
+		if (!handle || handle->BlockId() >= MAXIMUM_BLOCK) {
+			// only blocks that are stored in the database file are prefetched
+			continue;
+		}
+		if (prefetch_queue->blocks.size() >= MAXIMUM_PREFETCH_QUEUE_SIZE) {
+			// the I/O threads cannot keep up: skip the remaining blocks
+			break;
+		}
+		if (!enqueued_blocks.insert(handle.get()).second) {
+			// the block is shared by multiple (compressed) segments: only prefetch it once
+			continue;
+		}
+		prefetch_queue->blocks.push_back(weak_ptr<BlockHandle>(handle));
+	}
+	if (enqueued_blocks.empty()) {
+		return;
+	}
+	// launch the I/O threads, if they have not been launched yet
+	while (prefetch_queue->threads.size() < prefetch_threads) {
+		prefetch_queue->threads.push_back(make_unique<thread>(&BufferManager::PrefetchBlocks, this));
+	}
+	prefetch_queue->cv.notify_all();
+#endif
+}
+
+void BufferManager::PrefetchBlocks() {
+#ifndef DUCKDB_NO_THREADS
+	while (true) {
+		shared_ptr<BlockHandle> handle;
+		{
+			unique_lock<mutex> guard(prefetch_queue->lock);
+			prefetch_queue->cv.wait(guard,
+			                        [&]() { return prefetch_queue->shutdown || !prefetch_queue->blocks.empty(); });
+			if (prefetch_queue->shutdown) {
+				return;
+			}
+			handle = prefetch_queue->blocks.front().lock();
+			prefetch_queue->blocks.pop_front();
+		}
+		if (!handle) {
+			// the block was destroyed in the mean time
+			continue;
+		}
+		{
+			lock_guard<mutex> lock(handle->lock);
+			if (handle->state == BlockState::BLOCK_LOADED) {
+				// the block was already loaded
+				continue;
+			}
+		}
+		try {
+			// load the block by pinning it; when the pin is released the block is added to the eviction queue just
+			// like any other unpinned block
+			auto buffer = PinInternal(handle, true);
+		} catch (std::exception &ex) {
+			// prefetching is best-effort: if the block cannot be loaded (e.g. because we are out of memory) the error
+			// is reported when the block is pinned by the scan
+		}
+	}
+#endif
+}
+
 bool BufferManager::EvictBlocks(idx_t extra_memory, idx_t memory_limit) {
 	unique_ptr<BufferEvictionNode> node;
 	current_memory += extra_memory;
 	while (current_memory > memory_limit) {
 		// get a block to unpin from the queue
-		if (!queue->q.try_dequeue(node)) {
+		// blocks in the frequent queue (only used by the 2Q policy) are evicted after all other blocks
+		if (!queue->q.try_dequeue(node) && !queue->frequent_q.try_dequeue(node)) {
 			current_memory -= extra_memory;
 			return false;
 		}
@@ -262,10 +435,82 @@ bool BufferManager::EvictBlocks(idx_t extra_memory, idx_t memory_limit) {
 		// hooray, we can unload the block
 		// release the memory and mark the block as unloaded
 		handle->Unload();
+		evictions++;
 	}
 	return true;
 }
 
+bool BufferManager::EvictTrackerBlocks(MemoryTracker &tracker, idx_t extra_memory) {
+	// every tracker with a limit has its own queue containing the blocks accounted to it, except for the tracker of
+	// the database, which all blocks are accounted to
+	bool database_tracker = &tracker == memory_tracker.get();
+	auto &tracker_queue = database_tracker ? *queue : tracker.GetEvictionQueue();
+	while (tracker.GetMemoryUsage() + extra_memory > tracker.GetLimit()) {
+		unique_ptr<BufferEvictionNode> node;
+		if (!tracker_queue.q.try_dequeue(node) && !tracker_queue.frequent_q.try_dequeue(node)) {
+			// blocks that were unpinned before the limit was set are only in the global queue
+			return !database_tracker && EvictTrackerBlocksFromGlobalQueue(tracker, extra_memory);
+		}
+		auto handle = node->handle.lock();
+		if (!handle || !node->CanUnload(*handle)) {
+			continue;
+		}
+		lock_guard<mutex> lock(handle->lock);
+		if (!node->CanUnload(*handle) || !handle->tracker || !handle->tracker->IsAccountedTo(tracker)) {
+			continue;
+		}
+		// the node of this block in the global queue is now stale, and is skipped once it is dequeued
+		handle->Unload();
+		evictions++;
+	}
+	return true;
+}
+
+bool BufferManager::EvictTrackerBlocksFromGlobalQueue(MemoryTracker &tracker, idx_t extra_memory) {
+	// visit every node that is in the global queue right now (once), the nodes of the blocks of other trackers are put
+	// back; nodes of blocks that cannot be unloaded are dropped, as in EvictBlocks
+	idx_t node_count = queue->q.size_approx() + queue->frequent_q.size_approx();
+	for (idx_t i = 0; i < node_count && tracker.GetMemoryUsage() + extra_memory > tracker.GetLimit(); i++) {
+		unique_ptr<BufferEvictionNode> node;
+		auto source = &queue->q;
+		if (!source->try_dequeue(node)) {
+			source = &queue->frequent_q;
+			if (!source->try_dequeue(node)) {
+				break;
+			}
+		}
+		auto handle = node->handle.lock();
+		if (!handle || !node->CanUnload(*handle)) {
+			continue;
+		}
+		lock_guard<mutex> lock(handle->lock);
+		if (!node->CanUnload(*handle)) {
+			continue;
+		}
+		if (!handle->tracker || !handle->tracker->IsAccountedTo(tracker)) {
+			source->enqueue(move(node));
+			continue;
+		}
+		handle->Unload();
+		evictions++;
+	}
+	return tracker.GetMemoryUsage() + extra_memory <= tracker.GetLimit();
+}
+
+void BufferManager::EnforceMemoryLimits(MemoryTracker &tracker, idx_t extra_memory) {
+	while (true) {
+		auto exceeded_tracker = tracker.GetExceededTracker(extra_memory);
+		if (!exceeded_tracker) {
+			return;
+		}
+		if (!EvictTrackerBlocks(*exceeded_tracker, extra_memory)) {
+			throw OutOfRangeException("Not enough memory to complete operation: could not allocate block of %lld bytes "
+			                          "within the query or connection memory limit of %lld bytes",
+			                          extra_memory, exceeded_tracker->GetLimit());
+		}
+	}
+}
+
 void BufferManager::UnregisterBlock(block_id_t block_id, bool can_destroy) {
 	if (block_id >= MAXIMUM_BLOCK) {
 		// in-memory buffer: destroy the buffer
@@ -343,6 +588,7 @@ unique_ptr<FileBuffer> BufferManager::ReadTemporaryBuffer(block_id_t id) {
 
 	// now allocate a buffer of this size and read the data into that buffer
 	auto buffer = make_unique<ManagedBuffer>(db, alloc_size + Storage::BLOCK_HEADER_SIZE, false, id);
+	PlaceBuffer(*buffer);
 	buffer->Read(*handle, sizeof(idx_t));
 	return move(buffer);
 }
@@ -15,11 +15,12 @@
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/compression/compressed_segment.hpp"
 
 namespace duckdb {
 
 TableDataWriter::TableDataWriter(DatabaseInstance &db, TableCatalogEntry &table, MetaBlockWriter &meta_writer)
-    : db(db), table(table), meta_writer(meta_writer) {
+    : db(db), table(table), meta_writer(meta_writer), partial_block_id(INVALID_BLOCK), partial_block_offset(0) {
 }
 
 TableDataWriter::~TableDataWriter() {
@@ -27,7 +28,42 @@ TableDataWriter::~TableDataWriter() {
 
 BlockPointer TableDataWriter::WriteTableData() {
 	// start scanning the table and append the data to the uncompressed segments
-	return table.storage->Checkpoint(*this);
+	auto pointer = table.storage->Checkpoint(*this);
+	// write any remaining compressed segments to disk
+	FlushPartialBlock();
+	return pointer;
+}
+
+data_ptr_t TableDataWriter::AllocateCompressedSegment(idx_t size, block_id_t &block_id, uint32_t &offset_in_block) {
+	D_ASSERT(size <= Storage::BLOCK_SIZE);
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto &block_manager = BlockManager::GetBlockManager(db);
+	if (!partial_block || partial_block_offset + size > Storage::BLOCK_SIZE) {
+		// the segment does not fit in the current block: write it and start a new block
+		FlushPartialBlock();
+		partial_block = buffer_manager.Allocate(Storage::BLOCK_ALLOC_SIZE);
+		memset(partial_block->node->buffer, 0, Storage::BLOCK_SIZE);
+		partial_block_id = block_manager.GetFreeBlockId();
+		partial_block_offset = 0;
+	}
+	// every segment that is stored in the block holds a reference to it
+	block_manager.IncreaseBlockReferenceCount(partial_block_id);
+
+	block_id = partial_block_id;
+	offset_in_block = partial_block_offset;
+	partial_block_offset = CompressedSegment::AlignOffset(partial_block_offset + size);
+	return partial_block->node->buffer + offset_in_block;
+}
+
+void TableDataWriter::FlushPartialBlock() {
+	if (!partial_block) {
+		return;
+	}
+	auto &block_manager = BlockManager::GetBlockManager(db);
+	block_manager.Write(*partial_block->node, partial_block_id);
+	partial_block.reset();
+	partial_block_id = INVALID_BLOCK;
+	partial_block_offset = 0;
 }
 
 } // namespace duckdb
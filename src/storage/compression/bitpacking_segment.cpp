@@ -0,0 +1,186 @@
+#include "duckdb/storage/compression/bitpacking_segment.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+
+#include <type_traits>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Analyze & Compress
+//===--------------------------------------------------------------------===//
+//! Returns the bit width required to store the range [min, max] of the segment, or INVALID_INDEX if the range cannot
+//! be bitpacked (or bitpacking would not make the data smaller)
+template <class T>
+static idx_t BitpackingWidth(BaseStatistics &stats) {
+	typedef typename std::make_unsigned<T>::type UT;
+	auto &nstats = (NumericStatistics &)stats;
+	auto min = nstats.min.GetValueUnsafe<T>();
+	auto max = nstats.max.GetValueUnsafe<T>();
+	if (max < min) {
+		// no valid values
+		return 0;
+	}
+	auto width = BitpackingPrimitives::RequiredBitWidth(uint64_t(UT(UT(max) - UT(min))));
+	if (width > BitpackingPrimitives::MAXIMUM_BIT_WIDTH || width >= sizeof(T) * 8) {
+		return INVALID_INDEX;
+	}
+	return width;
+}
+
+template <class T>
+static idx_t BitpackingAnalyze(idx_t count, BaseStatistics &stats) {
+	auto width = BitpackingWidth<T>(stats);
+	if (width == INVALID_INDEX) {
+		return INVALID_INDEX;
+	}
+	return BitpackingSegment::HEADER_SIZE + BitpackingPrimitives::PackedSize(count, width);
+}
+
+template <class T>
+static void BitpackingCompress(data_ptr_t data, idx_t count, BaseStatistics &stats, data_ptr_t target) {
+	typedef typename std::make_unsigned<T>::type UT;
+	auto &nstats = (NumericStatistics &)stats;
+	auto min = nstats.min.GetValueUnsafe<T>();
+	auto max = nstats.max.GetValueUnsafe<T>();
+	auto width = BitpackingWidth<T>(stats);
+	D_ASSERT(width != INVALID_INDEX);
+
+	// write the header
+	memset(target, 0, BitpackingSegment::HEADER_SIZE);
+	Store<uint64_t>(width, target);
+	Store<T>(min, target + sizeof(uint64_t));
+
+	// pack the values
+	auto packed = target + BitpackingSegment::HEADER_SIZE;
+	memset(packed, 0, BitpackingPrimitives::PackedSize(count, width));
+	auto values = (T *)data;
+	for (idx_t i = 0; i < count; i++) {
+		if (CompressedSegment::IsNullValue<T>(values[i], min, max)) {
+			// NULL values are stored as the reference value
+			continue;
+		}
+		BitpackingPrimitives::PackValue(packed, i, width, uint64_t(UT(UT(values[i]) - UT(min))));
+	}
+}
+
+idx_t BitpackingSegment::AnalyzeSize(PhysicalType type, idx_t count, BaseStatistics &stats) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return BitpackingAnalyze<int8_t>(count, stats);
+	case PhysicalType::INT16:
+		return BitpackingAnalyze<int16_t>(count, stats);
+	case PhysicalType::INT32:
+		return BitpackingAnalyze<int32_t>(count, stats);
+	case PhysicalType::INT64:
+		return BitpackingAnalyze<int64_t>(count, stats);
+	case PhysicalType::UINT8:
+		return BitpackingAnalyze<uint8_t>(count, stats);
+	case PhysicalType::UINT16:
+		return BitpackingAnalyze<uint16_t>(count, stats);
+	case PhysicalType::UINT32:
+		return BitpackingAnalyze<uint32_t>(count, stats);
+	case PhysicalType::UINT64:
+		return BitpackingAnalyze<uint64_t>(count, stats);
+	default:
+		return INVALID_INDEX;
+	}
+}
+
+void BitpackingSegment::Compress(PhysicalType type, data_ptr_t data, idx_t count, BaseStatistics &stats,
+                                 data_ptr_t target) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		BitpackingCompress<int8_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT16:
+		BitpackingCompress<int16_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT32:
+		BitpackingCompress<int32_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT64:
+		BitpackingCompress<int64_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT8:
+		BitpackingCompress<uint8_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT16:
+		BitpackingCompress<uint16_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT32:
+		BitpackingCompress<uint32_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT64:
+		BitpackingCompress<uint64_t>(data, count, stats, target);
+		break;
+	default:
+		throw InternalException("Unsupported type for bitpacking");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+static void BitpackingUnpack(data_ptr_t base, idx_t start, idx_t count, Vector &result, idx_t result_offset) {
+	typedef typename std::make_unsigned<T>::type UT;
+	auto width = Load<uint64_t>(base);
+	auto reference = UT(Load<T>(base + sizeof(uint64_t)));
+	auto packed = base + BitpackingSegment::HEADER_SIZE;
+	auto result_data = FlatVector::GetData<T>(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto delta = UT(BitpackingPrimitives::UnpackValue(packed, start + i, width));
+		result_data[result_offset + i] = T(UT(reference + delta));
+	}
+}
+
+static BitpackingSegment::unpack_function_t GetUnpackFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return BitpackingUnpack<int8_t>;
+	case PhysicalType::INT16:
+		return BitpackingUnpack<int16_t>;
+	case PhysicalType::INT32:
+		return BitpackingUnpack<int32_t>;
+	case PhysicalType::INT64:
+		return BitpackingUnpack<int64_t>;
+	case PhysicalType::UINT8:
+		return BitpackingUnpack<uint8_t>;
+	case PhysicalType::UINT16:
+		return BitpackingUnpack<uint16_t>;
+	case PhysicalType::UINT32:
+		return BitpackingUnpack<uint32_t>;
+	case PhysicalType::UINT64:
+		return BitpackingUnpack<uint64_t>;
+	default:
+		throw InternalException("Unsupported type for bitpacking segment");
+	}
+}
+
+BitpackingSegment::BitpackingSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, block_id_t block_id,
+                                     idx_t offset)
+    : CompressedSegment(db, type, row_start, CompressionType::COMPRESSION_BITPACKING, block_id, offset) {
+	unpack_function = GetUnpackFunction(type);
+}
+
+void BitpackingSegment::Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                             idx_t result_offset) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	auto base = GetCompressedData(*state.primary_handle);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	unpack_function(base, start, scan_count, result, result_offset);
+}
+
+void BitpackingSegment::FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto handle = buffer_manager.Pin(block);
+	unpack_function(GetCompressedData(*handle), row_id, 1, result, result_idx);
+}
+
+} // namespace duckdb
@@ -0,0 +1,188 @@
+#include "duckdb/storage/compression/compressed_segment.hpp"
+#include "duckdb/storage/compression/constant_segment.hpp"
+#include "duckdb/storage/compression/rle_segment.hpp"
+#include "duckdb/storage/compression/bitpacking_segment.hpp"
+#include "duckdb/storage/compression/dictionary_segment.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+
+namespace duckdb {
+
+CompressedSegment::CompressedSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start,
+                                     CompressionType compression, block_id_t block_id, idx_t offset)
+    : UncompressedSegment(db, type, row_start), compression(compression), offset(offset) {
+	if (block_id != INVALID_BLOCK) {
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		this->block = buffer_manager.RegisterBlock(block_id);
+	}
+}
+
+void CompressedSegment::InitializeScan(ColumnScanState &state) {
+	if (!block) {
+		state.primary_handle.reset();
+		return;
+	}
+	// pin the block holding the compressed data
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	state.primary_handle = buffer_manager.Pin(block);
+}
+
+idx_t CompressedSegment::Append(SegmentStatistics &stats, VectorData &data, idx_t offset, idx_t count) {
+	throw InternalException("Cannot append to a compressed segment");
+}
+
+void CompressedSegment::RevertAppend(idx_t start_row) {
+	throw InternalException("Cannot revert an append to a compressed segment");
+}
+
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+bool CompressedSegment::CanFilterValues(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::BLOOM_FILTER:
+	case TableFilterType::DYNAMIC_FILTER:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = (const ConjunctionAndFilter &)filter;
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (!CanFilterValues(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		// NULL filters depend on the validity of the individual rows, not on the values
+		return false;
+	}
+}
+
+void CompressedSegment::FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool matches[]) {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	D_ASSERT(CanFilterValues(filter));
+	SelectionVector sel(FlatVector::INCREMENTAL_SELECTION_VECTOR);
+	idx_t approved_tuple_count = count;
+	UncompressedSegment::FilterSelection(sel, values, filter, approved_tuple_count, FlatVector::Validity(values));
+
+	memset(matches, 0, sizeof(bool) * count);
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		matches[sel.get_index(i)] = true;
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Segment Compression
+//===--------------------------------------------------------------------===//
+//! Scans the strings of an uncompressed string segment. The strings point into the pinned block of the segment, and
+//! remain valid as long as the scanner is alive.
+struct StringSegmentScanner {
+	StringSegmentScanner(UncompressedSegment &segment, idx_t count)
+	    : strings(unique_ptr<string_t[]>(new string_t[count])) {
+		D_ASSERT(segment.type == PhysicalType::VARCHAR);
+		segment.InitializeScan(state);
+		Vector scan_vector(LogicalType::VARCHAR);
+		for (idx_t i = 0; i < count; i += STANDARD_VECTOR_SIZE) {
+			auto scan_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - i);
+			segment.Scan(state, i, scan_count, scan_vector, 0);
+			memcpy(strings.get() + i, FlatVector::GetData<string_t>(scan_vector), scan_count * sizeof(string_t));
+		}
+	}
+
+	ColumnScanState state;
+	unique_ptr<string_t[]> strings;
+};
+
+CompressionType SegmentCompression::Analyze(UncompressedSegment &segment, BaseStatistics &stats,
+                                            idx_t &compressed_size) {
+	// an uncompressed segment always occupies a full block
+	compressed_size = Storage::BLOCK_SIZE;
+	auto result = CompressionType::COMPRESSION_UNCOMPRESSED;
+	auto count = segment.tuple_count.load();
+	if (ConstantSegment::CanCompress(segment.type, stats)) {
+		// constant segments are stored entirely in the statistics
+		compressed_size = 0;
+		return CompressionType::COMPRESSION_CONSTANT;
+	}
+	switch (segment.type) {
+	case PhysicalType::BIT:
+		break;
+	case PhysicalType::VARCHAR: {
+		if (!DictionarySegment::CanCompress(stats)) {
+			break;
+		}
+		StringSegmentScanner scanner(segment, count);
+		auto dictionary_size = DictionarySegment::AnalyzeSize(scanner.strings.get(), count);
+		if (dictionary_size < compressed_size) {
+			compressed_size = dictionary_size;
+			result = CompressionType::COMPRESSION_DICTIONARY;
+		}
+		break;
+	}
+	default: {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		auto handle = buffer_manager.Pin(segment.block);
+		auto rle_size = RLESegment::AnalyzeSize(segment.type, handle->node->buffer, count, stats);
+		if (rle_size < compressed_size) {
+			compressed_size = rle_size;
+			result = CompressionType::COMPRESSION_RLE;
+		}
+		auto bitpacking_size = BitpackingSegment::AnalyzeSize(segment.type, count, stats);
+		if (bitpacking_size < compressed_size) {
+			compressed_size = bitpacking_size;
+			result = CompressionType::COMPRESSION_BITPACKING;
+		}
+		break;
+	}
+	}
+	return result;
+}
+
+void SegmentCompression::Compress(CompressionType compression, UncompressedSegment &segment, BaseStatistics &stats,
+                                  data_ptr_t target) {
+	auto count = segment.tuple_count.load();
+	switch (compression) {
+	case CompressionType::COMPRESSION_DICTIONARY: {
+		StringSegmentScanner scanner(segment, count);
+		DictionarySegment::Compress(scanner.strings.get(), count, target);
+		break;
+	}
+	case CompressionType::COMPRESSION_RLE:
+	case CompressionType::COMPRESSION_BITPACKING: {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		auto handle = buffer_manager.Pin(segment.block);
+		if (compression == CompressionType::COMPRESSION_RLE) {
+			RLESegment::Compress(segment.type, handle->node->buffer, count, stats, target);
+		} else {
+			BitpackingSegment::Compress(segment.type, handle->node->buffer, count, stats, target);
+		}
+		break;
+	}
+	default:
+		throw InternalException("Unsupported compression type for SegmentCompression::Compress");
+	}
+}
+
+unique_ptr<UncompressedSegment> SegmentCompression::CreateSegment(DatabaseInstance &db, CompressionType compression,
+                                                                  PhysicalType type, idx_t row_start,
+                                                                  block_id_t block_id, idx_t offset,
+                                                                  BaseStatistics &stats) {
+	switch (compression) {
+	case CompressionType::COMPRESSION_CONSTANT:
+		return make_unique<ConstantSegment>(db, type, row_start, stats);
+	case CompressionType::COMPRESSION_RLE:
+		return make_unique<RLESegment>(db, type, row_start, block_id, offset);
+	case CompressionType::COMPRESSION_BITPACKING:
+		return make_unique<BitpackingSegment>(db, type, row_start, block_id, offset);
+	case CompressionType::COMPRESSION_DICTIONARY:
+		return make_unique<DictionarySegment>(db, row_start, block_id, offset);
+	default:
+		throw InternalException("Unsupported compression type for a persistent segment");
+	}
+}
+
+} // namespace duckdb
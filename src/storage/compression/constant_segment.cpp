@@ -0,0 +1,168 @@
+#include "duckdb/storage/compression/constant_segment.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+#include "duckdb/storage/statistics/validity_statistics.hpp"
+
+namespace duckdb {
+
+template <class T>
+static void FillConstant(data_ptr_t constant, Vector &result, idx_t result_offset, idx_t count) {
+	auto value = Load<T>(constant);
+	auto result_data = FlatVector::GetData<T>(result);
+	for (idx_t i = 0; i < count; i++) {
+		result_data[result_offset + i] = value;
+	}
+}
+
+static void FillValidity(data_ptr_t constant, Vector &result, idx_t result_offset, idx_t count) {
+	// constant validity segments contain no NULL values: nothing to do
+}
+
+template <class T>
+static void LoadConstant(BaseStatistics &stats, data_ptr_t target) {
+	auto &nstats = (NumericStatistics &)stats;
+	Store<T>(nstats.min.GetValueUnsafe<T>(), target);
+}
+
+static ConstantSegment::fill_function_t GetFillFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BIT:
+		return FillValidity;
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return FillConstant<int8_t>;
+	case PhysicalType::INT16:
+		return FillConstant<int16_t>;
+	case PhysicalType::INT32:
+		return FillConstant<int32_t>;
+	case PhysicalType::INT64:
+		return FillConstant<int64_t>;
+	case PhysicalType::UINT8:
+		return FillConstant<uint8_t>;
+	case PhysicalType::UINT16:
+		return FillConstant<uint16_t>;
+	case PhysicalType::UINT32:
+		return FillConstant<uint32_t>;
+	case PhysicalType::UINT64:
+		return FillConstant<uint64_t>;
+	case PhysicalType::INT128:
+		return FillConstant<hugeint_t>;
+	default:
+		throw InternalException("Unsupported type for constant segment");
+	}
+}
+
+ConstantSegment::ConstantSegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, BaseStatistics &stats)
+    : CompressedSegment(db, type, row_start, CompressionType::COMPRESSION_CONSTANT) {
+	fill_function = GetFillFunction(type);
+	memset(constant, 0, sizeof(constant));
+	switch (type) {
+	case PhysicalType::BIT:
+		break;
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		LoadConstant<int8_t>(stats, constant);
+		break;
+	case PhysicalType::INT16:
+		LoadConstant<int16_t>(stats, constant);
+		break;
+	case PhysicalType::INT32:
+		LoadConstant<int32_t>(stats, constant);
+		break;
+	case PhysicalType::INT64:
+		LoadConstant<int64_t>(stats, constant);
+		break;
+	case PhysicalType::UINT8:
+		LoadConstant<uint8_t>(stats, constant);
+		break;
+	case PhysicalType::UINT16:
+		LoadConstant<uint16_t>(stats, constant);
+		break;
+	case PhysicalType::UINT32:
+		LoadConstant<uint32_t>(stats, constant);
+		break;
+	case PhysicalType::UINT64:
+		LoadConstant<uint64_t>(stats, constant);
+		break;
+	case PhysicalType::INT128:
+		LoadConstant<hugeint_t>(stats, constant);
+		break;
+	default:
+		throw InternalException("Unsupported type for constant segment");
+	}
+}
+
+bool ConstantSegment::CanCompress(PhysicalType type, BaseStatistics &stats) {
+	switch (type) {
+	case PhysicalType::BIT:
+		return !((ValidityStatistics &)stats).has_null;
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::INT128: {
+		// either every value is identical, or there are no valid values at all (min > max)
+		auto &nstats = (NumericStatistics &)stats;
+		return nstats.min >= nstats.max;
+	}
+	default:
+		// floating point values are excluded: NaN values are not reflected in the min/max statistics
+		return false;
+	}
+}
+
+void ConstantSegment::InitializeScan(ColumnScanState &state) {
+	state.primary_handle.reset();
+}
+
+void ConstantSegment::Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                           idx_t result_offset) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	if (type != PhysicalType::BIT) {
+		result.SetVectorType(VectorType::FLAT_VECTOR);
+	}
+	fill_function(constant, result, result_offset, scan_count);
+}
+
+void ConstantSegment::ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	if (type == PhysicalType::BIT) {
+		// constant validity segments contain no NULL values: nothing to do
+		return;
+	}
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	fill_function(constant, result, 0, 1);
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+}
+
+bool ConstantSegment::FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                                 const TableFilter &filter, SelectionVector &sel, idx_t &approved_tuple_count) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	if (type == PhysicalType::BIT || !CanFilterValues(filter)) {
+		return false;
+	}
+	// evaluate the filter on the constant: either every row passes the filter, or none of them do
+	Vector value(result.GetType());
+	fill_function(constant, value, 0, 1);
+	bool match;
+	FilterValues(value, 1, filter, &match);
+	if (!match) {
+		approved_tuple_count = 0;
+		return true;
+	}
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	fill_function(constant, result, 0, scan_count);
+	return true;
+}
+
+void ConstantSegment::FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	fill_function(constant, result, result_idx, 1);
+}
+
+} // namespace duckdb
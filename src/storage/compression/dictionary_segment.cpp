@@ -0,0 +1,229 @@
+#include "duckdb/storage/compression/dictionary_segment.hpp"
+#include "duckdb/storage/compression/bitpacking_segment.hpp"
+#include "duckdb/storage/string_segment.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/string_statistics.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+typedef DictionarySegment::DictionaryHeader DictionaryHeader;
+
+//! Assigns a dictionary code to every string, in order of first appearance
+struct DictionaryBuilder {
+	DictionaryBuilder(string_t *strings, idx_t count) : codes(unique_ptr<uint32_t[]>(new uint32_t[count])) {
+		for (idx_t i = 0; i < count; i++) {
+			auto str = strings[i].GetString();
+			auto entry = dictionary.find(str);
+			if (entry == dictionary.end()) {
+				uint32_t code = dictionary_strings.size();
+				dictionary[str] = code;
+				dictionary_strings.push_back(strings[i]);
+				string_size += strings[i].GetSize();
+				codes[i] = code;
+			} else {
+				codes[i] = entry->second;
+			}
+		}
+	}
+
+	unordered_map<string, uint32_t> dictionary;
+	vector<string_t> dictionary_strings;
+	unique_ptr<uint32_t[]> codes;
+	idx_t string_size = 0;
+
+	idx_t CodeWidth() {
+		if (dictionary_strings.size() <= 1) {
+			return 0;
+		}
+		return BitpackingPrimitives::RequiredBitWidth(dictionary_strings.size() - 1);
+	}
+	idx_t CodesOffset() {
+		auto offsets_size = (dictionary_strings.size() + 1) * sizeof(uint32_t);
+		return CompressedSegment::AlignOffset(sizeof(DictionaryHeader) + offsets_size + string_size);
+	}
+	idx_t TotalSize(idx_t count) {
+		return CodesOffset() + BitpackingPrimitives::PackedSize(count, CodeWidth());
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze & Compress
+//===--------------------------------------------------------------------===//
+bool DictionarySegment::CanCompress(BaseStatistics &stats) {
+	auto &sstats = (StringStatistics &)stats;
+	return sstats.max_string_length + sizeof(uint16_t) < StringSegment::STRING_BLOCK_LIMIT;
+}
+
+idx_t DictionarySegment::AnalyzeSize(string_t *strings, idx_t count) {
+	DictionaryBuilder builder(strings, count);
+	return builder.TotalSize(count);
+}
+
+void DictionarySegment::Compress(string_t *strings, idx_t count, data_ptr_t target) {
+	DictionaryBuilder builder(strings, count);
+
+	DictionaryHeader header;
+	header.dictionary_size = builder.dictionary_strings.size();
+	header.code_width = builder.CodeWidth();
+	header.codes_offset = builder.CodesOffset();
+	header.padding = 0;
+	memcpy(target, &header, sizeof(DictionaryHeader));
+
+	// write the string offsets and the string data
+	auto offsets = (uint32_t *)(target + sizeof(DictionaryHeader));
+	uint32_t string_offset = sizeof(DictionaryHeader) + (header.dictionary_size + 1) * sizeof(uint32_t);
+	for (idx_t i = 0; i < header.dictionary_size; i++) {
+		auto &str = builder.dictionary_strings[i];
+		offsets[i] = string_offset;
+		memcpy(target + string_offset, str.GetDataUnsafe(), str.GetSize());
+		string_offset += str.GetSize();
+	}
+	offsets[header.dictionary_size] = string_offset;
+
+	// write the codes
+	auto codes = target + header.codes_offset;
+	memset(target + string_offset, 0, header.codes_offset - string_offset);
+	memset(codes, 0, BitpackingPrimitives::PackedSize(count, header.code_width));
+	for (idx_t i = 0; i < count; i++) {
+		BitpackingPrimitives::PackValue(codes, i, header.code_width, builder.codes[i]);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+static inline string_t FetchDictionaryString(data_ptr_t base, uint32_t code) {
+	auto offsets = (uint32_t *)(base + sizeof(DictionaryHeader));
+	return string_t((const char *)base + offsets[code], offsets[code + 1] - offsets[code]);
+}
+
+DictionarySegment::DictionarySegment(DatabaseInstance &db, idx_t row_start, block_id_t block_id, idx_t offset)
+    : CompressedSegment(db, PhysicalType::VARCHAR, row_start, CompressionType::COMPRESSION_DICTIONARY, block_id,
+                        offset) {
+}
+
+void DictionarySegment::InitializeScan(ColumnScanState &state) {
+	CompressedSegment::InitializeScan(state);
+	state.scan_state = make_unique<DictionaryScanState>();
+}
+
+void DictionarySegment::Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                             idx_t result_offset) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	// the strings point into the pinned block, which remains pinned by the scan state
+	auto base = GetCompressedData(*state.primary_handle);
+	DictionaryHeader header;
+	memcpy(&header, base, sizeof(DictionaryHeader));
+	auto codes = base + header.codes_offset;
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < scan_count; i++) {
+		auto code = BitpackingPrimitives::UnpackValue(codes, start + i, header.code_width);
+		result_data[result_offset + i] = FetchDictionaryString(base, code);
+	}
+}
+
+void DictionarySegment::ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	auto base = GetCompressedData(*state.primary_handle);
+	DictionaryHeader header;
+	memcpy(&header, base, sizeof(DictionaryHeader));
+	if (header.dictionary_size * 2 > scan_count) {
+		// the dictionary is too big for a dictionary vector to pay off
+		Scan(state, start, scan_count, result, 0);
+		return;
+	}
+	auto codes = base + header.codes_offset;
+
+	D_ASSERT(state.scan_state);
+	auto &scan_state = (DictionaryScanState &)*state.scan_state;
+	if (!scan_state.dictionary) {
+		// load the strings of the dictionary into a vector; it is shared by all vectors emitted from this segment
+		scan_state.dictionary = make_unique<Vector>(result.GetType(), header.dictionary_size);
+		auto dictionary_data = FlatVector::GetData<string_t>(*scan_state.dictionary);
+		for (idx_t i = 0; i < header.dictionary_size; i++) {
+			dictionary_data[i] = FetchDictionaryString(base, i);
+		}
+	}
+	SelectionVector sel(scan_count);
+	for (idx_t i = 0; i < scan_count; i++) {
+		sel.set_index(i, BitpackingPrimitives::UnpackValue(codes, start + i, header.code_width));
+	}
+	result.Slice(*scan_state.dictionary, sel, scan_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+bool DictionarySegment::FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                                   const TableFilter &filter, SelectionVector &sel, idx_t &approved_tuple_count) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	if (!CanFilterValues(filter)) {
+		return false;
+	}
+	auto base = GetCompressedData(*state.primary_handle);
+	DictionaryHeader header;
+	memcpy(&header, base, sizeof(DictionaryHeader));
+	auto codes = base + header.codes_offset;
+
+	D_ASSERT(state.scan_state);
+	auto &scan_state = (DictionaryScanState &)*state.scan_state;
+	if (scan_state.filter != &filter) {
+		// evaluate the filter on the dictionary entries; the result is reused for the rest of the segment
+		scan_state.matches = unique_ptr<bool[]>(new bool[header.dictionary_size]);
+		Vector values(result.GetType());
+		auto values_data = FlatVector::GetData<string_t>(values);
+		for (idx_t entry = 0; entry < header.dictionary_size; entry += STANDARD_VECTOR_SIZE) {
+			auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, header.dictionary_size - entry);
+			for (idx_t i = 0; i < count; i++) {
+				values_data[i] = FetchDictionaryString(base, entry + i);
+			}
+			FilterValues(values, count, filter, scan_state.matches.get() + entry);
+		}
+		scan_state.filter = &filter;
+	}
+
+	// now filter the rows using their dictionary codes, and only fetch the strings of the rows that pass the filter
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		auto code = BitpackingPrimitives::UnpackValue(codes, start + idx, header.code_width);
+		if (scan_state.matches[code]) {
+			result_data[idx] = FetchDictionaryString(base, code);
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+	return true;
+}
+
+data_ptr_t DictionarySegment::PinData(ColumnFetchState &state) {
+	// the fetched strings point into the block: keep it pinned in the fetch state
+	auto block_id = block->BlockId();
+	auto entry = state.handles.find(block_id);
+	if (entry != state.handles.end()) {
+		return GetCompressedData(*entry->second);
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto handle = buffer_manager.Pin(block);
+	auto base = GetCompressedData(*handle);
+	state.handles[block_id] = move(handle);
+	return base;
+}
+
+void DictionarySegment::FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	auto base = PinData(state);
+	DictionaryHeader header;
+	memcpy(&header, base, sizeof(DictionaryHeader));
+	auto code = BitpackingPrimitives::UnpackValue(base + header.codes_offset, row_id, header.code_width);
+	FlatVector::GetData<string_t>(result)[result_idx] = FetchDictionaryString(base, code);
+}
+
+} // namespace duckdb
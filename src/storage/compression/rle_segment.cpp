@@ -0,0 +1,393 @@
+#include "duckdb/storage/compression/rle_segment.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/exception.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/numeric_statistics.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// Layout
+//===--------------------------------------------------------------------===//
+template <class T>
+static inline T *GetRLEValues(data_ptr_t base) {
+	return (T *)(base + sizeof(uint64_t));
+}
+
+static inline RLESegment::rle_run_end_t *GetRLERunEnds(data_ptr_t base, idx_t run_count, idx_t type_size) {
+	return (RLESegment::rle_run_end_t *)(base +
+	                                     CompressedSegment::AlignOffset(sizeof(uint64_t) + run_count * type_size));
+}
+
+template <class T>
+static inline RLESegment::rle_run_end_t *GetRLERunEnds(data_ptr_t base, idx_t run_count) {
+	return GetRLERunEnds(base, run_count, sizeof(T));
+}
+
+template <class T>
+static inline idx_t GetRLESize(idx_t run_count) {
+	return CompressedSegment::AlignOffset(sizeof(uint64_t) + run_count * sizeof(T)) +
+	       run_count * sizeof(RLESegment::rle_run_end_t);
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze & Compress
+//===--------------------------------------------------------------------===//
+//! Calls OP::Run(value, run_end) for every run in the data. NULL values are merged into the preceding run.
+template <class T, class OP>
+static void RLEForEachRun(T *data, idx_t count, BaseStatistics &stats, OP &op) {
+	auto &nstats = (NumericStatistics &)stats;
+	auto min = nstats.min.GetValueUnsafe<T>();
+	auto max = nstats.max.GetValueUnsafe<T>();
+
+	T last_value = min;
+	for (idx_t i = 0; i < count; i++) {
+		T value = data[i];
+		if (CompressedSegment::IsNullValue<T>(value, min, max)) {
+			// NULL value: extend the current run (or start with the minimum)
+			value = last_value;
+		}
+		// compare the binary representation so that e.g. -0.0 and 0.0 are not merged
+		if (i > 0 && memcmp(&value, &last_value, sizeof(T)) != 0) {
+			op.Run(last_value, i);
+		}
+		last_value = value;
+	}
+	if (count > 0) {
+		op.Run(last_value, count);
+	}
+}
+
+template <class T>
+struct RLEAnalyzeOperator {
+	idx_t run_count = 0;
+
+	void Run(T value, idx_t run_end) {
+		run_count++;
+	}
+};
+
+template <class T>
+struct RLECompressOperator {
+	RLECompressOperator(T *values, RLESegment::rle_run_end_t *run_ends) : values(values), run_ends(run_ends) {
+	}
+
+	T *values;
+	RLESegment::rle_run_end_t *run_ends;
+	idx_t run_count = 0;
+
+	void Run(T value, idx_t run_end) {
+		values[run_count] = value;
+		run_ends[run_count] = run_end;
+		run_count++;
+	}
+};
+
+template <class T>
+static idx_t RLEAnalyze(data_ptr_t data, idx_t count, BaseStatistics &stats) {
+	RLEAnalyzeOperator<T> op;
+	RLEForEachRun<T, RLEAnalyzeOperator<T>>((T *)data, count, stats, op);
+	return GetRLESize<T>(op.run_count);
+}
+
+template <class T>
+static void RLECompress(data_ptr_t data, idx_t count, BaseStatistics &stats, data_ptr_t target) {
+	// first count the runs so we know where the run ends are placed
+	RLEAnalyzeOperator<T> analyze;
+	RLEForEachRun<T, RLEAnalyzeOperator<T>>((T *)data, count, stats, analyze);
+
+	Store<uint64_t>(analyze.run_count, target);
+	RLECompressOperator<T> op(GetRLEValues<T>(target), GetRLERunEnds<T>(target, analyze.run_count));
+	RLEForEachRun<T, RLECompressOperator<T>>((T *)data, count, stats, op);
+	D_ASSERT(op.run_count == analyze.run_count);
+}
+
+idx_t RLESegment::AnalyzeSize(PhysicalType type, data_ptr_t data, idx_t count, BaseStatistics &stats) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return RLEAnalyze<int8_t>(data, count, stats);
+	case PhysicalType::INT16:
+		return RLEAnalyze<int16_t>(data, count, stats);
+	case PhysicalType::INT32:
+		return RLEAnalyze<int32_t>(data, count, stats);
+	case PhysicalType::INT64:
+		return RLEAnalyze<int64_t>(data, count, stats);
+	case PhysicalType::UINT8:
+		return RLEAnalyze<uint8_t>(data, count, stats);
+	case PhysicalType::UINT16:
+		return RLEAnalyze<uint16_t>(data, count, stats);
+	case PhysicalType::UINT32:
+		return RLEAnalyze<uint32_t>(data, count, stats);
+	case PhysicalType::UINT64:
+		return RLEAnalyze<uint64_t>(data, count, stats);
+	case PhysicalType::INT128:
+		return RLEAnalyze<hugeint_t>(data, count, stats);
+	case PhysicalType::FLOAT:
+		return RLEAnalyze<float>(data, count, stats);
+	case PhysicalType::DOUBLE:
+		return RLEAnalyze<double>(data, count, stats);
+	default:
+		return INVALID_INDEX;
+	}
+}
+
+void RLESegment::Compress(PhysicalType type, data_ptr_t data, idx_t count, BaseStatistics &stats, data_ptr_t target) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		RLECompress<int8_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT16:
+		RLECompress<int16_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT32:
+		RLECompress<int32_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT64:
+		RLECompress<int64_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT8:
+		RLECompress<uint8_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT16:
+		RLECompress<uint16_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT32:
+		RLECompress<uint32_t>(data, count, stats, target);
+		break;
+	case PhysicalType::UINT64:
+		RLECompress<uint64_t>(data, count, stats, target);
+		break;
+	case PhysicalType::INT128:
+		RLECompress<hugeint_t>(data, count, stats, target);
+		break;
+	case PhysicalType::FLOAT:
+		RLECompress<float>(data, count, stats, target);
+		break;
+	case PhysicalType::DOUBLE:
+		RLECompress<double>(data, count, stats, target);
+		break;
+	default:
+		throw InternalException("Unsupported type for RLE compression");
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+static void RLEScan(data_ptr_t base, RLEScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                    idx_t result_offset) {
+	auto run_count = Load<uint64_t>(base);
+	auto values = GetRLEValues<T>(base);
+	auto run_ends = GetRLERunEnds<T>(base, run_count);
+	if (start != state.row_pos) {
+		// non-sequential scan: find the run that holds the start row
+		state.entry_pos = std::upper_bound(run_ends, run_ends + run_count, start) - run_ends;
+	}
+	auto result_data = FlatVector::GetData<T>(result);
+	idx_t end = start + scan_count;
+	idx_t row = start;
+	while (row < end) {
+		D_ASSERT(state.entry_pos < run_count);
+		idx_t run_end = run_ends[state.entry_pos];
+		idx_t fill_end = MinValue<idx_t>(run_end, end);
+		auto value = values[state.entry_pos];
+		for (; row < fill_end; row++) {
+			result_data[result_offset + row - start] = value;
+		}
+		if (fill_end == run_end) {
+			state.entry_pos++;
+		}
+	}
+	state.row_pos = end;
+}
+
+template <class T>
+static void RLEFetch(data_ptr_t base, idx_t row, Vector &result, idx_t result_idx) {
+	auto run_count = Load<uint64_t>(base);
+	auto values = GetRLEValues<T>(base);
+	auto run_ends = GetRLERunEnds<T>(base, run_count);
+	auto entry = std::upper_bound(run_ends, run_ends + run_count, row) - run_ends;
+	D_ASSERT(idx_t(entry) < run_count);
+	FlatVector::GetData<T>(result)[result_idx] = values[entry];
+}
+
+static RLESegment::rle_scan_function_t GetRLEScanFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return RLEScan<int8_t>;
+	case PhysicalType::INT16:
+		return RLEScan<int16_t>;
+	case PhysicalType::INT32:
+		return RLEScan<int32_t>;
+	case PhysicalType::INT64:
+		return RLEScan<int64_t>;
+	case PhysicalType::UINT8:
+		return RLEScan<uint8_t>;
+	case PhysicalType::UINT16:
+		return RLEScan<uint16_t>;
+	case PhysicalType::UINT32:
+		return RLEScan<uint32_t>;
+	case PhysicalType::UINT64:
+		return RLEScan<uint64_t>;
+	case PhysicalType::INT128:
+		return RLEScan<hugeint_t>;
+	case PhysicalType::FLOAT:
+		return RLEScan<float>;
+	case PhysicalType::DOUBLE:
+		return RLEScan<double>;
+	default:
+		throw InternalException("Unsupported type for RLE segment");
+	}
+}
+
+static RLESegment::rle_fetch_function_t GetRLEFetchFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+		return RLEFetch<int8_t>;
+	case PhysicalType::INT16:
+		return RLEFetch<int16_t>;
+	case PhysicalType::INT32:
+		return RLEFetch<int32_t>;
+	case PhysicalType::INT64:
+		return RLEFetch<int64_t>;
+	case PhysicalType::UINT8:
+		return RLEFetch<uint8_t>;
+	case PhysicalType::UINT16:
+		return RLEFetch<uint16_t>;
+	case PhysicalType::UINT32:
+		return RLEFetch<uint32_t>;
+	case PhysicalType::UINT64:
+		return RLEFetch<uint64_t>;
+	case PhysicalType::INT128:
+		return RLEFetch<hugeint_t>;
+	case PhysicalType::FLOAT:
+		return RLEFetch<float>;
+	case PhysicalType::DOUBLE:
+		return RLEFetch<double>;
+	default:
+		throw InternalException("Unsupported type for RLE segment");
+	}
+}
+
+RLESegment::RLESegment(DatabaseInstance &db, PhysicalType type, idx_t row_start, block_id_t block_id, idx_t offset)
+    : CompressedSegment(db, type, row_start, CompressionType::COMPRESSION_RLE, block_id, offset) {
+	scan_function = GetRLEScanFunction(type);
+	fetch_function = GetRLEFetchFunction(type);
+}
+
+void RLESegment::InitializeScan(ColumnScanState &state) {
+	CompressedSegment::InitializeScan(state);
+	state.scan_state = make_unique<RLEScanState>();
+}
+
+void RLESegment::Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	D_ASSERT(state.scan_state);
+	auto base = GetCompressedData(*state.primary_handle);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	scan_function(base, (RLEScanState &)*state.scan_state, start, scan_count, result, result_offset);
+}
+
+void RLESegment::ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	D_ASSERT(state.scan_state);
+	auto base = GetCompressedData(*state.primary_handle);
+	auto &scan_state = (RLEScanState &)*state.scan_state;
+	auto run_count = Load<uint64_t>(base);
+	auto run_ends = GetRLERunEnds(base, run_count, GetTypeIdSize(type));
+	idx_t entry_pos = scan_state.entry_pos;
+	if (start != scan_state.row_pos) {
+		entry_pos = std::upper_bound(run_ends, run_ends + run_count, start) - run_ends;
+	}
+	D_ASSERT(entry_pos < run_count);
+	idx_t end = start + scan_count;
+	if (run_ends[entry_pos] < end) {
+		// the vector spans multiple runs
+		Scan(state, start, scan_count, result, 0);
+		return;
+	}
+	// the entire vector is part of a single run: emit a constant vector
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	scan_function(base, scan_state, start, 1, result, 0);
+	result.SetVectorType(VectorType::CONSTANT_VECTOR);
+	scan_state.entry_pos = run_ends[entry_pos] == end ? entry_pos + 1 : entry_pos;
+	scan_state.row_pos = end;
+}
+
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+bool RLESegment::FilterScan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result,
+                            const TableFilter &filter, SelectionVector &sel, idx_t &approved_tuple_count) {
+	D_ASSERT(RowRangeIsValid(start, scan_count));
+	if (!CanFilterValues(filter)) {
+		return false;
+	}
+	D_ASSERT(state.scan_state);
+	auto &scan_state = (RLEScanState &)*state.scan_state;
+	auto base = GetCompressedData(*state.primary_handle);
+	auto type_size = GetTypeIdSize(type);
+	auto run_count = Load<uint64_t>(base);
+	auto values = base + sizeof(uint64_t);
+	auto run_ends = GetRLERunEnds(base, run_count, type_size);
+	if (start != scan_state.row_pos) {
+		scan_state.entry_pos = std::upper_bound(run_ends, run_ends + run_count, start) - run_ends;
+	}
+	// gather the values of the runs that overlap with the scanned range: there are at most scan_count runs
+	idx_t end = start + scan_count;
+	idx_t first_run = scan_state.entry_pos;
+	idx_t run_total = 0;
+	while (first_run + run_total < run_count && (run_total == 0 || run_ends[first_run + run_total - 1] < end)) {
+		run_total++;
+	}
+	D_ASSERT(run_total > 0 && run_total <= scan_count);
+	Vector run_values(result.GetType());
+	memcpy(FlatVector::GetData(run_values), values + first_run * type_size, run_total * type_size);
+
+	// evaluate the filter once per run
+	bool matches[STANDARD_VECTOR_SIZE];
+	FilterValues(run_values, run_total, filter, matches);
+
+	// now filter the rows based on the run they belong to
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData(result);
+	SelectionVector new_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	idx_t run_idx = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		while (run_ends[first_run + run_idx] <= start + idx) {
+			run_idx++;
+			D_ASSERT(run_idx < run_total);
+		}
+		if (matches[run_idx]) {
+			memcpy(result_data + idx * type_size, values + (first_run + run_idx) * type_size, type_size);
+			new_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(new_sel);
+	approved_tuple_count = result_count;
+
+	// move the scan state to the end of the scanned range
+	scan_state.entry_pos = first_run + run_total - 1;
+	if (run_ends[scan_state.entry_pos] == end) {
+		scan_state.entry_pos++;
+	}
+	scan_state.row_pos = end;
+	return true;
+}
+
+void RLESegment::FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	auto handle = buffer_manager.Pin(block);
+	fetch_function(GetCompressedData(*handle), row_id, result, result_idx);
+}
+
+} // namespace duckdb
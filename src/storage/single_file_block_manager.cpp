@@ -211,9 +211,24 @@ block_id_t SingleFileBlockManager::GetFreeBlockId() {
 }
 
 void SingleFileBlockManager::MarkBlockAsModified(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	auto entry = block_reference_counts.find(block_id);
+	if (entry != block_reference_counts.end()) {
+		// shared block: only free the block once it is no longer referenced
+		D_ASSERT(entry->second > 0);
+		if (--entry->second > 0) {
+			return;
+		}
+		block_reference_counts.erase(entry);
+	}
 	modified_blocks.insert(block_id);
 }
 
+void SingleFileBlockManager::IncreaseBlockReferenceCount(block_id_t block_id) {
+	D_ASSERT(block_id >= 0);
+	block_reference_counts[block_id]++;
+}
+
 block_id_t SingleFileBlockManager::GetMetaBlock() {
 	return meta_block;
 }
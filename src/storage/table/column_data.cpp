@@ -20,6 +20,7 @@
 #include "duckdb/storage/table/list_column_data.hpp"
 #include "duckdb/transaction/transaction.hpp"
 #include "duckdb/storage/table/row_group.hpp"
+#include "duckdb/storage/compression/compressed_segment.hpp"
 
 namespace duckdb {
 
@@ -62,6 +63,18 @@ void ColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx)
 	state.initialized = false;
 }
 
+void ColumnData::CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks) {
+	auto segment = (ColumnSegment *)data.GetRootSegment();
+	for (; segment; segment = (ColumnSegment *)segment->next.get()) {
+		if (segment->start + segment->count <= row_idx || segment->segment_type != ColumnSegmentType::PERSISTENT) {
+			continue;
+		}
+		if (segment->data->block) {
+			blocks.push_back(segment->data->block);
+		}
+	}
+}
+
 idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining) {
 	if (!state.initialized) {
 		D_ASSERT(state.current);
@@ -92,15 +105,45 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	return initial_remaining - remaining;
 }
 
+idx_t ColumnData::ScanCompressedVector(ColumnScanState &state, Vector &result) {
+	if (!state.initialized) {
+		D_ASSERT(state.current);
+		state.current->InitializeScan(state);
+		state.initialized = true;
+	}
+	auto segment = state.current;
+	D_ASSERT(state.row_index >= segment->start && state.row_index < segment->start + segment->count);
+	idx_t start = state.row_index - segment->start;
+	idx_t scan_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, segment->count - start);
+	if (scan_count < STANDARD_VECTOR_SIZE && segment->next) {
+		// the vector spans multiple segments: emit a flat vector
+		return ScanVector(state, result, STANDARD_VECTOR_SIZE);
+	}
+	segment->ScanVector(state, start, scan_count, result);
+	return scan_count;
+}
+
 template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 void ColumnData::ScanVector(Transaction *transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
-	ScanVector(state, result, STANDARD_VECTOR_SIZE);
+	idx_t scan_count;
+	// regular table scans of top-level columns (and their validity) can receive constant and dictionary vectors
+	// the children of nested columns, and the committed scans used for e.g. index creation, are always flat
+	bool is_top_level = !parent || (type.id() == LogicalTypeId::VALIDITY && !parent->parent);
+	if (!SCAN_COMMITTED && is_top_level) {
+		scan_count = ScanCompressedVector(state, result);
+	} else {
+		scan_count = ScanVector(state, result, STANDARD_VECTOR_SIZE);
+	}
 
 	lock_guard<mutex> update_guard(update_lock);
 	if (updates) {
 		if (!ALLOW_UPDATES && updates->HasUncommittedUpdates(vector_index)) {
 			throw TransactionException("Cannot create index with outstanding updates");
 		}
+		if (result.GetVectorType() != VectorType::FLAT_VECTOR && updates->HasUpdates(vector_index)) {
+			// the updates are merged into a flat vector
+			result.Normalify(scan_count);
+		}
 		if (SCAN_COMMITTED) {
 			updates->FetchCommitted(vector_index, result);
 		} else {
@@ -131,6 +174,50 @@ void ColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &state, Vecto
 	}
 }
 
+void ColumnData::Select(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+                        SelectionVector &sel, idx_t &approved_tuple_count, TableFilter &filter) {
+	Scan(transaction, vector_index, state, result);
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		// the filter is evaluated on a flat vector
+		idx_t vector_start = start + vector_index * STANDARD_VECTOR_SIZE;
+		result.Normalify(MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetCount() - vector_start));
+	}
+	UncompressedSegment::FilterSelection(sel, result, filter, approved_tuple_count, FlatVector::Validity(result));
+}
+
+void ColumnData::SelectCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                 idx_t &approved_tuple_count, TableFilter &filter, bool allow_updates) {
+	ScanCommitted(vector_index, state, result, allow_updates);
+	UncompressedSegment::FilterSelection(sel, result, filter, approved_tuple_count, FlatVector::Validity(result));
+}
+
+bool ColumnData::FilterScanVector(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
+                                  idx_t &approved_tuple_count, TableFilter &filter) {
+	if (!state.current) {
+		return false;
+	}
+	{
+		lock_guard<mutex> update_guard(update_lock);
+		if (updates && updates->HasUpdates(vector_index)) {
+			// the updates need to be merged into the base data before the filter can be applied
+			return false;
+		}
+	}
+	if (!state.initialized) {
+		state.current->InitializeScan(state);
+		state.initialized = true;
+	}
+	auto segment = state.current;
+	D_ASSERT(state.row_index >= segment->start && state.row_index < segment->start + segment->count);
+	idx_t start = state.row_index - segment->start;
+	idx_t scan_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, segment->count - start);
+	if (scan_count < STANDARD_VECTOR_SIZE && segment->next) {
+		// the vector spans multiple segments
+		return false;
+	}
+	return segment->FilterScan(state, start, scan_count, result, filter, sel, approved_tuple_count);
+}
+
 void ColumnData::ScanCommittedRange(idx_t row_group_start, idx_t offset_in_row_group, idx_t count, Vector &result) {
 	ColumnScanState child_state;
 	InitializeScanWithOffset(child_state, row_group_start + offset_in_row_group);
@@ -309,7 +396,9 @@ void ColumnData::CommitDropColumn() {
 	while (segment) {
 		if (segment->segment_type == ColumnSegmentType::PERSISTENT) {
 			auto &persistent = (PersistentSegment &)*segment;
-			block_manager.MarkBlockAsModified(persistent.block_id);
+			if (persistent.block_id != INVALID_BLOCK) {
+				block_manager.MarkBlockAsModified(persistent.block_id);
+			}
 		}
 		segment = (ColumnSegment *)segment->next.get();
 	}
@@ -373,15 +462,30 @@ void ColumnCheckpointState::FlushSegment() {
 
 	auto handle = buffer_manager.Pin(current_segment->block);
 
-	// get a free block id to write to
-	auto block_id = block_manager.GetFreeBlockId();
+	// figure out if we can compress the segment
+	idx_t compressed_size;
+	auto compression = SegmentCompression::Analyze(*current_segment, *segment_stats->statistics, compressed_size);
 
-	// construct the data pointer
+	block_id_t block_id;
 	uint32_t offset_in_block = 0;
+	if (compression == CompressionType::COMPRESSION_UNCOMPRESSED) {
+		// uncompressed: write the segment to its own block
+		block_id = block_manager.GetFreeBlockId();
+		block_manager.Write(*handle->node, block_id);
+	} else if (compression == CompressionType::COMPRESSION_CONSTANT) {
+		// constant segment: the value is stored in the statistics, no data needs to be written
+		block_id = INVALID_BLOCK;
+	} else {
+		// compressed segment: compress the data into a (shared) block of the table data writer
+		auto target = writer.AllocateCompressedSegment(compressed_size, block_id, offset_in_block);
+		SegmentCompression::Compress(compression, *current_segment, *segment_stats->statistics, target);
+	}
 
+	// construct the data pointer
 	DataPointer data_pointer;
 	data_pointer.block_pointer.block_id = block_id;
 	data_pointer.block_pointer.offset = offset_in_block;
+	data_pointer.compression_type = compression;
 	data_pointer.row_start = row_group.start;
 	if (!data_pointers.empty()) {
 		auto &last_pointer = data_pointers.back();
@@ -393,12 +497,10 @@ void ColumnCheckpointState::FlushSegment() {
 	// construct a persistent segment that points to this block, and append it to the new segment tree
 	auto persistent_segment = make_unique<PersistentSegment>(
 	    column_data.GetDatabase(), block_id, offset_in_block, column_data.type, data_pointer.row_start,
-	    data_pointer.tuple_count, segment_stats->statistics->Copy());
+	    data_pointer.tuple_count, segment_stats->statistics->Copy(), compression);
 	new_tree.AppendSegment(move(persistent_segment));
 
 	data_pointers.push_back(move(data_pointer));
-	// write the block to disk
-	block_manager.Write(*handle->node, block_id);
 
 	// merge the segment stats into the global stats
 	global_stats->Merge(*segment_stats->statistics);
@@ -419,6 +521,7 @@ void ColumnCheckpointState::FlushToDisk() {
 		meta_writer.Write<idx_t>(data_pointer.tuple_count);
 		meta_writer.Write<block_id_t>(data_pointer.block_pointer.block_id);
 		meta_writer.Write<uint32_t>(data_pointer.block_pointer.offset);
+		meta_writer.Write<uint8_t>((uint8_t)data_pointer.compression_type);
 		data_pointer.statistics->Serialize(meta_writer);
 	}
 }
@@ -467,7 +570,9 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Ta
 			}
 			if (has_changes) {
 				// persistent segment has updates: mark it as modified and rewrite the block with the merged updates
-				block_manager.MarkBlockAsModified(persistent.block_id);
+				if (persistent.block_id != INVALID_BLOCK) {
+					block_manager.MarkBlockAsModified(persistent.block_id);
+				}
 			} else {
 				// unchanged persistent segment: no need to write the data
 
@@ -480,7 +585,8 @@ unique_ptr<ColumnCheckpointState> ColumnData::Checkpoint(RowGroup &row_group, Ta
 				// set up the data pointer directly using the data from the persistent segment
 				DataPointer pointer;
 				pointer.block_pointer.block_id = persistent.block_id;
-				pointer.block_pointer.offset = 0;
+				pointer.block_pointer.offset = persistent.offset;
+				pointer.compression_type = persistent.compression;
 				pointer.row_start = segment->start;
 				pointer.tuple_count = persistent.count;
 				pointer.statistics = persistent.stats.statistics->Copy();
@@ -549,12 +655,21 @@ void ColumnData::DeserializeColumn(Deserializer &source) {
 		data_pointer.tuple_count = source.Read<idx_t>();
 		data_pointer.block_pointer.block_id = source.Read<block_id_t>();
 		data_pointer.block_pointer.offset = source.Read<uint32_t>();
+		data_pointer.compression_type = (CompressionType)source.Read<uint8_t>();
 		data_pointer.statistics = BaseStatistics::Deserialize(source, type);
 
+		if (data_pointer.compression_type != CompressionType::COMPRESSION_UNCOMPRESSED &&
+		    data_pointer.block_pointer.block_id != INVALID_BLOCK) {
+			// compressed segments can share a block: keep track of the amount of segments referencing the block
+			auto &block_manager = BlockManager::GetBlockManager(GetDatabase());
+			block_manager.IncreaseBlockReferenceCount(data_pointer.block_pointer.block_id);
+		}
+
 		// create a persistent segment
-		auto segment = make_unique<PersistentSegment>(GetDatabase(), data_pointer.block_pointer.block_id,
-		                                              data_pointer.block_pointer.offset, type, data_pointer.row_start,
-		                                              data_pointer.tuple_count, move(data_pointer.statistics));
+		auto segment = make_unique<PersistentSegment>(
+		    GetDatabase(), data_pointer.block_pointer.block_id, data_pointer.block_pointer.offset, type,
+		    data_pointer.row_start, data_pointer.tuple_count, move(data_pointer.statistics),
+		    data_pointer.compression_type);
 		data.AppendSegment(move(segment));
 	}
 }
@@ -606,15 +721,23 @@ void ColumnData::GetStorageInfo(idx_t row_group_index, vector<idx_t> col_path, v
 		// persistent
 		// block_id
 		// block_offset
+		// compression
 		if (segment->segment_type == ColumnSegmentType::PERSISTENT) {
 			auto &persistent = (PersistentSegment &)*segment;
 			column_info.push_back(Value::BOOLEAN(true));
-			column_info.push_back(Value::BIGINT(persistent.block_id));
-			column_info.push_back(Value::BIGINT(persistent.offset));
+			if (persistent.block_id != INVALID_BLOCK) {
+				column_info.push_back(Value::BIGINT(persistent.block_id));
+				column_info.push_back(Value::BIGINT(persistent.offset));
+			} else {
+				column_info.emplace_back();
+				column_info.emplace_back();
+			}
+			column_info.emplace_back(CompressionTypeToString(persistent.compression));
 		} else {
 			column_info.push_back(Value::BOOLEAN(false));
 			column_info.emplace_back();
 			column_info.emplace_back();
+			column_info.emplace_back(CompressionTypeToString(CompressionType::COMPRESSION_UNCOMPRESSED));
 		}
 
 		result.push_back(move(column_info));
@@ -31,6 +31,17 @@ void ColumnSegment::Scan(ColumnScanState &state, idx_t start_row, idx_t scan_cou
 	data->Scan(state, start_row, scan_count, result, result_offset);
 }
 
+void ColumnSegment::ScanVector(ColumnScanState &state, idx_t start_row, idx_t scan_count, Vector &result) {
+	D_ASSERT(start_row + scan_count <= this->count);
+	data->ScanVector(state, start_row, scan_count, result);
+}
+
+bool ColumnSegment::FilterScan(ColumnScanState &state, idx_t start_row, idx_t scan_count, Vector &result,
+                               const TableFilter &filter, SelectionVector &sel, idx_t &approved_tuple_count) {
+	D_ASSERT(start_row + scan_count <= this->count);
+	return data->FilterScan(state, start_row, scan_count, result, filter, sel, approved_tuple_count);
+}
+
 void ColumnSegment::FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
 	data->FetchRow(state, row_id - this->start, result, result_idx);
 }
@@ -63,6 +63,16 @@ void ListColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t row_
 	state.child_states.push_back(move(child_state));
 }
 
+void ListColumnData::CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks) {
+	ColumnData::CollectBlocks(row_idx, blocks);
+	validity.CollectBlocks(row_idx, blocks);
+	if (row_idx == start) {
+		// the rows of the child column do not line up with the rows of the list: only prefetch the child if we are
+		// scanning the entire list
+		child_column->CollectBlocks(child_column->start, blocks);
+	}
+}
+
 void ListColumnData::Scan(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
 	ScanCount(state, result, STANDARD_VECTOR_SIZE);
 }
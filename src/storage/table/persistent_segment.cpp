@@ -10,15 +10,21 @@
 #include "duckdb/storage/numeric_segment.hpp"
 #include "duckdb/storage/string_segment.hpp"
 #include "duckdb/storage/table/validity_segment.hpp"
+#include "duckdb/storage/compression/compressed_segment.hpp"
 
 namespace duckdb {
 
 PersistentSegment::PersistentSegment(DatabaseInstance &db, block_id_t id, idx_t offset, const LogicalType &type_p,
-                                     idx_t start, idx_t count, unique_ptr<BaseStatistics> statistics)
+                                     idx_t start, idx_t count, unique_ptr<BaseStatistics> statistics,
+                                     CompressionType compression)
     : ColumnSegment(db, type_p, ColumnSegmentType::PERSISTENT, start, count, move(statistics)), block_id(id),
-      offset(offset) {
-	D_ASSERT(offset == 0);
-	if (type.InternalType() == PhysicalType::VARCHAR) {
+      offset(offset), compression(compression) {
+	// only compressed segments can be stored at an offset within a (shared) block
+	D_ASSERT(offset == 0 || compression != CompressionType::COMPRESSION_UNCOMPRESSED);
+	if (compression != CompressionType::COMPRESSION_UNCOMPRESSED) {
+		data = SegmentCompression::CreateSegment(db, compression, type.InternalType(), start, id, offset,
+		                                         *stats.statistics);
+	} else if (type.InternalType() == PhysicalType::VARCHAR) {
 		data = make_unique<StringSegment>(db, start, id);
 	} else if (type.InternalType() == PhysicalType::BIT) {
 		data = make_unique<ValiditySegment>(db, start, id);
@@ -10,6 +10,7 @@
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
 #include "duckdb/storage/meta_block_reader.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 namespace duckdb {
 
@@ -79,6 +80,7 @@ bool RowGroup::InitializeScanWithOffset(RowGroupScanState &state, idx_t vector_o
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchBlocks(state, start + vector_offset * STANDARD_VECTOR_SIZE);
 	return true;
 }
 
@@ -102,9 +104,24 @@ bool RowGroup::InitializeScan(RowGroupScanState &state) {
 			state.column_scans[i].current = nullptr;
 		}
 	}
+	PrefetchBlocks(state, start);
 	return true;
 }
 
+void RowGroup::PrefetchBlocks(RowGroupScanState &state, idx_t row_idx) {
+	// announce the blocks of the scanned columns to the buffer manager, so they are read ahead of the scan
+	vector<shared_ptr<BlockHandle>> blocks;
+	for (auto &column : state.parent.column_ids) {
+		if (column != COLUMN_IDENTIFIER_ROW_ID) {
+			columns[column]->CollectBlocks(row_idx, blocks);
+		}
+	}
+	if (blocks.size() > 1) {
+		// the first block is pinned by the scan right away: there is no point in prefetching only that block
+		BufferManager::GetBufferManager(db).Prefetch(blocks);
+	}
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(ClientContext &context, const LogicalType &target_type, idx_t changed_idx,
                                          ExpressionExecutor &executor, TableScanState &scan_state,
                                          DataChunk &scan_chunk) {
@@ -278,6 +295,23 @@ bool RowGroup::CheckZonemapSegments(RowGroupScanState &state) {
 	return true;
 }
 
+template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
+void RowGroup::ScanColumn(Transaction *transaction, RowGroupScanState &state, idx_t i, Vector &result,
+                          idx_t current_row) {
+	auto column = state.parent.column_ids[i];
+	if (column == COLUMN_IDENTIFIER_ROW_ID) {
+		// scan row id
+		D_ASSERT(result.GetType().InternalType() == ROW_TYPE);
+		result.Sequence(this->start + current_row, 1);
+	} else if (SCAN_COMMITTED) {
+		columns[column]->ScanCommitted(state.vector_index, state.column_scans[i], result, ALLOW_UPDATES);
+	} else {
+		D_ASSERT(transaction);
+		D_ASSERT(ALLOW_UPDATES);
+		columns[column]->Scan(*transaction, state.vector_index, state.column_scans[i], result);
+	}
+}
+
 template <bool SCAN_DELETES, bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 void RowGroup::TemplatedScan(Transaction *transaction, RowGroupScanState &state, DataChunk &result) {
 	auto &table_filters = state.parent.table_filters;
@@ -310,25 +344,15 @@ void RowGroup::TemplatedScan(Transaction *transaction, RowGroupScanState &state,
 			count = max_count;
 		}
 		idx_t approved_tuple_count = count;
-
-		for (idx_t i = 0; i < column_ids.size(); i++) {
-			auto column = column_ids[i];
-			if (column == COLUMN_IDENTIFIER_ROW_ID) {
-				// scan row id
-				D_ASSERT(result.data[i].GetType().InternalType() == ROW_TYPE);
-				result.data[i].Sequence(this->start + current_row, 1);
-			} else {
-				if (SCAN_COMMITTED) {
-					columns[column]->ScanCommitted(state.vector_index, state.column_scans[i], result.data[i],
-					                               ALLOW_UPDATES);
-				} else {
-					D_ASSERT(transaction);
-					D_ASSERT(ALLOW_UPDATES);
-					columns[column]->Scan(*transaction, state.vector_index, state.column_scans[i], result.data[i]);
-				}
+		if (!table_filters) {
+			// no filters: scan all of the columns
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				ScanColumn<SCAN_COMMITTED, ALLOW_UPDATES>(transaction, state, i, result.data[i], current_row);
 			}
-		}
-		if (table_filters) {
+			if (count != max_count) {
+				result.Slice(valid_sel, count);
+			}
+		} else {
 			SelectionVector sel;
 			if (count != max_count) {
 				sel.Initialize(valid_sel);
@@ -336,20 +360,57 @@ void RowGroup::TemplatedScan(Transaction *transaction, RowGroupScanState &state,
 				sel.Initialize(FlatVector::INCREMENTAL_SELECTION_VECTOR);
 			}
 			//! First, we scan the columns with filters, fetch their data and generate a selection vector.
+			//! The filters are evaluated by the column itself, which allows them to be pushed into the segment
+			//! (e.g. evaluated once per dictionary entry or run) rather than on the decompressed values.
 			//! get runtime statistics
 			auto start_time = high_resolution_clock::now();
 			for (idx_t i = 0; i < adaptive_filter->permutation.size(); i++) {
 				auto tf_idx = adaptive_filter->permutation[i];
 				D_ASSERT(table_filters->filters.count(tf_idx) == 1);
-				auto &filter = table_filters->filters[tf_idx];
-				UncompressedSegment::FilterSelection(sel, result.data[tf_idx], *filter, approved_tuple_count,
-				                                     FlatVector::Validity(result.data[tf_idx]));
+				auto &filter = *table_filters->filters[tf_idx];
+				auto column = column_ids[tf_idx];
+				auto &result_vector = result.data[tf_idx];
+				if (approved_tuple_count == 0) {
+					// an earlier filter already eliminated all tuples
+					if (column != COLUMN_IDENTIFIER_ROW_ID) {
+						columns[column]->Skip(state.column_scans[tf_idx]);
+					}
+					continue;
+				}
+				if (column == COLUMN_IDENTIFIER_ROW_ID) {
+					D_ASSERT(result_vector.GetType().InternalType() == ROW_TYPE);
+					result_vector.Sequence(this->start + current_row, 1);
+					UncompressedSegment::FilterSelection(sel, result_vector, filter, approved_tuple_count,
+					                                     FlatVector::Validity(result_vector));
+				} else if (SCAN_COMMITTED) {
+					columns[column]->SelectCommitted(state.vector_index, state.column_scans[tf_idx], result_vector,
+					                                 sel, approved_tuple_count, filter, ALLOW_UPDATES);
+				} else {
+					D_ASSERT(transaction);
+					D_ASSERT(ALLOW_UPDATES);
+					columns[column]->Select(*transaction, state.vector_index, state.column_scans[tf_idx],
+					                        result_vector, sel, approved_tuple_count, filter);
+				}
 			}
 			auto end_time = high_resolution_clock::now();
 			if (adaptive_filter && adaptive_filter->permutation.size() > 1) {
 				adaptive_filter->AdaptRuntimeStatistics(duration_cast<duration<double>>(end_time - start_time).count());
 			}
-
+			//! Now scan (or skip) the remaining columns
+			for (idx_t i = 0; i < column_ids.size(); i++) {
+				if (table_filters->filters.find(i) != table_filters->filters.end()) {
+					continue;
+				}
+				if (approved_tuple_count == 0) {
+					// no tuples qualify: skip the scan of the remaining columns
+					auto column = column_ids[i];
+					if (column != COLUMN_IDENTIFIER_ROW_ID) {
+						columns[column]->Skip(state.column_scans[i]);
+					}
+					continue;
+				}
+				ScanColumn<SCAN_COMMITTED, ALLOW_UPDATES>(transaction, state, i, result.data[i], current_row);
+			}
 			if (approved_tuple_count == 0) {
 				result.Reset();
 				state.vector_index++;
@@ -358,8 +419,6 @@ void RowGroup::TemplatedScan(Transaction *transaction, RowGroupScanState &state,
 			if (approved_tuple_count != max_count) {
 				result.Slice(sel, approved_tuple_count);
 			}
-		} else if (count != max_count) {
-			result.Slice(valid_sel, count);
 		}
 		D_ASSERT(approved_tuple_count > 0);
 		result.SetCardinality(approved_tuple_count);
@@ -54,6 +54,11 @@ void StandardColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t
 	state.child_states.push_back(move(child_state));
 }
 
+void StandardColumnData::CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks) {
+	ColumnData::CollectBlocks(row_idx, blocks);
+	validity.CollectBlocks(row_idx, blocks);
+}
+
 void StandardColumnData::Scan(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
 	D_ASSERT(state.row_index == state.child_states[0].row_index);
 	ColumnData::Scan(transaction, vector_index, state, result);
@@ -74,6 +79,50 @@ void StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t
 	state.Next(count);
 }
 
+//! Removes the NULL values from the selection vector
+static void FilterNullValues(SelectionVector &sel, idx_t &approved_tuple_count, ValidityMask &mask) {
+	if (mask.AllValid()) {
+		return;
+	}
+	SelectionVector result_sel(approved_tuple_count);
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < approved_tuple_count; i++) {
+		auto idx = sel.get_index(i);
+		if (mask.RowIsValid(idx)) {
+			result_sel.set_index(result_count++, idx);
+		}
+	}
+	sel.Initialize(result_sel);
+	approved_tuple_count = result_count;
+}
+
+void StandardColumnData::Select(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+                                SelectionVector &sel, idx_t &approved_tuple_count, TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	if (!FilterScanVector(vector_index, state, result, sel, approved_tuple_count, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, approved_tuple_count, filter);
+		return;
+	}
+	// the filter was evaluated on the segment data: filter out the NULL values
+	validity.Scan(transaction, vector_index, state.child_states[0], result);
+	FilterNullValues(sel, approved_tuple_count, FlatVector::Validity(result));
+	state.NextVector();
+}
+
+void StandardColumnData::SelectCommitted(idx_t vector_index, ColumnScanState &state, Vector &result,
+                                         SelectionVector &sel, idx_t &approved_tuple_count, TableFilter &filter,
+                                         bool allow_updates) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	if (!FilterScanVector(vector_index, state, result, sel, approved_tuple_count, filter)) {
+		ColumnData::SelectCommitted(vector_index, state, result, sel, approved_tuple_count, filter, allow_updates);
+		return;
+	}
+	// the filter was evaluated on the segment data: filter out the NULL values
+	validity.ScanCommitted(vector_index, state.child_states[0], result, allow_updates);
+	FilterNullValues(sel, approved_tuple_count, FlatVector::Validity(result));
+	state.NextVector();
+}
+
 void StandardColumnData::InitializeAppend(ColumnAppendState &state) {
 	ColumnData::InitializeAppend(state);
 
@@ -55,6 +55,13 @@ void StructColumnData::InitializeScanWithOffset(ColumnScanState &state, idx_t ro
 	}
 }
 
+void StructColumnData::CollectBlocks(idx_t row_idx, vector<shared_ptr<BlockHandle>> &blocks) {
+	validity.CollectBlocks(row_idx, blocks);
+	for (auto &sub_column : sub_columns) {
+		sub_column->CollectBlocks(row_idx, blocks);
+	}
+}
+
 void StructColumnData::Scan(Transaction &transaction, idx_t vector_index, ColumnScanState &state, Vector &result) {
 	validity.Scan(transaction, vector_index, state.child_states[0], result);
 	auto &child_entries = StructVector::GetEntries(result);
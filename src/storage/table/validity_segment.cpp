@@ -224,6 +224,25 @@ const validity_t ValiditySegment::UPPER_MASKS[] = {0x0,
                                                    0xfffffffffffffffe,
                                                    0xffffffffffffffff};
 
+void ValiditySegment::ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) {
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		// the data was emitted as a constant or dictionary vector: we only need to flatten it if there are NULL values
+		ValidityMask source_mask((validity_t *)state.primary_handle->node->buffer);
+		bool all_valid = true;
+		for (idx_t i = 0; i < scan_count; i++) {
+			if (!source_mask.RowIsValid(start + i)) {
+				all_valid = false;
+				break;
+			}
+		}
+		if (all_valid) {
+			return;
+		}
+		result.Normalify(scan_count);
+	}
+	Scan(state, start, scan_count, result, 0);
+}
+
 void ValiditySegment::Scan(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result, idx_t result_offset) {
 	static_assert(sizeof(validity_t) == sizeof(uint64_t), "validity_t should be 64-bit");
 
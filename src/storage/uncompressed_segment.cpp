@@ -12,6 +12,8 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 
 namespace duckdb {
 
@@ -37,6 +39,15 @@ void UncompressedSegment::Verify() {
 #endif
 }
 
+void UncompressedSegment::ScanVector(ColumnScanState &state, idx_t start, idx_t scan_count, Vector &result) {
+	if (result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		// the result was already emitted as a constant or dictionary vector (e.g. by the data segment of a column
+		// while we are scanning its validity): flatten it before writing into it
+		result.Normalify(scan_count);
+	}
+	Scan(state, start, scan_count, result, 0);
+}
+
 bool UncompressedSegment::RowIdIsValid(idx_t row_id) const {
 	return row_id <= tuple_count;
 }
@@ -275,6 +286,12 @@ void UncompressedSegment::FilterSelection(SelectionVector &sel, Vector &result,
 	case TableFilterType::IS_NOT_NULL:
 		TemplatedNullSelection<false>(sel, approved_tuple_count, mask);
 		break;
+	case TableFilterType::BLOOM_FILTER:
+		((const BloomFilter &)filter).Select(result, sel, approved_tuple_count, mask);
+		break;
+	case TableFilterType::DYNAMIC_FILTER:
+		((const DynamicFilter &)filter).Select(result, sel, approved_tuple_count, mask);
+		break;
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -23,3 +23,41 @@ TEST_CASE("Test query profiler", "[api]") {
 	output = con.GetProfilingInformation(ProfilerPrintFormat::JSON);
 	REQUIRE(output.size() > 0);
 }
+
+//! Returns the cardinality of the sequential scan of the given table in the JSON profiling output
+static idx_t GetScanCardinality(const string &json, const string &table) {
+	idx_t position = 0;
+	while ((position = json.find("\"name\": \"SEQ_SCAN\"", position)) != string::npos) {
+		auto cardinality = json.find("\"cardinality\":", position);
+		auto extra_info = json.find("\"extra_info\": \"", position);
+		REQUIRE(cardinality != string::npos);
+		REQUIRE(extra_info != string::npos);
+		position = extra_info;
+		if (json.compare(extra_info + 15, table.size(), table) == 0) {
+			return std::stoull(json.substr(cardinality + 14));
+		}
+	}
+	FAIL("no scan of " + table + " in the profiling output");
+	return 0;
+}
+
+TEST_CASE("Test that runtime join filters prune the probe side scan", "[api]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE fact AS SELECT i % 1000 AS d1, i AS v FROM range(0, 1000000) tbl(i)"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE dim1 AS SELECT i AS d1, i % 10 AS category FROM range(0, 1000) tbl(i)"));
+	con.EnableProfiling();
+
+	// the dimension predicate is not on the join key, so only the runtime filters can prune the fact table
+	auto result = con.Query("SELECT COUNT(*) FROM fact JOIN dim1 USING (d1) WHERE dim1.category = 3");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(100000)}));
+	auto filtered_rows = GetScanCardinality(con.GetProfilingInformation(ProfilerPrintFormat::JSON), "fact");
+	REQUIRE(filtered_rows >= 100000);
+	REQUIRE(filtered_rows < 200000);
+
+	// a left join keeps every probe row, so nothing is pruned
+	result = con.Query("SELECT COUNT(*) FROM fact LEFT JOIN (SELECT * FROM dim1 WHERE category = 3) d USING (d1)");
+	REQUIRE(CHECK_COLUMN(result, 0, {Value::BIGINT(1000000)}));
+	REQUIRE(GetScanCardinality(con.GetProfilingInformation(ProfilerPrintFormat::JSON), "fact") == 1000000);
+}
@@ -0,0 +1,84 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace duckdb;
+using namespace std;
+
+#define TINY_PIPELINES_THREAD_COUNT 8
+#define TINY_PIPELINES_QUERY_COUNT 50
+#define TINY_PIPELINES_UNION_COUNT 16
+
+static string TinyPipelinesQuery() {
+	// every branch of the UNION ALL is a separate pipeline; the dependent pipelines are scheduled by the background
+	// thread that finishes the last task of the pipeline they depend on, so idle threads have to steal them
+	string query = "SELECT SUM(s) FROM (";
+	for (idx_t i = 0; i < TINY_PIPELINES_UNION_COUNT; i++) {
+		if (i > 0) {
+			query += " UNION ALL ";
+		}
+		query += "SELECT SUM(i) AS s FROM integers";
+	}
+	return query + ") tbl";
+}
+
+static void RunTinyPipelines(DuckDB *db, bool *correct) {
+	Connection con(*db);
+	auto query = TinyPipelinesQuery();
+	*correct = true;
+	for (idx_t i = 0; i < TINY_PIPELINES_QUERY_COUNT; i++) {
+		auto result = con.Query(query);
+		if (!CHECK_COLUMN(result, 0, {TINY_PIPELINES_UNION_COUNT * 4950})) {
+			*correct = false;
+		}
+	}
+}
+
+TEST_CASE("Test many tiny concurrent pipelines on the work-stealing scheduler", "[interquery][.]") {
+	DuckDB db(nullptr);
+	Connection con(db);
+	auto &scheduler = TaskScheduler::GetScheduler(*con.context);
+
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT i FROM range(0, 100) tbl(i)"));
+
+	// a single connection: the dependent pipelines are scheduled from the background threads and stolen
+	auto query = TinyPipelinesQuery();
+	for (idx_t i = 0; i < 1000 && scheduler.GetStolenTaskCount() == 0; i++) {
+		auto result = con.Query(query);
+		REQUIRE(CHECK_COLUMN(result, 0, {TINY_PIPELINES_UNION_COUNT * 4950}));
+	}
+	REQUIRE(scheduler.GetStolenTaskCount() > 0);
+
+	// many connections running tiny pipelines at the same time
+	bool correct[TINY_PIPELINES_THREAD_COUNT];
+	thread threads[TINY_PIPELINES_THREAD_COUNT];
+	for (idx_t i = 0; i < TINY_PIPELINES_THREAD_COUNT; i++) {
+		threads[i] = thread(RunTinyPipelines, &db, correct + i);
+	}
+	for (idx_t i = 0; i < TINY_PIPELINES_THREAD_COUNT; i++) {
+		threads[i].join();
+		REQUIRE(correct[i]);
+	}
+
+	// stop and restart background threads while the connections are running queries: the tasks left in the queues
+	// of the stopped threads are handed over to the remaining threads
+	for (idx_t i = 0; i < TINY_PIPELINES_THREAD_COUNT; i++) {
+		threads[i] = thread(RunTinyPipelines, &db, correct + i);
+	}
+	for (idx_t i = 0; i < 20; i++) {
+		REQUIRE_NO_FAIL(con.Query("PRAGMA threads=" + to_string(1 + i % 4)));
+	}
+	for (idx_t i = 0; i < TINY_PIPELINES_THREAD_COUNT; i++) {
+		threads[i].join();
+		REQUIRE(correct[i]);
+	}
+	REQUIRE_NO_FAIL(con.Query("PRAGMA threads=4"));
+	auto result = con.Query(query);
+	REQUIRE(CHECK_COLUMN(result, 0, {TINY_PIPELINES_UNION_COUNT * 4950}));
+	// the database (and with it the scheduler) is destroyed while the background threads are sleeping
+}
@@ -6,6 +6,7 @@
 %expect 0
 %name-prefix="base_yy"
 %locations
+%define api.header.include {"parser/gram.hpp"}
 
 %parse-param {core_yyscan_t yyscanner}
 %lex-param   {core_yyscan_t yyscanner}
@@ -156,7 +157,7 @@
  * They wouldn't be given a precedence at all, were it not that we need
  * left-associativity among the JOIN rules themselves.
  */
-%left		JOIN CROSS LEFT FULL RIGHT INNER_P NATURAL
+%left		JOIN CROSS LEFT FULL RIGHT INNER_P NATURAL ASOF
 /* kluge to keep from causing shift/reduce conflicts */
 %right		PRESERVE STRIP_P
 
@@ -839,6 +839,8 @@ table_ref:	relation_expr opt_alias_clause opt_tablesample_clause
  * A NATURAL JOIN implicitly matches column names between
  * tables and the shape is determined by which columns are
  * in common. We'll collect columns during the later transformations.
+ * An ASOF JOIN matches every row with the closest row of the other
+ * table on the single inequality of its condition.
  */
 
 joined_table:
@@ -888,6 +890,37 @@ joined_table:
 					n->location = @2;
 					$$ = n;
 				}
+			| table_ref ASOF join_type JOIN table_ref join_qual
+				{
+					PGJoinExpr *n = makeNode(PGJoinExpr);
+					n->jointype = $3;
+					n->isNatural = false;
+					n->isAsof = true;
+					n->larg = $1;
+					n->rarg = $5;
+					if ($6 != NULL && IsA($6, PGList))
+						n->usingClause = (PGList *) $6; /* USING clause */
+					else
+						n->quals = $6; /* ON clause */
+					n->location = @2;
+					$$ = n;
+				}
+			| table_ref ASOF JOIN table_ref join_qual
+				{
+					/* letting join_type reduce to empty doesn't work */
+					PGJoinExpr *n = makeNode(PGJoinExpr);
+					n->jointype = PG_JOIN_INNER;
+					n->isNatural = false;
+					n->isAsof = true;
+					n->larg = $1;
+					n->rarg = $4;
+					if ($5 != NULL && IsA($5, PGList))
+						n->usingClause = (PGList *) $5; /* USING clause */
+					else
+						n->quals = $5; /* ON clause */
+					n->location = @2;
+					$$ = n;
+				}
 			| table_ref NATURAL join_type JOIN table_ref
 				{
 					PGJoinExpr *n = makeNode(PGJoinExpr);
@@ -1338,6 +1338,7 @@ typedef struct PGJoinExpr {
 	PGNodeTag type;
 	PGJoinType jointype; /* type of join */
 	bool isNatural;      /* Natural join? Will need to shape table */
+	bool isAsof;         /* AsOf join? Matches the closest row on the inequality */
 	PGNode *larg;        /* left subtree */
 	PGNode *rarg;        /* right subtree */
 	PGList *usingClause; /* USING clause, if any (list of String) */
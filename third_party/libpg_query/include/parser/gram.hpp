@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton interface for Bison's Yacc-like parsers in C
+/* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,967 +31,512 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
-/* Tokens.  */
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_BASE_YY_THIRD_PARTY_LIBPG_QUERY_GRAMMAR_GRAMMAR_OUT_HPP_INCLUDED
+# define YY_BASE_YY_THIRD_PARTY_LIBPG_QUERY_GRAMMAR_GRAMMAR_OUT_HPP_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int base_yydebug;
+#endif
+
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     IDENT = 258,
-     FCONST = 259,
-     SCONST = 260,
-     BCONST = 261,
-     XCONST = 262,
-     Op = 263,
-     ICONST = 264,
-     PARAM = 265,
-     TYPECAST = 266,
-     DOT_DOT = 267,
-     COLON_EQUALS = 268,
-     EQUALS_GREATER = 269,
-     LAMBDA_ARROW = 270,
-     LESS_EQUALS = 271,
-     GREATER_EQUALS = 272,
-     NOT_EQUALS = 273,
-     ABORT_P = 274,
-     ABSOLUTE_P = 275,
-     ACCESS = 276,
-     ACTION = 277,
-     ADD_P = 278,
-     ADMIN = 279,
-     AFTER = 280,
-     AGGREGATE = 281,
-     ALL = 282,
-     ALSO = 283,
-     ALTER = 284,
-     ALWAYS = 285,
-     ANALYSE = 286,
-     ANALYZE = 287,
-     AND = 288,
-     ANY = 289,
-     ARRAY = 290,
-     AS = 291,
-     ASC_P = 292,
-     ASSERTION = 293,
-     ASSIGNMENT = 294,
-     ASYMMETRIC = 295,
-     AT = 296,
-     ATTACH = 297,
-     ATTRIBUTE = 298,
-     AUTHORIZATION = 299,
-     BACKWARD = 300,
-     BEFORE = 301,
-     BEGIN_P = 302,
-     BETWEEN = 303,
-     BIGINT = 304,
-     BINARY = 305,
-     BIT = 306,
-     BOOLEAN_P = 307,
-     BOTH = 308,
-     BY = 309,
-     CACHE = 310,
-     CALL_P = 311,
-     CALLED = 312,
-     CASCADE = 313,
-     CASCADED = 314,
-     CASE = 315,
-     CAST = 316,
-     CATALOG_P = 317,
-     CHAIN = 318,
-     CHAR_P = 319,
-     CHARACTER = 320,
-     CHARACTERISTICS = 321,
-     CHECK_P = 322,
-     CHECKPOINT = 323,
-     CLASS = 324,
-     CLOSE = 325,
-     CLUSTER = 326,
-     COALESCE = 327,
-     COLLATE = 328,
-     COLLATION = 329,
-     COLUMN = 330,
-     COLUMNS = 331,
-     COMMENT = 332,
-     COMMENTS = 333,
-     COMMIT = 334,
-     COMMITTED = 335,
-     CONCURRENTLY = 336,
-     CONFIGURATION = 337,
-     CONFLICT = 338,
-     CONNECTION = 339,
-     CONSTRAINT = 340,
-     CONSTRAINTS = 341,
-     CONTENT_P = 342,
-     CONTINUE_P = 343,
-     CONVERSION_P = 344,
-     COPY = 345,
-     COST = 346,
-     CREATE_P = 347,
-     CROSS = 348,
-     CSV = 349,
-     CUBE = 350,
-     CURRENT_P = 351,
-     CURRENT_CATALOG = 352,
-     CURRENT_DATE = 353,
-     CURRENT_ROLE = 354,
-     CURRENT_SCHEMA = 355,
-     CURRENT_TIME = 356,
-     CURRENT_TIMESTAMP = 357,
-     CURRENT_USER = 358,
-     CURSOR = 359,
-     CYCLE = 360,
-     DATA_P = 361,
-     DATABASE = 362,
-     DAY_P = 363,
-     DAYS_P = 364,
-     DEALLOCATE = 365,
-     DEC = 366,
-     DECIMAL_P = 367,
-     DECLARE = 368,
-     DEFAULT = 369,
-     DEFAULTS = 370,
-     DEFERRABLE = 371,
-     DEFERRED = 372,
-     DEFINER = 373,
-     DELETE_P = 374,
-     DELIMITER = 375,
-     DELIMITERS = 376,
-     DEPENDS = 377,
-     DESC_P = 378,
-     DESCRIBE = 379,
-     DETACH = 380,
-     DICTIONARY = 381,
-     DISABLE_P = 382,
-     DISCARD = 383,
-     DISTINCT = 384,
-     DO = 385,
-     DOCUMENT_P = 386,
-     DOMAIN_P = 387,
-     DOUBLE_P = 388,
-     DROP = 389,
-     EACH = 390,
-     ELSE = 391,
-     ENABLE_P = 392,
-     ENCODING = 393,
-     ENCRYPTED = 394,
-     END_P = 395,
-     ENUM_P = 396,
-     ESCAPE = 397,
-     EVENT = 398,
-     EXCEPT = 399,
-     EXCLUDE = 400,
-     EXCLUDING = 401,
-     EXCLUSIVE = 402,
-     EXECUTE = 403,
-     EXISTS = 404,
-     EXPLAIN = 405,
-     EXPORT_P = 406,
-     EXTENSION = 407,
-     EXTERNAL = 408,
-     EXTRACT = 409,
-     FALSE_P = 410,
-     FAMILY = 411,
-     FETCH = 412,
-     FILTER = 413,
-     FIRST_P = 414,
-     FLOAT_P = 415,
-     FOLLOWING = 416,
-     FOR = 417,
-     FORCE = 418,
-     FOREIGN = 419,
-     FORWARD = 420,
-     FREEZE = 421,
-     FROM = 422,
-     FULL = 423,
-     FUNCTION = 424,
-     FUNCTIONS = 425,
-     GENERATED = 426,
-     GLOB = 427,
-     GLOBAL = 428,
-     GRANT = 429,
-     GRANTED = 430,
-     GROUP_P = 431,
-     GROUPING = 432,
-     HANDLER = 433,
-     HAVING = 434,
-     HEADER_P = 435,
-     HOLD = 436,
-     HOUR_P = 437,
-     HOURS_P = 438,
-     IDENTITY_P = 439,
-     IF_P = 440,
-     ILIKE = 441,
-     IMMEDIATE = 442,
-     IMMUTABLE = 443,
-     IMPLICIT_P = 444,
-     IMPORT_P = 445,
-     IN_P = 446,
-     INCLUDING = 447,
-     INCREMENT = 448,
-     INDEX = 449,
-     INDEXES = 450,
-     INHERIT = 451,
-     INHERITS = 452,
-     INITIALLY = 453,
-     INLINE_P = 454,
-     INNER_P = 455,
-     INOUT = 456,
-     INPUT_P = 457,
-     INSENSITIVE = 458,
-     INSERT = 459,
-     INSTEAD = 460,
-     INT_P = 461,
-     INTEGER = 462,
-     INTERSECT = 463,
-     INTERVAL = 464,
-     INTO = 465,
-     INVOKER = 466,
-     IS = 467,
-     ISNULL = 468,
-     ISOLATION = 469,
-     JOIN = 470,
-     KEY = 471,
-     LABEL = 472,
-     LANGUAGE = 473,
-     LARGE_P = 474,
-     LAST_P = 475,
-     LATERAL_P = 476,
-     LEADING = 477,
-     LEAKPROOF = 478,
-     LEFT = 479,
-     LEVEL = 480,
-     LIKE = 481,
-     LIMIT = 482,
-     LISTEN = 483,
-     LOAD = 484,
-     LOCAL = 485,
-     LOCALTIME = 486,
-     LOCALTIMESTAMP = 487,
-     LOCATION = 488,
-     LOCK_P = 489,
-     LOCKED = 490,
-     LOGGED = 491,
-     MACRO = 492,
-     MAP = 493,
-     MAPPING = 494,
-     MATCH = 495,
-     MATERIALIZED = 496,
-     MAXVALUE = 497,
-     METHOD = 498,
-     MICROSECOND_P = 499,
-     MICROSECONDS_P = 500,
-     MILLISECOND_P = 501,
-     MILLISECONDS_P = 502,
-     MINUTE_P = 503,
-     MINUTES_P = 504,
-     MINVALUE = 505,
-     MODE = 506,
-     MONTH_P = 507,
-     MONTHS_P = 508,
-     MOVE = 509,
-     NAME_P = 510,
-     NAMES = 511,
-     NATIONAL = 512,
-     NATURAL = 513,
-     NCHAR = 514,
-     NEW = 515,
-     NEXT = 516,
-     NO = 517,
-     NONE = 518,
-     NOT = 519,
-     NOTHING = 520,
-     NOTIFY = 521,
-     NOTNULL = 522,
-     NOWAIT = 523,
-     NULL_P = 524,
-     NULLIF = 525,
-     NULLS_P = 526,
-     NUMERIC = 527,
-     OBJECT_P = 528,
-     OF = 529,
-     OFF = 530,
-     OFFSET = 531,
-     OIDS = 532,
-     OLD = 533,
-     ON = 534,
-     ONLY = 535,
-     OPERATOR = 536,
-     OPTION = 537,
-     OPTIONS = 538,
-     OR = 539,
-     ORDER = 540,
-     ORDINALITY = 541,
-     OUT_P = 542,
-     OUTER_P = 543,
-     OVER = 544,
-     OVERLAPS = 545,
-     OVERLAY = 546,
-     OVERRIDING = 547,
-     OWNED = 548,
-     OWNER = 549,
-     PARALLEL = 550,
-     PARSER = 551,
-     PARTIAL = 552,
-     PARTITION = 553,
-     PASSING = 554,
-     PASSWORD = 555,
-     PERCENT = 556,
-     PLACING = 557,
-     PLANS = 558,
-     POLICY = 559,
-     POSITION = 560,
-     PRAGMA_P = 561,
-     PRECEDING = 562,
-     PRECISION = 563,
-     PREPARE = 564,
-     PREPARED = 565,
-     PRESERVE = 566,
-     PRIMARY = 567,
-     PRIOR = 568,
-     PRIVILEGES = 569,
-     PROCEDURAL = 570,
-     PROCEDURE = 571,
-     PROGRAM = 572,
-     PUBLICATION = 573,
-     QUOTE = 574,
-     RANGE = 575,
-     READ_P = 576,
-     REAL = 577,
-     REASSIGN = 578,
-     RECHECK = 579,
-     RECURSIVE = 580,
-     REF = 581,
-     REFERENCES = 582,
-     REFERENCING = 583,
-     REFRESH = 584,
-     REINDEX = 585,
-     RELATIVE_P = 586,
-     RELEASE = 587,
-     RENAME = 588,
-     REPEATABLE = 589,
-     REPLACE = 590,
-     REPLICA = 591,
-     RESET = 592,
-     RESTART = 593,
-     RESTRICT = 594,
-     RETURNING = 595,
-     RETURNS = 596,
-     REVOKE = 597,
-     RIGHT = 598,
-     ROLE = 599,
-     ROLLBACK = 600,
-     ROLLUP = 601,
-     ROW = 602,
-     ROWS = 603,
-     RULE = 604,
-     SAMPLE = 605,
-     SAVEPOINT = 606,
-     SCHEMA = 607,
-     SCHEMAS = 608,
-     SCROLL = 609,
-     SEARCH = 610,
-     SECOND_P = 611,
-     SECONDS_P = 612,
-     SECURITY = 613,
-     SELECT = 614,
-     SEQUENCE = 615,
-     SEQUENCES = 616,
-     SERIALIZABLE = 617,
-     SERVER = 618,
-     SESSION = 619,
-     SESSION_USER = 620,
-     SET = 621,
-     SETOF = 622,
-     SETS = 623,
-     SHARE = 624,
-     SHOW = 625,
-     SIMILAR = 626,
-     SIMPLE = 627,
-     SKIP = 628,
-     SMALLINT = 629,
-     SNAPSHOT = 630,
-     SOME = 631,
-     SQL_P = 632,
-     STABLE = 633,
-     STANDALONE_P = 634,
-     START = 635,
-     STATEMENT = 636,
-     STATISTICS = 637,
-     STDIN = 638,
-     STDOUT = 639,
-     STORAGE = 640,
-     STRICT_P = 641,
-     STRIP_P = 642,
-     STRUCT = 643,
-     SUBSCRIPTION = 644,
-     SUBSTRING = 645,
-     SYMMETRIC = 646,
-     SYSID = 647,
-     SYSTEM_P = 648,
-     TABLE = 649,
-     TABLES = 650,
-     TABLESAMPLE = 651,
-     TABLESPACE = 652,
-     TEMP = 653,
-     TEMPLATE = 654,
-     TEMPORARY = 655,
-     TEXT_P = 656,
-     THEN = 657,
-     TIME = 658,
-     TIMESTAMP = 659,
-     TO = 660,
-     TRAILING = 661,
-     TRANSACTION = 662,
-     TRANSFORM = 663,
-     TREAT = 664,
-     TRIGGER = 665,
-     TRIM = 666,
-     TRUE_P = 667,
-     TRUNCATE = 668,
-     TRUSTED = 669,
-     TRY_CAST = 670,
-     TYPE_P = 671,
-     TYPES_P = 672,
-     UNBOUNDED = 673,
-     UNCOMMITTED = 674,
-     UNENCRYPTED = 675,
-     UNION = 676,
-     UNIQUE = 677,
-     UNKNOWN = 678,
-     UNLISTEN = 679,
-     UNLOGGED = 680,
-     UNTIL = 681,
-     UPDATE = 682,
-     USER = 683,
-     USING = 684,
-     VACUUM = 685,
-     VALID = 686,
-     VALIDATE = 687,
-     VALIDATOR = 688,
-     VALUE_P = 689,
-     VALUES = 690,
-     VARCHAR = 691,
-     VARIADIC = 692,
-     VARYING = 693,
-     VERBOSE = 694,
-     VERSION_P = 695,
-     VIEW = 696,
-     VIEWS = 697,
-     VOLATILE = 698,
-     WHEN = 699,
-     WHERE = 700,
-     WHITESPACE_P = 701,
-     WINDOW = 702,
-     WITH = 703,
-     WITHIN = 704,
-     WITHOUT = 705,
-     WORK = 706,
-     WRAPPER = 707,
-     WRITE_P = 708,
-     XML_P = 709,
-     XMLATTRIBUTES = 710,
-     XMLCONCAT = 711,
-     XMLELEMENT = 712,
-     XMLEXISTS = 713,
-     XMLFOREST = 714,
-     XMLNAMESPACES = 715,
-     XMLPARSE = 716,
-     XMLPI = 717,
-     XMLROOT = 718,
-     XMLSERIALIZE = 719,
-     XMLTABLE = 720,
-     YEAR_P = 721,
-     YEARS_P = 722,
-     YES_P = 723,
-     ZONE = 724,
-     NOT_LA = 725,
-     NULLS_LA = 726,
-     WITH_LA = 727,
-     POSTFIXOP = 728,
-     UMINUS = 729
-   };
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    IDENT = 258,                   /* IDENT  */
+    FCONST = 259,                  /* FCONST  */
+    SCONST = 260,                  /* SCONST  */
+    BCONST = 261,                  /* BCONST  */
+    XCONST = 262,                  /* XCONST  */
+    Op = 263,                      /* Op  */
+    ICONST = 264,                  /* ICONST  */
+    PARAM = 265,                   /* PARAM  */
+    TYPECAST = 266,                /* TYPECAST  */
+    DOT_DOT = 267,                 /* DOT_DOT  */
+    COLON_EQUALS = 268,            /* COLON_EQUALS  */
+    EQUALS_GREATER = 269,          /* EQUALS_GREATER  */
+    LAMBDA_ARROW = 270,            /* LAMBDA_ARROW  */
+    LESS_EQUALS = 271,             /* LESS_EQUALS  */
+    GREATER_EQUALS = 272,          /* GREATER_EQUALS  */
+    NOT_EQUALS = 273,              /* NOT_EQUALS  */
+    ABORT_P = 274,                 /* ABORT_P  */
+    ABSOLUTE_P = 275,              /* ABSOLUTE_P  */
+    ACCESS = 276,                  /* ACCESS  */
+    ACTION = 277,                  /* ACTION  */
+    ADD_P = 278,                   /* ADD_P  */
+    ADMIN = 279,                   /* ADMIN  */
+    AFTER = 280,                   /* AFTER  */
+    AGGREGATE = 281,               /* AGGREGATE  */
+    ALL = 282,                     /* ALL  */
+    ALSO = 283,                    /* ALSO  */
+    ALTER = 284,                   /* ALTER  */
+    ALWAYS = 285,                  /* ALWAYS  */
+    ANALYSE = 286,                 /* ANALYSE  */
+    ANALYZE = 287,                 /* ANALYZE  */
+    AND = 288,                     /* AND  */
+    ANY = 289,                     /* ANY  */
+    ARRAY = 290,                   /* ARRAY  */
+    AS = 291,                      /* AS  */
+    ASC_P = 292,                   /* ASC_P  */
+    ASOF = 293,                    /* ASOF  */
+    ASSERTION = 294,               /* ASSERTION  */
+    ASSIGNMENT = 295,              /* ASSIGNMENT  */
+    ASYMMETRIC = 296,              /* ASYMMETRIC  */
+    AT = 297,                      /* AT  */
+    ATTACH = 298,                  /* ATTACH  */
+    ATTRIBUTE = 299,               /* ATTRIBUTE  */
+    AUTHORIZATION = 300,           /* AUTHORIZATION  */
+    BACKWARD = 301,                /* BACKWARD  */
+    BEFORE = 302,                  /* BEFORE  */
+    BEGIN_P = 303,                 /* BEGIN_P  */
+    BETWEEN = 304,                 /* BETWEEN  */
+    BIGINT = 305,                  /* BIGINT  */
+    BINARY = 306,                  /* BINARY  */
+    BIT = 307,                     /* BIT  */
+    BOOLEAN_P = 308,               /* BOOLEAN_P  */
+    BOTH = 309,                    /* BOTH  */
+    BY = 310,                      /* BY  */
+    CACHE = 311,                   /* CACHE  */
+    CALL_P = 312,                  /* CALL_P  */
+    CALLED = 313,                  /* CALLED  */
+    CASCADE = 314,                 /* CASCADE  */
+    CASCADED = 315,                /* CASCADED  */
+    CASE = 316,                    /* CASE  */
+    CAST = 317,                    /* CAST  */
+    CATALOG_P = 318,               /* CATALOG_P  */
+    CHAIN = 319,                   /* CHAIN  */
+    CHAR_P = 320,                  /* CHAR_P  */
+    CHARACTER = 321,               /* CHARACTER  */
+    CHARACTERISTICS = 322,         /* CHARACTERISTICS  */
+    CHECK_P = 323,                 /* CHECK_P  */
+    CHECKPOINT = 324,              /* CHECKPOINT  */
+    CLASS = 325,                   /* CLASS  */
+    CLOSE = 326,                   /* CLOSE  */
+    CLUSTER = 327,                 /* CLUSTER  */
+    COALESCE = 328,                /* COALESCE  */
+    COLLATE = 329,                 /* COLLATE  */
+    COLLATION = 330,               /* COLLATION  */
+    COLUMN = 331,                  /* COLUMN  */
+    COLUMNS = 332,                 /* COLUMNS  */
+    COMMENT = 333,                 /* COMMENT  */
+    COMMENTS = 334,                /* COMMENTS  */
+    COMMIT = 335,                  /* COMMIT  */
+    COMMITTED = 336,               /* COMMITTED  */
+    CONCURRENTLY = 337,            /* CONCURRENTLY  */
+    CONFIGURATION = 338,           /* CONFIGURATION  */
+    CONFLICT = 339,                /* CONFLICT  */
+    CONNECTION = 340,              /* CONNECTION  */
+    CONSTRAINT = 341,              /* CONSTRAINT  */
+    CONSTRAINTS = 342,             /* CONSTRAINTS  */
+    CONTENT_P = 343,               /* CONTENT_P  */
+    CONTINUE_P = 344,              /* CONTINUE_P  */
+    CONVERSION_P = 345,            /* CONVERSION_P  */
+    COPY = 346,                    /* COPY  */
+    COST = 347,                    /* COST  */
+    CREATE_P = 348,                /* CREATE_P  */
+    CROSS = 349,                   /* CROSS  */
+    CSV = 350,                     /* CSV  */
+    CUBE = 351,                    /* CUBE  */
+    CURRENT_P = 352,               /* CURRENT_P  */
+    CURRENT_CATALOG = 353,         /* CURRENT_CATALOG  */
+    CURRENT_DATE = 354,            /* CURRENT_DATE  */
+    CURRENT_ROLE = 355,            /* CURRENT_ROLE  */
+    CURRENT_SCHEMA = 356,          /* CURRENT_SCHEMA  */
+    CURRENT_TIME = 357,            /* CURRENT_TIME  */
+    CURRENT_TIMESTAMP = 358,       /* CURRENT_TIMESTAMP  */
+    CURRENT_USER = 359,            /* CURRENT_USER  */
+    CURSOR = 360,                  /* CURSOR  */
+    CYCLE = 361,                   /* CYCLE  */
+    DATA_P = 362,                  /* DATA_P  */
+    DATABASE = 363,                /* DATABASE  */
+    DAY_P = 364,                   /* DAY_P  */
+    DAYS_P = 365,                  /* DAYS_P  */
+    DEALLOCATE = 366,              /* DEALLOCATE  */
+    DEC = 367,                     /* DEC  */
+    DECIMAL_P = 368,               /* DECIMAL_P  */
+    DECLARE = 369,                 /* DECLARE  */
+    DEFAULT = 370,                 /* DEFAULT  */
+    DEFAULTS = 371,                /* DEFAULTS  */
+    DEFERRABLE = 372,              /* DEFERRABLE  */
+    DEFERRED = 373,                /* DEFERRED  */
+    DEFINER = 374,                 /* DEFINER  */
+    DELETE_P = 375,                /* DELETE_P  */
+    DELIMITER = 376,               /* DELIMITER  */
+    DELIMITERS = 377,              /* DELIMITERS  */
+    DEPENDS = 378,                 /* DEPENDS  */
+    DESC_P = 379,                  /* DESC_P  */
+    DESCRIBE = 380,                /* DESCRIBE  */
+    DETACH = 381,                  /* DETACH  */
+    DICTIONARY = 382,              /* DICTIONARY  */
+    DISABLE_P = 383,               /* DISABLE_P  */
+    DISCARD = 384,                 /* DISCARD  */
+    DISTINCT = 385,                /* DISTINCT  */
+    DO = 386,                      /* DO  */
+    DOCUMENT_P = 387,              /* DOCUMENT_P  */
+    DOMAIN_P = 388,                /* DOMAIN_P  */
+    DOUBLE_P = 389,                /* DOUBLE_P  */
+    DROP = 390,                    /* DROP  */
+    EACH = 391,                    /* EACH  */
+    ELSE = 392,                    /* ELSE  */
+    ENABLE_P = 393,                /* ENABLE_P  */
+    ENCODING = 394,                /* ENCODING  */
+    ENCRYPTED = 395,               /* ENCRYPTED  */
+    END_P = 396,                   /* END_P  */
+    ENUM_P = 397,                  /* ENUM_P  */
+    ESCAPE = 398,                  /* ESCAPE  */
+    EVENT = 399,                   /* EVENT  */
+    EXCEPT = 400,                  /* EXCEPT  */
+    EXCLUDE = 401,                 /* EXCLUDE  */
+    EXCLUDING = 402,               /* EXCLUDING  */
+    EXCLUSIVE = 403,               /* EXCLUSIVE  */
+    EXECUTE = 404,                 /* EXECUTE  */
+    EXISTS = 405,                  /* EXISTS  */
+    EXPLAIN = 406,                 /* EXPLAIN  */
+    EXPORT_P = 407,                /* EXPORT_P  */
+    EXTENSION = 408,               /* EXTENSION  */
+    EXTERNAL = 409,                /* EXTERNAL  */
+    EXTRACT = 410,                 /* EXTRACT  */
+    FALSE_P = 411,                 /* FALSE_P  */
+    FAMILY = 412,                  /* FAMILY  */
+    FETCH = 413,                   /* FETCH  */
+    FILTER = 414,                  /* FILTER  */
+    FIRST_P = 415,                 /* FIRST_P  */
+    FLOAT_P = 416,                 /* FLOAT_P  */
+    FOLLOWING = 417,               /* FOLLOWING  */
+    FOR = 418,                     /* FOR  */
+    FORCE = 419,                   /* FORCE  */
+    FOREIGN = 420,                 /* FOREIGN  */
+    FORWARD = 421,                 /* FORWARD  */
+    FREEZE = 422,                  /* FREEZE  */
+    FROM = 423,                    /* FROM  */
+    FULL = 424,                    /* FULL  */
+    FUNCTION = 425,                /* FUNCTION  */
+    FUNCTIONS = 426,               /* FUNCTIONS  */
+    GENERATED = 427,               /* GENERATED  */
+    GLOB = 428,                    /* GLOB  */
+    GLOBAL = 429,                  /* GLOBAL  */
+    GRANT = 430,                   /* GRANT  */
+    GRANTED = 431,                 /* GRANTED  */
+    GROUP_P = 432,                 /* GROUP_P  */
+    GROUPING = 433,                /* GROUPING  */
+    HANDLER = 434,                 /* HANDLER  */
+    HAVING = 435,                  /* HAVING  */
+    HEADER_P = 436,                /* HEADER_P  */
+    HOLD = 437,                    /* HOLD  */
+    HOUR_P = 438,                  /* HOUR_P  */
+    HOURS_P = 439,                 /* HOURS_P  */
+    IDENTITY_P = 440,              /* IDENTITY_P  */
+    IF_P = 441,                    /* IF_P  */
+    ILIKE = 442,                   /* ILIKE  */
+    IMMEDIATE = 443,               /* IMMEDIATE  */
+    IMMUTABLE = 444,               /* IMMUTABLE  */
+    IMPLICIT_P = 445,              /* IMPLICIT_P  */
+    IMPORT_P = 446,                /* IMPORT_P  */
+    IN_P = 447,                    /* IN_P  */
+    INCLUDING = 448,               /* INCLUDING  */
+    INCREMENT = 449,               /* INCREMENT  */
+    INDEX = 450,                   /* INDEX  */
+    INDEXES = 451,                 /* INDEXES  */
+    INHERIT = 452,                 /* INHERIT  */
+    INHERITS = 453,                /* INHERITS  */
+    INITIALLY = 454,               /* INITIALLY  */
+    INLINE_P = 455,                /* INLINE_P  */
+    INNER_P = 456,                 /* INNER_P  */
+    INOUT = 457,                   /* INOUT  */
+    INPUT_P = 458,                 /* INPUT_P  */
+    INSENSITIVE = 459,             /* INSENSITIVE  */
+    INSERT = 460,                  /* INSERT  */
+    INSTEAD = 461,                 /* INSTEAD  */
+    INT_P = 462,                   /* INT_P  */
+    INTEGER = 463,                 /* INTEGER  */
+    INTERSECT = 464,               /* INTERSECT  */
+    INTERVAL = 465,                /* INTERVAL  */
+    INTO = 466,                    /* INTO  */
+    INVOKER = 467,                 /* INVOKER  */
+    IS = 468,                      /* IS  */
+    ISNULL = 469,                  /* ISNULL  */
+    ISOLATION = 470,               /* ISOLATION  */
+    JOIN = 471,                    /* JOIN  */
+    KEY = 472,                     /* KEY  */
+    LABEL = 473,                   /* LABEL  */
+    LANGUAGE = 474,                /* LANGUAGE  */
+    LARGE_P = 475,                 /* LARGE_P  */
+    LAST_P = 476,                  /* LAST_P  */
+    LATERAL_P = 477,               /* LATERAL_P  */
+    LEADING = 478,                 /* LEADING  */
+    LEAKPROOF = 479,               /* LEAKPROOF  */
+    LEFT = 480,                    /* LEFT  */
+    LEVEL = 481,                   /* LEVEL  */
+    LIKE = 482,                    /* LIKE  */
+    LIMIT = 483,                   /* LIMIT  */
+    LISTEN = 484,                  /* LISTEN  */
+    LOAD = 485,                    /* LOAD  */
+    LOCAL = 486,                   /* LOCAL  */
+    LOCALTIME = 487,               /* LOCALTIME  */
+    LOCALTIMESTAMP = 488,          /* LOCALTIMESTAMP  */
+    LOCATION = 489,                /* LOCATION  */
+    LOCK_P = 490,                  /* LOCK_P  */
+    LOCKED = 491,                  /* LOCKED  */
+    LOGGED = 492,                  /* LOGGED  */
+    MACRO = 493,                   /* MACRO  */
+    MAP = 494,                     /* MAP  */
+    MAPPING = 495,                 /* MAPPING  */
+    MATCH = 496,                   /* MATCH  */
+    MATERIALIZED = 497,            /* MATERIALIZED  */
+    MAXVALUE = 498,                /* MAXVALUE  */
+    METHOD = 499,                  /* METHOD  */
+    MICROSECOND_P = 500,           /* MICROSECOND_P  */
+    MICROSECONDS_P = 501,          /* MICROSECONDS_P  */
+    MILLISECOND_P = 502,           /* MILLISECOND_P  */
+    MILLISECONDS_P = 503,          /* MILLISECONDS_P  */
+    MINUTE_P = 504,                /* MINUTE_P  */
+    MINUTES_P = 505,               /* MINUTES_P  */
+    MINVALUE = 506,                /* MINVALUE  */
+    MODE = 507,                    /* MODE  */
+    MONTH_P = 508,                 /* MONTH_P  */
+    MONTHS_P = 509,                /* MONTHS_P  */
+    MOVE = 510,                    /* MOVE  */
+    NAME_P = 511,                  /* NAME_P  */
+    NAMES = 512,                   /* NAMES  */
+    NATIONAL = 513,                /* NATIONAL  */
+    NATURAL = 514,                 /* NATURAL  */
+    NCHAR = 515,                   /* NCHAR  */
+    NEW = 516,                     /* NEW  */
+    NEXT = 517,                    /* NEXT  */
+    NO = 518,                      /* NO  */
+    NONE = 519,                    /* NONE  */
+    NOT = 520,                     /* NOT  */
+    NOTHING = 521,                 /* NOTHING  */
+    NOTIFY = 522,                  /* NOTIFY  */
+    NOTNULL = 523,                 /* NOTNULL  */
+    NOWAIT = 524,                  /* NOWAIT  */
+    NULL_P = 525,                  /* NULL_P  */
+    NULLIF = 526,                  /* NULLIF  */
+    NULLS_P = 527,                 /* NULLS_P  */
+    NUMERIC = 528,                 /* NUMERIC  */
+    OBJECT_P = 529,                /* OBJECT_P  */
+    OF = 530,                      /* OF  */
+    OFF = 531,                     /* OFF  */
+    OFFSET = 532,                  /* OFFSET  */
+    OIDS = 533,                    /* OIDS  */
+    OLD = 534,                     /* OLD  */
+    ON = 535,                      /* ON  */
+    ONLY = 536,                    /* ONLY  */
+    OPERATOR = 537,                /* OPERATOR  */
+    OPTION = 538,                  /* OPTION  */
+    OPTIONS = 539,                 /* OPTIONS  */
+    OR = 540,                      /* OR  */
+    ORDER = 541,                   /* ORDER  */
+    ORDINALITY = 542,              /* ORDINALITY  */
+    OUT_P = 543,                   /* OUT_P  */
+    OUTER_P = 544,                 /* OUTER_P  */
+    OVER = 545,                    /* OVER  */
+    OVERLAPS = 546,                /* OVERLAPS  */
+    OVERLAY = 547,                 /* OVERLAY  */
+    OVERRIDING = 548,              /* OVERRIDING  */
+    OWNED = 549,                   /* OWNED  */
+    OWNER = 550,                   /* OWNER  */
+    PARALLEL = 551,                /* PARALLEL  */
+    PARSER = 552,                  /* PARSER  */
+    PARTIAL = 553,                 /* PARTIAL  */
+    PARTITION = 554,               /* PARTITION  */
+    PASSING = 555,                 /* PASSING  */
+    PASSWORD = 556,                /* PASSWORD  */
+    PERCENT = 557,                 /* PERCENT  */
+    PLACING = 558,                 /* PLACING  */
+    PLANS = 559,                   /* PLANS  */
+    POLICY = 560,                  /* POLICY  */
+    POSITION = 561,                /* POSITION  */
+    PRAGMA_P = 562,                /* PRAGMA_P  */
+    PRECEDING = 563,               /* PRECEDING  */
+    PRECISION = 564,               /* PRECISION  */
+    PREPARE = 565,                 /* PREPARE  */
+    PREPARED = 566,                /* PREPARED  */
+    PRESERVE = 567,                /* PRESERVE  */
+    PRIMARY = 568,                 /* PRIMARY  */
+    PRIOR = 569,                   /* PRIOR  */
+    PRIVILEGES = 570,              /* PRIVILEGES  */
+    PROCEDURAL = 571,              /* PROCEDURAL  */
+    PROCEDURE = 572,               /* PROCEDURE  */
+    PROGRAM = 573,                 /* PROGRAM  */
+    PUBLICATION = 574,             /* PUBLICATION  */
+    QUOTE = 575,                   /* QUOTE  */
+    RANGE = 576,                   /* RANGE  */
+    READ_P = 577,                  /* READ_P  */
+    REAL = 578,                    /* REAL  */
+    REASSIGN = 579,                /* REASSIGN  */
+    RECHECK = 580,                 /* RECHECK  */
+    RECURSIVE = 581,               /* RECURSIVE  */
+    REF = 582,                     /* REF  */
+    REFERENCES = 583,              /* REFERENCES  */
+    REFERENCING = 584,             /* REFERENCING  */
+    REFRESH = 585,                 /* REFRESH  */
+    REINDEX = 586,                 /* REINDEX  */
+    RELATIVE_P = 587,              /* RELATIVE_P  */
+    RELEASE = 588,                 /* RELEASE  */
+    RENAME = 589,                  /* RENAME  */
+    REPEATABLE = 590,              /* REPEATABLE  */
+    REPLACE = 591,                 /* REPLACE  */
+    REPLICA = 592,                 /* REPLICA  */
+    RESET = 593,                   /* RESET  */
+    RESTART = 594,                 /* RESTART  */
+    RESTRICT = 595,                /* RESTRICT  */
+    RETURNING = 596,               /* RETURNING  */
+    RETURNS = 597,                 /* RETURNS  */
+    REVOKE = 598,                  /* REVOKE  */
+    RIGHT = 599,                   /* RIGHT  */
+    ROLE = 600,                    /* ROLE  */
+    ROLLBACK = 601,                /* ROLLBACK  */
+    ROLLUP = 602,                  /* ROLLUP  */
+    ROW = 603,                     /* ROW  */
+    ROWS = 604,                    /* ROWS  */
+    RULE = 605,                    /* RULE  */
+    SAMPLE = 606,                  /* SAMPLE  */
+    SAVEPOINT = 607,               /* SAVEPOINT  */
+    SCHEMA = 608,                  /* SCHEMA  */
+    SCHEMAS = 609,                 /* SCHEMAS  */
+    SCROLL = 610,                  /* SCROLL  */
+    SEARCH = 611,                  /* SEARCH  */
+    SECOND_P = 612,                /* SECOND_P  */
+    SECONDS_P = 613,               /* SECONDS_P  */
+    SECURITY = 614,                /* SECURITY  */
+    SELECT = 615,                  /* SELECT  */
+    SEQUENCE = 616,                /* SEQUENCE  */
+    SEQUENCES = 617,               /* SEQUENCES  */
+    SERIALIZABLE = 618,            /* SERIALIZABLE  */
+    SERVER = 619,                  /* SERVER  */
+    SESSION = 620,                 /* SESSION  */
+    SESSION_USER = 621,            /* SESSION_USER  */
+    SET = 622,                     /* SET  */
+    SETOF = 623,                   /* SETOF  */
+    SETS = 624,                    /* SETS  */
+    SHARE = 625,                   /* SHARE  */
+    SHOW = 626,                    /* SHOW  */
+    SIMILAR = 627,                 /* SIMILAR  */
+    SIMPLE = 628,                  /* SIMPLE  */
+    SKIP = 629,                    /* SKIP  */
+    SMALLINT = 630,                /* SMALLINT  */
+    SNAPSHOT = 631,                /* SNAPSHOT  */
+    SOME = 632,                    /* SOME  */
+    SQL_P = 633,                   /* SQL_P  */
+    STABLE = 634,                  /* STABLE  */
+    STANDALONE_P = 635,            /* STANDALONE_P  */
+    START = 636,                   /* START  */
+    STATEMENT = 637,               /* STATEMENT  */
+    STATISTICS = 638,              /* STATISTICS  */
+    STDIN = 639,                   /* STDIN  */
+    STDOUT = 640,                  /* STDOUT  */
+    STORAGE = 641,                 /* STORAGE  */
+    STRICT_P = 642,                /* STRICT_P  */
+    STRIP_P = 643,                 /* STRIP_P  */
+    STRUCT = 644,                  /* STRUCT  */
+    SUBSCRIPTION = 645,            /* SUBSCRIPTION  */
+    SUBSTRING = 646,               /* SUBSTRING  */
+    SYMMETRIC = 647,               /* SYMMETRIC  */
+    SYSID = 648,                   /* SYSID  */
+    SYSTEM_P = 649,                /* SYSTEM_P  */
+    TABLE = 650,                   /* TABLE  */
+    TABLES = 651,                  /* TABLES  */
+    TABLESAMPLE = 652,             /* TABLESAMPLE  */
+    TABLESPACE = 653,              /* TABLESPACE  */
+    TEMP = 654,                    /* TEMP  */
+    TEMPLATE = 655,                /* TEMPLATE  */
+    TEMPORARY = 656,               /* TEMPORARY  */
+    TEXT_P = 657,                  /* TEXT_P  */
+    THEN = 658,                    /* THEN  */
+    TIME = 659,                    /* TIME  */
+    TIMESTAMP = 660,               /* TIMESTAMP  */
+    TO = 661,                      /* TO  */
+    TRAILING = 662,                /* TRAILING  */
+    TRANSACTION = 663,             /* TRANSACTION  */
+    TRANSFORM = 664,               /* TRANSFORM  */
+    TREAT = 665,                   /* TREAT  */
+    TRIGGER = 666,                 /* TRIGGER  */
+    TRIM = 667,                    /* TRIM  */
+    TRUE_P = 668,                  /* TRUE_P  */
+    TRUNCATE = 669,                /* TRUNCATE  */
+    TRUSTED = 670,                 /* TRUSTED  */
+    TRY_CAST = 671,                /* TRY_CAST  */
+    TYPE_P = 672,                  /* TYPE_P  */
+    TYPES_P = 673,                 /* TYPES_P  */
+    UNBOUNDED = 674,               /* UNBOUNDED  */
+    UNCOMMITTED = 675,             /* UNCOMMITTED  */
+    UNENCRYPTED = 676,             /* UNENCRYPTED  */
+    UNION = 677,                   /* UNION  */
+    UNIQUE = 678,                  /* UNIQUE  */
+    UNKNOWN = 679,                 /* UNKNOWN  */
+    UNLISTEN = 680,                /* UNLISTEN  */
+    UNLOGGED = 681,                /* UNLOGGED  */
+    UNTIL = 682,                   /* UNTIL  */
+    UPDATE = 683,                  /* UPDATE  */
+    USER = 684,                    /* USER  */
+    USING = 685,                   /* USING  */
+    VACUUM = 686,                  /* VACUUM  */
+    VALID = 687,                   /* VALID  */
+    VALIDATE = 688,                /* VALIDATE  */
+    VALIDATOR = 689,               /* VALIDATOR  */
+    VALUE_P = 690,                 /* VALUE_P  */
+    VALUES = 691,                  /* VALUES  */
+    VARCHAR = 692,                 /* VARCHAR  */
+    VARIADIC = 693,                /* VARIADIC  */
+    VARYING = 694,                 /* VARYING  */
+    VERBOSE = 695,                 /* VERBOSE  */
+    VERSION_P = 696,               /* VERSION_P  */
+    VIEW = 697,                    /* VIEW  */
+    VIEWS = 698,                   /* VIEWS  */
+    VOLATILE = 699,                /* VOLATILE  */
+    WHEN = 700,                    /* WHEN  */
+    WHERE = 701,                   /* WHERE  */
+    WHITESPACE_P = 702,            /* WHITESPACE_P  */
+    WINDOW = 703,                  /* WINDOW  */
+    WITH = 704,                    /* WITH  */
+    WITHIN = 705,                  /* WITHIN  */
+    WITHOUT = 706,                 /* WITHOUT  */
+    WORK = 707,                    /* WORK  */
+    WRAPPER = 708,                 /* WRAPPER  */
+    WRITE_P = 709,                 /* WRITE_P  */
+    XML_P = 710,                   /* XML_P  */
+    XMLATTRIBUTES = 711,           /* XMLATTRIBUTES  */
+    XMLCONCAT = 712,               /* XMLCONCAT  */
+    XMLELEMENT = 713,              /* XMLELEMENT  */
+    XMLEXISTS = 714,               /* XMLEXISTS  */
+    XMLFOREST = 715,               /* XMLFOREST  */
+    XMLNAMESPACES = 716,           /* XMLNAMESPACES  */
+    XMLPARSE = 717,                /* XMLPARSE  */
+    XMLPI = 718,                   /* XMLPI  */
+    XMLROOT = 719,                 /* XMLROOT  */
+    XMLSERIALIZE = 720,            /* XMLSERIALIZE  */
+    XMLTABLE = 721,                /* XMLTABLE  */
+    YEAR_P = 722,                  /* YEAR_P  */
+    YEARS_P = 723,                 /* YEARS_P  */
+    YES_P = 724,                   /* YES_P  */
+    ZONE = 725,                    /* ZONE  */
+    NOT_LA = 726,                  /* NOT_LA  */
+    NULLS_LA = 727,                /* NULLS_LA  */
+    WITH_LA = 728,                 /* WITH_LA  */
+    POSTFIXOP = 729,               /* POSTFIXOP  */
+    UMINUS = 730                   /* UMINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
-#define IDENT 258
-#define FCONST 259
-#define SCONST 260
-#define BCONST 261
-#define XCONST 262
-#define Op 263
-#define ICONST 264
-#define PARAM 265
-#define TYPECAST 266
-#define DOT_DOT 267
-#define COLON_EQUALS 268
-#define EQUALS_GREATER 269
-#define LAMBDA_ARROW 270
-#define LESS_EQUALS 271
-#define GREATER_EQUALS 272
-#define NOT_EQUALS 273
-#define ABORT_P 274
-#define ABSOLUTE_P 275
-#define ACCESS 276
-#define ACTION 277
-#define ADD_P 278
-#define ADMIN 279
-#define AFTER 280
-#define AGGREGATE 281
-#define ALL 282
-#define ALSO 283
-#define ALTER 284
-#define ALWAYS 285
-#define ANALYSE 286
-#define ANALYZE 287
-#define AND 288
-#define ANY 289
-#define ARRAY 290
-#define AS 291
-#define ASC_P 292
-#define ASSERTION 293
-#define ASSIGNMENT 294
-#define ASYMMETRIC 295
-#define AT 296
-#define ATTACH 297
-#define ATTRIBUTE 298
-#define AUTHORIZATION 299
-#define BACKWARD 300
-#define BEFORE 301
-#define BEGIN_P 302
-#define BETWEEN 303
-#define BIGINT 304
-#define BINARY 305
-#define BIT 306
-#define BOOLEAN_P 307
-#define BOTH 308
-#define BY 309
-#define CACHE 310
-#define CALL_P 311
-#define CALLED 312
-#define CASCADE 313
-#define CASCADED 314
-#define CASE 315
-#define CAST 316
-#define CATALOG_P 317
-#define CHAIN 318
-#define CHAR_P 319
-#define CHARACTER 320
-#define CHARACTERISTICS 321
-#define CHECK_P 322
-#define CHECKPOINT 323
-#define CLASS 324
-#define CLOSE 325
-#define CLUSTER 326
-#define COALESCE 327
-#define COLLATE 328
-#define COLLATION 329
-#define COLUMN 330
-#define COLUMNS 331
-#define COMMENT 332
-#define COMMENTS 333
-#define COMMIT 334
-#define COMMITTED 335
-#define CONCURRENTLY 336
-#define CONFIGURATION 337
-#define CONFLICT 338
-#define CONNECTION 339
-#define CONSTRAINT 340
-#define CONSTRAINTS 341
-#define CONTENT_P 342
-#define CONTINUE_P 343
-#define CONVERSION_P 344
-#define COPY 345
-#define COST 346
-#define CREATE_P 347
-#define CROSS 348
-#define CSV 349
-#define CUBE 350
-#define CURRENT_P 351
-#define CURRENT_CATALOG 352
-#define CURRENT_DATE 353
-#define CURRENT_ROLE 354
-#define CURRENT_SCHEMA 355
-#define CURRENT_TIME 356
-#define CURRENT_TIMESTAMP 357
-#define CURRENT_USER 358
-#define CURSOR 359
-#define CYCLE 360
-#define DATA_P 361
-#define DATABASE 362
-#define DAY_P 363
-#define DAYS_P 364
-#define DEALLOCATE 365
-#define DEC 366
-#define DECIMAL_P 367
-#define DECLARE 368
-#define DEFAULT 369
-#define DEFAULTS 370
-#define DEFERRABLE 371
-#define DEFERRED 372
-#define DEFINER 373
-#define DELETE_P 374
-#define DELIMITER 375
-#define DELIMITERS 376
-#define DEPENDS 377
-#define DESC_P 378
-#define DESCRIBE 379
-#define DETACH 380
-#define DICTIONARY 381
-#define DISABLE_P 382
-#define DISCARD 383
-#define DISTINCT 384
-#define DO 385
-#define DOCUMENT_P 386
-#define DOMAIN_P 387
-#define DOUBLE_P 388
-#define DROP 389
-#define EACH 390
-#define ELSE 391
-#define ENABLE_P 392
-#define ENCODING 393
-#define ENCRYPTED 394
-#define END_P 395
-#define ENUM_P 396
-#define ESCAPE 397
-#define EVENT 398
-#define EXCEPT 399
-#define EXCLUDE 400
-#define EXCLUDING 401
-#define EXCLUSIVE 402
-#define EXECUTE 403
-#define EXISTS 404
-#define EXPLAIN 405
-#define EXPORT_P 406
-#define EXTENSION 407
-#define EXTERNAL 408
-#define EXTRACT 409
-#define FALSE_P 410
-#define FAMILY 411
-#define FETCH 412
-#define FILTER 413
-#define FIRST_P 414
-#define FLOAT_P 415
-#define FOLLOWING 416
-#define FOR 417
-#define FORCE 418
-#define FOREIGN 419
-#define FORWARD 420
-#define FREEZE 421
-#define FROM 422
-#define FULL 423
-#define FUNCTION 424
-#define FUNCTIONS 425
-#define GENERATED 426
-#define GLOB 427
-#define GLOBAL 428
-#define GRANT 429
-#define GRANTED 430
-#define GROUP_P 431
-#define GROUPING 432
-#define HANDLER 433
-#define HAVING 434
-#define HEADER_P 435
-#define HOLD 436
-#define HOUR_P 437
-#define HOURS_P 438
-#define IDENTITY_P 439
-#define IF_P 440
-#define ILIKE 441
-#define IMMEDIATE 442
-#define IMMUTABLE 443
-#define IMPLICIT_P 444
-#define IMPORT_P 445
-#define IN_P 446
-#define INCLUDING 447
-#define INCREMENT 448
-#define INDEX 449
-#define INDEXES 450
-#define INHERIT 451
-#define INHERITS 452
-#define INITIALLY 453
-#define INLINE_P 454
-#define INNER_P 455
-#define INOUT 456
-#define INPUT_P 457
-#define INSENSITIVE 458
-#define INSERT 459
-#define INSTEAD 460
-#define INT_P 461
-#define INTEGER 462
-#define INTERSECT 463
-#define INTERVAL 464
-#define INTO 465
-#define INVOKER 466
-#define IS 467
-#define ISNULL 468
-#define ISOLATION 469
-#define JOIN 470
-#define KEY 471
-#define LABEL 472
-#define LANGUAGE 473
-#define LARGE_P 474
-#define LAST_P 475
-#define LATERAL_P 476
-#define LEADING 477
-#define LEAKPROOF 478
-#define LEFT 479
-#define LEVEL 480
-#define LIKE 481
-#define LIMIT 482
-#define LISTEN 483
-#define LOAD 484
-#define LOCAL 485
-#define LOCALTIME 486
-#define LOCALTIMESTAMP 487
-#define LOCATION 488
-#define LOCK_P 489
-#define LOCKED 490
-#define LOGGED 491
-#define MACRO 492
-#define MAP 493
-#define MAPPING 494
-#define MATCH 495
-#define MATERIALIZED 496
-#define MAXVALUE 497
-#define METHOD 498
-#define MICROSECOND_P 499
-#define MICROSECONDS_P 500
-#define MILLISECOND_P 501
-#define MILLISECONDS_P 502
-#define MINUTE_P 503
-#define MINUTES_P 504
-#define MINVALUE 505
-#define MODE 506
-#define MONTH_P 507
-#define MONTHS_P 508
-#define MOVE 509
-#define NAME_P 510
-#define NAMES 511
-#define NATIONAL 512
-#define NATURAL 513
-#define NCHAR 514
-#define NEW 515
-#define NEXT 516
-#define NO 517
-#define NONE 518
-#define NOT 519
-#define NOTHING 520
-#define NOTIFY 521
-#define NOTNULL 522
-#define NOWAIT 523
-#define NULL_P 524
-#define NULLIF 525
-#define NULLS_P 526
-#define NUMERIC 527
-#define OBJECT_P 528
-#define OF 529
-#define OFF 530
-#define OFFSET 531
-#define OIDS 532
-#define OLD 533
-#define ON 534
-#define ONLY 535
-#define OPERATOR 536
-#define OPTION 537
-#define OPTIONS 538
-#define OR 539
-#define ORDER 540
-#define ORDINALITY 541
-#define OUT_P 542
-#define OUTER_P 543
-#define OVER 544
-#define OVERLAPS 545
-#define OVERLAY 546
-#define OVERRIDING 547
-#define OWNED 548
-#define OWNER 549
-#define PARALLEL 550
-#define PARSER 551
-#define PARTIAL 552
-#define PARTITION 553
-#define PASSING 554
-#define PASSWORD 555
-#define PERCENT 556
-#define PLACING 557
-#define PLANS 558
-#define POLICY 559
-#define POSITION 560
-#define PRAGMA_P 561
-#define PRECEDING 562
-#define PRECISION 563
-#define PREPARE 564
-#define PREPARED 565
-#define PRESERVE 566
-#define PRIMARY 567
-#define PRIOR 568
-#define PRIVILEGES 569
-#define PROCEDURAL 570
-#define PROCEDURE 571
-#define PROGRAM 572
-#define PUBLICATION 573
-#define QUOTE 574
-#define RANGE 575
-#define READ_P 576
-#define REAL 577
-#define REASSIGN 578
-#define RECHECK 579
-#define RECURSIVE 580
-#define REF 581
-#define REFERENCES 582
-#define REFERENCING 583
-#define REFRESH 584
-#define REINDEX 585
-#define RELATIVE_P 586
-#define RELEASE 587
-#define RENAME 588
-#define REPEATABLE 589
-#define REPLACE 590
-#define REPLICA 591
-#define RESET 592
-#define RESTART 593
-#define RESTRICT 594
-#define RETURNING 595
-#define RETURNS 596
-#define REVOKE 597
-#define RIGHT 598
-#define ROLE 599
-#define ROLLBACK 600
-#define ROLLUP 601
-#define ROW 602
-#define ROWS 603
-#define RULE 604
-#define SAMPLE 605
-#define SAVEPOINT 606
-#define SCHEMA 607
-#define SCHEMAS 608
-#define SCROLL 609
-#define SEARCH 610
-#define SECOND_P 611
-#define SECONDS_P 612
-#define SECURITY 613
-#define SELECT 614
-#define SEQUENCE 615
-#define SEQUENCES 616
-#define SERIALIZABLE 617
-#define SERVER 618
-#define SESSION 619
-#define SESSION_USER 620
-#define SET 621
-#define SETOF 622
-#define SETS 623
-#define SHARE 624
-#define SHOW 625
-#define SIMILAR 626
-#define SIMPLE 627
-#define SKIP 628
-#define SMALLINT 629
-#define SNAPSHOT 630
-#define SOME 631
-#define SQL_P 632
-#define STABLE 633
-#define STANDALONE_P 634
-#define START 635
-#define STATEMENT 636
-#define STATISTICS 637
-#define STDIN 638
-#define STDOUT 639
-#define STORAGE 640
-#define STRICT_P 641
-#define STRIP_P 642
-#define STRUCT 643
-#define SUBSCRIPTION 644
-#define SUBSTRING 645
-#define SYMMETRIC 646
-#define SYSID 647
-#define SYSTEM_P 648
-#define TABLE 649
-#define TABLES 650
-#define TABLESAMPLE 651
-#define TABLESPACE 652
-#define TEMP 653
-#define TEMPLATE 654
-#define TEMPORARY 655
-#define TEXT_P 656
-#define THEN 657
-#define TIME 658
-#define TIMESTAMP 659
-#define TO 660
-#define TRAILING 661
-#define TRANSACTION 662
-#define TRANSFORM 663
-#define TREAT 664
-#define TRIGGER 665
-#define TRIM 666
-#define TRUE_P 667
-#define TRUNCATE 668
-#define TRUSTED 669
-#define TRY_CAST 670
-#define TYPE_P 671
-#define TYPES_P 672
-#define UNBOUNDED 673
-#define UNCOMMITTED 674
-#define UNENCRYPTED 675
-#define UNION 676
-#define UNIQUE 677
-#define UNKNOWN 678
-#define UNLISTEN 679
-#define UNLOGGED 680
-#define UNTIL 681
-#define UPDATE 682
-#define USER 683
-#define USING 684
-#define VACUUM 685
-#define VALID 686
-#define VALIDATE 687
-#define VALIDATOR 688
-#define VALUE_P 689
-#define VALUES 690
-#define VARCHAR 691
-#define VARIADIC 692
-#define VARYING 693
-#define VERBOSE 694
-#define VERSION_P 695
-#define VIEW 696
-#define VIEWS 697
-#define VOLATILE 698
-#define WHEN 699
-#define WHERE 700
-#define WHITESPACE_P 701
-#define WINDOW 702
-#define WITH 703
-#define WITHIN 704
-#define WITHOUT 705
-#define WORK 706
-#define WRAPPER 707
-#define WRITE_P 708
-#define XML_P 709
-#define XMLATTRIBUTES 710
-#define XMLCONCAT 711
-#define XMLELEMENT 712
-#define XMLEXISTS 713
-#define XMLFOREST 714
-#define XMLNAMESPACES 715
-#define XMLPARSE 716
-#define XMLPI 717
-#define XMLROOT 718
-#define XMLSERIALIZE 719
-#define XMLTABLE 720
-#define YEAR_P 721
-#define YEARS_P 722
-#define YES_P 723
-#define ZONE 724
-#define NOT_LA 725
-#define NULLS_LA 726
-#define WITH_LA 727
-#define POSTFIXOP 728
-#define UMINUS 729
-
-
-
 
+/* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 14 "third_party/libpg_query/grammar/grammar.y"
+union YYSTYPE
 {
+#line 15 "third_party/libpg_query/grammar/grammar.y"
+
 	core_YYSTYPE		core_yystype;
 	/* these fields must match core_YYSTYPE: */
 	int					ival;
@@ -1034,28 +577,33 @@ typedef union YYSTYPE
 	PGLockWaitPolicy lockwaitpolicy;
 	PGSubLinkType subquerytype;
 	PGViewCheckOption viewcheckoption;
-}
-/* Line 1529 of yacc.c.  */
-#line 1040 "third_party/libpg_query/grammar/grammar_out.hpp"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
 
+#line 582 "third_party/libpg_query/grammar/grammar_out.hpp"
 
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
 
+/* Location type.  */
 #if ! defined YYLTYPE && ! defined YYLTYPE_IS_DECLARED
-typedef struct YYLTYPE
+typedef struct YYLTYPE YYLTYPE;
+struct YYLTYPE
 {
   int first_line;
   int first_column;
   int last_line;
   int last_column;
-} YYLTYPE;
-# define yyltype YYLTYPE /* obsolescent; will be withdrawn */
+};
 # define YYLTYPE_IS_DECLARED 1
 # define YYLTYPE_IS_TRIVIAL 1
 #endif
 
 
+
+
+int base_yyparse (core_yyscan_t yyscanner);
+
+
+#endif /* !YY_BASE_YY_THIRD_PARTY_LIBPG_QUERY_GRAMMAR_GRAMMAR_OUT_HPP_INCLUDED  */